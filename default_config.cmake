@@ -206,6 +206,111 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_LOCKFREE_REFCOUNT
+# ----------------------------------
+#
+# Controls whether OS_LOCK_MODE_REFCOUNT object acquisition uses atomic operations
+#
+# If set FALSE, every REFCOUNT acquisition and release takes the global table
+# lock for the object type in order to validate the ID and adjust the reference
+# count.  All tasks operating on objects of the same type (e.g. all queues)
+# are serialized on that lock, even when operating on different objects.
+#
+# If set TRUE (default), the reference count is maintained using C11 atomic
+# operations and an uncontended REFCOUNT acquisition/release does not touch
+# the global table lock at all.  The lock is only used if the object is
+# being created or deleted at the same time.
+#
+# Note that this option does not affect the compiler requirements.  The OSAL
+# implementation always requires a compiler which supports the C11
+# <stdatomic.h> header, as other parts of it (e.g. object state changes,
+# memory pools and the console buffer) use atomic operations regardless of
+# this setting.  The public API headers remain usable from C99.
+#
+set(OSAL_CONFIG_LOCKFREE_REFCOUNT               TRUE
+    CACHE BOOL "Controls use of atomic operations for object reference counting"
+)
+
+#
+# OSAL_CONFIG_QUEUE_USERSPACE
+# ----------------------------------
+#
+# Controls the default implementation of message queues
+#
+# If set FALSE (default), queues are implemented using the native message
+# queue facility of the operating system (e.g. mq_open() on POSIX).
+#
+# If set TRUE, queues are implemented in user space as a bounded ring of
+# fixed-size message slots, on implementations which support it.  This avoids
+# a system call for every message and is not subject to system limits on queue
+# depth, but the queue is only accessible within the current process.
+#
+# In either case, the application may select the implementation for an
+# individual queue using the OS_QUEUE_FLAG_SYSTEM and OS_QUEUE_FLAG_USERSPACE
+# flags to OS_QueueCreate().
+#
+set(OSAL_CONFIG_QUEUE_USERSPACE                 FALSE
+    CACHE BOOL "Controls whether message queues are implemented in user space by default"
+)
+
+#
+# OSAL_CONFIG_TIMEBASE_TIMERFD
+# ----------------------------------
+#
+# Controls how the POSIX implementation generates a simulated timebase tick
+#
+# If set TRUE (default), time bases without an external sync function use a
+# timerfd on CLOCK_MONOTONIC.  The handler thread reads the expiration count
+# from the file descriptor, so any ticks missed due to scheduling delays are
+# reported to the timer callbacks rather than being lost.  This is specific to
+# Linux.
+#
+# If set FALSE, each time base uses a POSIX timer which delivers an RT signal
+# to the handler thread.  Each time base consumes a separate signal number, so
+# the number of simulated time bases is limited by the number of RT signals.
+#
+set(OSAL_CONFIG_TIMEBASE_TIMERFD                TRUE
+    CACHE BOOL "Controls use of timerfd for simulated time bases on POSIX"
+)
+
+#
+# OSAL_CONFIG_TIMER_STATS
+# ----------------------------------
+#
+# Controls collection of time base and timer latency statistics
+#
+# If set TRUE (default), the time base servicing task samples the monotonic
+# clock on every tick and around every timer callback, and accumulates the
+# latency/execution time statistics which are reported by OS_TimeBaseGetStats()
+# and OS_TimerGetStats().
+#
+# If set FALSE, the collection is compiled out entirely and these APIs
+# return OS_ERR_NOT_IMPLEMENTED.
+#
+set(OSAL_CONFIG_TIMER_STATS                     TRUE
+    CACHE BOOL "Controls collection of time base and timer latency statistics"
+)
+
+#
+# OSAL_CONFIG_LOCK_STATS
+# ----------------------------------
+#
+# Controls collection of object table lock statistics
+#
+# If set TRUE, every acquisition of an object table lock samples the
+# monotonic clock before and after locking and before unlocking, and
+# accumulates the wait and hold time statistics which are reported by
+# OS_ObjectTypeGetLockStats().  This is intended for finding which OSAL
+# calls serialize tasks, and adds overhead to every table lock.
+#
+# If set FALSE (default), the collection is compiled out entirely and
+# OS_ObjectTypeGetLockStats() returns OS_ERR_NOT_IMPLEMENTED.
+#
+set(OSAL_CONFIG_LOCK_STATS                      FALSE
+    CACHE BOOL "Controls collection of object table lock statistics"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -243,6 +348,16 @@ set(OSAL_CONFIG_MAX_CONDVARS             4
     CACHE STRING "Maximum Number of Condition Variables to support"
 )
 
+# The maximum number of pollers to support
+set(OSAL_CONFIG_MAX_POLLERS              4
+    CACHE STRING "Maximum Number of Pollers to support"
+)
+
+# The maximum number of memory pools to support
+set(OSAL_CONFIG_MAX_MEMPOOLS             4
+    CACHE STRING "Maximum Number of Memory Pools to support"
+)
+
 # The maximum number of loadable modules to support
 # Note that emulating module loading for statically-linked objects also
 # requires a slot in this table, as it still assigns an OSAL ID.
@@ -265,6 +380,16 @@ set(OSAL_CONFIG_MAX_NUM_OPEN_FILES      50
     CACHE STRING "Maximum Number of Open Files to support"
 )
 
+# The maximum number of memory mappings that may exist at once on each open file
+set(OSAL_CONFIG_MAX_FILE_MAPPINGS       4
+    CACHE STRING "Maximum Number of Mappings per Open File to support"
+)
+
+# The maximum number of asynchronous operations that may be in progress at once on each open file
+set(OSAL_CONFIG_MAX_ASYNC_IO            32
+    CACHE STRING "Maximum Number of Asynchronous Operations per Open File to support"
+)
+
 # The maximum number of concurrently open directory descriptors to support
 set(OSAL_CONFIG_MAX_NUM_OPEN_DIRS       4
     CACHE STRING "Maximum Number of Open Directories to support"
@@ -335,6 +460,20 @@ set(OSAL_CONFIG_UTILITYTASK_STACK_SIZE  2048
     CACHE STRING "Stack size for the background utility task"
 )
 
+# Size of the pool of pre-allocated task stacks, in KiB.
+#
+# Where supported (currently POSIX), stacks of tasks created with
+# OSAL_TASK_STACK_ALLOCATE are carved out of a pool of this size, with a
+# guard page below each stack.  Stacks are recycled when the task ends, and
+# the peak stack usage of the task is reported by OS_TaskGetInfo().
+# The address space is reserved at OS_API_Init(), but memory is only
+# committed as the stacks are used.
+#
+# Set to 0 (default) to not use a pool, so stacks are allocated by the OS.
+set(OSAL_CONFIG_TASK_STACK_POOL_KB      0
+    CACHE STRING "Size of the task stack pool in KiB"
+)
+
 # The size of a command that can be passed to the underlying OS
 # Only applicable when shell feature is enabled
 set(OSAL_CONFIG_MAX_CMD_LEN             1000
@@ -348,6 +487,16 @@ set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
 
+# The size of a CPU cache line on the target, in bytes.
+# Object records that are updated on every operation (reference counts,
+# semaphore values, etc.) are aligned to this size so that operations on
+# different objects from different CPUs do not contend for the same line.
+# Must be a power of two, at least the size of a pointer.  This may be
+# reduced on memory-constrained single-core targets to pack the tables.
+set(OSAL_CONFIG_CACHE_LINE_SIZE         64
+    CACHE STRING "Size of a CPU cache line"
+)
+
 # Flags added to all tasks on creation
 #
 # Some OS's use floating point under the hood, this supports
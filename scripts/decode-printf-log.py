@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# NASA Docket No. GSC-18,719-1, and identified as "core Flight System: Bootes"
+#
+# Copyright (c) 2020 United States Government as represented by the
+# Administrator of the National Aeronautics and Space Administration.
+# All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License. You may obtain
+# a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Decoder for OS_printf() output captured in OS_PRINTF_MODE_BINARY mode
+
+Each message is a binary frame (see OS_console_binary_hdr_t in
+os-shared-console.h) holding either already formatted text, or a
+format string along with the raw argument words and string data.
+This formats the messages and writes them as text, prefixed with the
+time they were recorded.  Any data outside of a frame, such as output
+written before binary mode was enabled, is passed through unchanged.
+
+On the generic-linux BSP, set OSAL_PRINTF_BINARY_LOG to the name of a
+file to have the frames written there, apart from the console text.
+Otherwise the frames are written to the console, and the whole console
+output needs to be captured.
+
+Usage: decode-printf-log.py [capture-file] > text-file
+"""
+
+import re
+import struct
+import sys
+
+FRAME_MAGIC = 0x474C534F
+FRAME_TEXT = 1
+FRAME_DEFERRED = 2
+
+HDR_FORMAT = "IIHHIqII"
+HDR_SIZE = struct.calcsize("<" + HDR_FORMAT)
+
+SPEC_RE = re.compile(rb"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t)?([diouxXceEfFgGaAsp%])")
+
+
+def to_signed(value):
+    return value - (1 << 64) if value & (1 << 63) else value
+
+
+def format_message(fmt, words, strings, endian):
+    """Apply the recorded arguments to a C format string"""
+    out = []
+    pos = 0
+    idx = 0
+
+    def next_word():
+        nonlocal idx
+        value = words[idx] if idx < len(words) else 0
+        idx += 1
+        return value
+
+    for match in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos : match.start()].decode(errors="replace"))
+        pos = match.end()
+
+        flags, width, precision, _, conv = (g.decode() if g is not None else None for g in match.groups())
+        if conv == "%":
+            out.append("%")
+            continue
+
+        if width == "*":
+            width = str(to_signed(next_word()))
+        if precision == "*":
+            precision = to_signed(next_word())
+            precision = str(precision) if precision >= 0 else None
+        value = next_word()
+
+        if conv in "di":
+            arg = to_signed(value)
+        elif conv in "ouxX":
+            arg = value
+        elif conv == "c":
+            arg = chr(to_signed(value) & 0xFF)
+        elif conv in "eEfFgGaA":
+            arg = struct.unpack(endian + "d", struct.pack(endian + "Q", value))[0]
+        elif conv == "p":
+            arg = hex(value) if value != 0 else "(nil)"
+            conv = "s"
+        else:
+            end = strings.find(b"\0", value)
+            arg = strings[value : end if end >= 0 else len(strings)].decode(errors="replace")
+
+        if conv in "aA":
+            # python has no hex float conversion
+            arg = arg.hex() if conv == "a" else arg.hex().upper()
+            conv = "s"
+            precision = None
+        elif conv == "u":
+            conv = "d"
+        elif conv == "o" and "#" in flags:
+            # C uses a leading zero rather than the python "0o" prefix
+            flags = flags.replace("#", "")
+            arg = "0" + format(arg, "o") if arg != 0 else "0"
+            conv = "s"
+
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "") + conv
+        out.append(spec % arg)
+
+    out.append(fmt[pos:].decode(errors="replace"))
+    return "".join(out)
+
+
+def decode(data, output):
+    pos = 0
+    while pos < len(data):
+        start = pos
+        endian = None
+        while pos + HDR_SIZE <= len(data):
+            magic = data[pos : pos + 4]
+            if magic == struct.pack("<I", FRAME_MAGIC):
+                endian = "<"
+                break
+            if magic == struct.pack(">I", FRAME_MAGIC):
+                endian = ">"
+                break
+            pos += 1
+
+        if endian is None:
+            pos = len(data)
+
+        # data outside of any frame
+        output.write(data[start:pos].decode(errors="replace"))
+        if endian is None:
+            break
+
+        (_, frame_len, frame_type, format_len, num_words, timestamp, str_size, ticks_per_sec) = struct.unpack(
+            endian + HDR_FORMAT, data[pos : pos + HDR_SIZE]
+        )
+        if frame_len < HDR_SIZE or pos + frame_len > len(data):
+            # not a valid frame, treat it as text
+            output.write(data[pos : pos + 1].decode(errors="replace"))
+            pos += 1
+            continue
+
+        body = data[pos + HDR_SIZE : pos + frame_len]
+        pos += frame_len
+
+        fmt = body[:format_len]
+        words = struct.unpack(endian + "%dQ" % num_words, body[format_len : format_len + (8 * num_words)])
+        strings = body[format_len + (8 * num_words) : format_len + (8 * num_words) + str_size]
+
+        if frame_type == FRAME_DEFERRED:
+            seconds = timestamp / ticks_per_sec if ticks_per_sec else 0.0
+            output.write("[%.6f] %s" % (seconds, format_message(fmt, words, strings, endian)))
+        else:
+            output.write(strings.decode(errors="replace"))
+
+
+def main():
+    if len(sys.argv) > 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    if len(sys.argv) == 2:
+        with open(sys.argv[1], "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    decode(data, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
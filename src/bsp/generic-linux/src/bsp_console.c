@@ -28,6 +28,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 
 #include "generic_linux_bsp_internal.h"
@@ -64,6 +65,51 @@ static void OS_BSP_ExecTput(const char *cap, const char *param)
     waitpid(cpid, &status, 0);
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_WriteSegments()
+
+   Helper function: Write all the segments to the given file
+   descriptor, unbuffered, using as few system calls as possible.
+ ------------------------------------------------------------------*/
+static void OS_BSP_WriteSegments(int fd, const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    struct iovec  iov[OS_BSP_CONSOLE_MAX_SEGMENTS];
+    struct iovec *iovp;
+    size_t        i;
+    ssize_t       WriteLen;
+
+    for (i = 0; i < NumSegments; ++i)
+    {
+        iov[i].iov_base = (void *)Segments[i].Str;
+        iov[i].iov_len  = Segments[i].DataLen;
+    }
+
+    iovp = iov;
+    while (NumSegments > 0)
+    {
+        /* writes all segments directly to the file (unbuffered) in a single call */
+        WriteLen = writev(fd, iovp, NumSegments);
+        if (WriteLen < 0)
+        {
+            /* no recourse if this fails, just stop. */
+            break;
+        }
+
+        /* skip over whatever was written, which may end partway through a segment */
+        while (NumSegments > 0 && (size_t)WriteLen >= iovp->iov_len)
+        {
+            WriteLen -= iovp->iov_len;
+            ++iovp;
+            --NumSegments;
+        }
+        if (NumSegments > 0)
+        {
+            iovp->iov_base = (char *)iovp->iov_base + WriteLen;
+            iovp->iov_len -= WriteLen;
+        }
+    }
+}
+
 /****************************************************************************************
                     BSP CONSOLE IMPLEMENTATION FUNCTIONS
  ****************************************************************************************/
@@ -90,6 +136,31 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputV_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    OS_BSP_WriteSegments(STDOUT_FILENO, Segments, NumSegments);
+}
+
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleBinaryOutputV_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleBinaryOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    if (OS_BSP_GenericLinuxGlobal.BinaryLogFd >= 0)
+    {
+        OS_BSP_WriteSegments(OS_BSP_GenericLinuxGlobal.BinaryLogFd, Segments, NumSegments);
+    }
+    else
+    {
+        OS_BSP_WriteSegments(STDOUT_FILENO, Segments, NumSegments);
+    }
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
@@ -31,6 +31,7 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -49,6 +50,7 @@ void OS_BSP_Initialize(void)
 {
     FILE *              fp;
     char                buffer[32];
+    const char *        binary_log;
     pthread_mutexattr_t mutex_attr;
     int                 status;
 
@@ -77,6 +79,22 @@ void OS_BSP_Initialize(void)
         }
     }
 
+    /*
+     * If OSAL_PRINTF_BINARY_LOG names a file, the binary frames written when
+     * OS_printf() is in OS_PRINTF_MODE_BINARY mode go to that file instead of
+     * the console, so they are not mixed with other console output.
+     */
+    OS_BSP_GenericLinuxGlobal.BinaryLogFd = -1;
+    binary_log                            = getenv("OSAL_PRINTF_BINARY_LOG");
+    if (binary_log != NULL && binary_log[0] != 0)
+    {
+        OS_BSP_GenericLinuxGlobal.BinaryLogFd = open(binary_log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (OS_BSP_GenericLinuxGlobal.BinaryLogFd < 0)
+        {
+            BSP_DEBUG("open(%s): %s\n", binary_log, strerror(errno));
+        }
+    }
+
     /* Initialize the low level access mutex (w/priority inheritance) */
     status = pthread_mutexattr_init(&mutex_attr);
     if (status < 0)
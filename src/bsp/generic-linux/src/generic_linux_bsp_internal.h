@@ -41,6 +41,7 @@ typedef struct
     bool            EnableTermControl; /**< Will be set "true" when invoked from a TTY device, false otherwise */
     pthread_mutex_t AccessMutex;
     int             AccessCancelState;
+    int             BinaryLogFd; /**< Destination of binary console output, or -1 to use the console */
 } OS_BSP_GenericLinuxGlobalData_t;
 
 /*
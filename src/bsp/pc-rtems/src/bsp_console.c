@@ -45,6 +45,30 @@ void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     write(STDOUT_FILENO, Str, DataLen);
 }
 
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleOutputV_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    size_t i;
+
+    for (i = 0; i < NumSegments; ++i)
+    {
+        OS_BSP_ConsoleOutput_Impl(Segments[i].Str, Segments[i].DataLen);
+    }
+}
+
+/*----------------------------------------------------------------
+   OS_BSP_ConsoleBinaryOutputV_Impl
+   See full description in header
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleBinaryOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    /* no separate channel for binary data, it goes to the console */
+    OS_BSP_ConsoleOutputV_Impl(Segments, NumSegments);
+}
+
 /*----------------------------------------------------------------
    OS_BSP_ConsoleSetMode_Impl() definition
    See full description in header
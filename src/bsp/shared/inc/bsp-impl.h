@@ -66,6 +66,21 @@
 
 #define OS_BSP_CONSOLEMODE_TO_ANSICOLOR(x) ((x)&0x07)
 
+/*
+ * Maximum number of segments that may be passed in a single call
+ * to OS_BSP_ConsoleOutputV_Impl()
+ */
+#define OS_BSP_CONSOLE_MAX_SEGMENTS 16
+
+/**
+ * A segment of console data, for OS_BSP_ConsoleOutputV_Impl()
+ */
+typedef struct
+{
+    const char *Str;     /**< Start of the data, not null terminated */
+    size_t      DataLen; /**< Number of characters to write */
+} OS_BSP_ConsoleSegment_t;
+
 /*
  * Macro for BSP debug messages, similar to OS_DEBUG in OSAL code.
  *
@@ -148,6 +163,35 @@ void OS_BSP_Unlock_Impl(void);
  ------------------------------------------------------------------*/
 void OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen);
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of several segments.
+             Writes each segment in order, the same as calling
+             OS_BSP_ConsoleOutput_Impl() for each one.
+
+             This allows the console ring buffer to be drained in
+             bulk, using a single system call where the platform
+             supports vectored writes.
+
+             At most OS_BSP_CONSOLE_MAX_SEGMENTS may be passed.
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments);
+
+/*----------------------------------------------------------------
+
+    Purpose: Low level output of binary console data, in several segments.
+             This is used for the frames written when OS_printf() is in
+             OS_PRINTF_MODE_BINARY mode.
+
+             A BSP that provides a separate channel for binary data
+             (such as a log file) writes the segments there, so the
+             frames are not mixed with text written to the console.
+             Otherwise this is the same as OS_BSP_ConsoleOutputV_Impl().
+
+             At most OS_BSP_CONSOLE_MAX_SEGMENTS may be passed.
+ ------------------------------------------------------------------*/
+void OS_BSP_ConsoleBinaryOutputV_Impl(const OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments);
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
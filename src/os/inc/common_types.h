@@ -115,6 +115,14 @@ typedef uint32 osal_id_t;
      */
     typedef size_t osal_blockcount_t;
 
+    /**
+     * A type used to represent a byte offset within a file, or the length of a range of a file
+     *
+     * This is signed and 64 bits wide on all platforms, so that files larger
+     * than 2 GiB can be addressed.
+     */
+    typedef int64 osal_offset_t;
+
     /**
      * A type used to represent an index into a table structure
      *
@@ -170,6 +178,7 @@ typedef uint32 osal_id_t;
  */
 #define OSAL_SIZE_C(X)       ((size_t)(X))
 #define OSAL_BLOCKCOUNT_C(X) ((osal_blockcount_t)(X))
+#define OSAL_OFFSET_C(X)     ((osal_offset_t)(X))
 #define OSAL_INDEX_C(X)      ((osal_index_t)(X))
 #define OSAL_OBJTYPE_C(X)    ((osal_objtype_t)(X))
 #define OSAL_STATUS_C(X)     ((osal_status_t)(X))
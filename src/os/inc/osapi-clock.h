@@ -125,6 +125,26 @@ int32 OS_GetLocalTime(OS_time_t *time_struct);
  */
 int32 OS_SetLocalTime(const OS_time_t *time_struct);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the monotonic time
+ *
+ * This function gets the current value of a clock which always advances at a
+ * steady rate, and is not affected by changes to the local time such as via
+ * OS_SetLocalTime() or time synchronization services.
+ *
+ * The epoch of this clock is unspecified (e.g. it may be the time the system
+ * was started), so the value is only meaningful relative to another value
+ * obtained from this function.  It is intended for measuring elapsed time.
+ *
+ * @param[out]  time_struct An OS_time_t that will be set to the current monotonic time @nonnull
+ *
+ * @return Get monotonic time status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if time_struct is null
+ */
+int32 OS_GetMonotonicTime(OS_time_t *time_struct);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an absolute time value relative to the current time
@@ -196,6 +196,10 @@ int32 OS_CondVarWait(osal_id_t var_id);
  * task should be unblocked to run, regardless of the state of the condition variable.
  * This refers to the same system clock that is the subject of the OS_GetLocalTime() API.
  *
+ * @note On implementations which support it, the wakeup time is converted to a deadline
+ * on a monotonic clock when the wait begins.  Changes to the system clock while the task
+ * is blocked do not affect the duration of the wait.
+ *
  * @param[in] var_id The object ID to operate on
  * @param[in] abs_wakeup_time The system time at which the task should be unblocked @nonnull
  *
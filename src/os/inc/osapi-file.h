@@ -45,6 +45,27 @@
 #define OS_SEEK_END 2 /**< Seek offset end */
 /**@}*/
 
+/** @defgroup OSFileMapAccess OSAL File Mapping Access and Hint Defines
+ * @{
+ */
+#define OS_FILE_MAP_READ       0x01 /**< Mapping may be read */
+#define OS_FILE_MAP_WRITE      0x02 /**< Mapping may be written, changes are stored in the file */
+#define OS_FILE_MAP_SEQUENTIAL 0x10 /**< Hint that the mapping will be accessed in order */
+#define OS_FILE_MAP_WILLNEED   0x20 /**< Hint that the whole mapping will be accessed soon */
+/**@}*/
+
+/**
+ * @brief Completion of an asynchronous file operation
+ *
+ * Output by OS_AsyncWaitCompletion() for each operation started with
+ * OS_AsyncReadSubmit() or OS_AsyncWriteSubmit().
+ */
+typedef struct
+{
+    void *user_arg; /**< The user_arg given when the operation was submitted */
+    int32 result;   /**< Number of bytes transferred, or a negative error code, see @ref OSReturnCodes */
+} OS_async_completion_t;
+
 /** @brief OSAL file properties */
 typedef struct
 {
@@ -109,6 +130,27 @@ typedef enum
     OS_FILE_FLAG_TRUNCATE = 0x02
 } OS_file_flag_t;
 
+/**
+ * @brief The maximum number of segments accepted by the scatter/gather APIs
+ *
+ * This is the minimum IOV_MAX value required by POSIX, so it should be
+ * supported on all platforms.  The user may provide a tuned value through osconfig.h
+ */
+#ifndef OS_IOV_MAX
+#define OS_IOV_MAX 16
+#endif
+
+/**
+ * @brief A single segment of a scatter/gather I/O request
+ *
+ * @sa OS_readv(), OS_writev(), OS_SocketSendV()
+ */
+typedef struct
+{
+    void * Buffer; /**< @brief Start of the data segment */
+    size_t Length; /**< @brief Size of the data segment, in bytes */
+} OS_iovec_t;
+
 /*
  * Exported Functions
  */
@@ -206,6 +248,251 @@ int32 OS_read(osal_id_t filedes, void *buffer, size_t nbytes);
  */
 int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read from a file handle at a given offset
+ *
+ * Reads up to nbytes from the file described in filedes, starting at the given
+ * offset from the beginning of the file.  The file position is not used or
+ * changed, so several tasks may read from the same file handle at once without
+ * serializing on OS_lseek().
+ *
+ * This is intended for regular files; it does not work on sockets or pipes.
+ *
+ * @param[in]  filedes  The handle ID to operate on
+ * @param[out] buffer   Storage location for file data @nonnull
+ * @param[in]  nbytes   Maximum number of bytes to read @nonzero
+ * @param[in]  offset   Offset in the file of the first byte to read, must not be negative
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if the offset is at or beyond the end of file
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Write to a file handle at a given offset
+ *
+ * Writes up to nbytes of buffer to the file described in filedes, starting at
+ * the given offset from the beginning of the file.  The file is extended if
+ * needed.  The file position is not used or changed.
+ *
+ * This is intended for regular files; it does not work on sockets or pipes.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] buffer    Source location for file data @nonnull
+ * @param[in] nbytes    Maximum number of bytes to write @nonzero
+ * @param[in] offset    Offset in the file at which to store the first byte, must not be negative
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read from a file handle into multiple buffers
+ *
+ * Scatter version of OS_read().  Data is read in a single operation and stored
+ * into each of the segments in turn, filling each segment before moving on to
+ * the next.
+ *
+ * @param[in]  filedes  The handle ID to operate on
+ * @param[in]  iov      Array of segments describing the storage for file data @nonnull
+ * @param[in]  iovcnt   Number of entries in the iov array @nonzero, at most #OS_IOV_MAX
+ *
+ * @return A non-negative total byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if iov or any segment buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in segment count is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if at end of file/stream data
+ */
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Write to a file handle from multiple buffers
+ *
+ * Gather version of OS_write().  The contents of each segment are written in
+ * order, as a single operation.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] iov       Array of segments describing the source file data @nonnull
+ * @param[in] iovcnt    Number of entries in the iov array @nonzero, at most #OS_IOV_MAX
+ *
+ * @return A non-negative total byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if iov or any segment buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in segment count is not valid
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval 0 if file/stream cannot accept any more data
+ */
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Map part of an open file into memory
+ *
+ * Makes len bytes of the file, starting at offset, directly accessible at the
+ * address output in addr.  The file contents are brought into memory as they
+ * are accessed, so data can be used in place without first reading it into
+ * a buffer.  The offset does not need to be aligned to a page.
+ *
+ * The whole range must lie within the file as it is now; a mapping does not
+ * extend the file.  Extend the file first (e.g. with OS_pwrite()) if needed.
+ *
+ * The file must have been opened with an access mode that allows the requested
+ * access.  With #OS_FILE_MAP_WRITE, changes made through the mapping are stored
+ * in the file, and are written out before OS_FileUnmap() returns.
+ *
+ * Mappings are tracked with the file handle, at most #OS_MAX_FILE_MAPPINGS at
+ * a time.  Any mappings still in place when the file is closed are removed by
+ * OS_close(), after which the memory must no longer be accessed.
+ *
+ * @param[in]  filedes  The handle ID of a file opened with OS_OpenCreate()
+ * @param[in]  offset   Offset in the file of the first byte to map, must not be negative
+ * @param[in]  len      Number of bytes to map @nonzero
+ * @param[in]  access   #OS_FILE_MAP_READ and/or #OS_FILE_MAP_WRITE, optionally combined
+ *                      with the hints in @ref OSFileMapAccess
+ * @param[out] addr     Address of the mapped data, i.e. of the byte at offset @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_INVALID_SIZE if len is zero, or the range extends beyond the end of file
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset or access flags are not valid
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a file (e.g. a socket)
+ * @retval #OS_ERR_NO_FREE_IDS if the file already has the maximum number of mappings
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support mapping files
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t len, uint32 access, void **addr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Remove a mapping created by OS_FileMap()
+ *
+ * For a writable mapping, any changes are first written out to the file.
+ * The memory must not be accessed after this call.
+ *
+ * @param[in] filedes   The handle ID the mapping was created on
+ * @param[in] addr      The address that was output by OS_FileMap() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if addr is not a mapping of this file
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileUnmap(osal_id_t filedes, void *addr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Start reading from a file at a given offset without waiting
+ *
+ * Asynchronous version of OS_pread().  The read is started and this returns
+ * immediately; the outcome is collected later with OS_AsyncWaitCompletion(),
+ * which identifies the operation by its user_arg.  This allows one task to keep
+ * many operations in progress at once, up to #OS_MAX_ASYNC_IO on each file.
+ *
+ * The buffer must remain valid and must not be accessed until the completion
+ * has been collected.  Operations in progress when the file is closed are
+ * waited for by OS_close().
+ *
+ * Operations on the same file may complete in any order.  The read/write
+ * pointer of the file is not used or moved.
+ *
+ * @param[in]  filedes   The handle ID of a file opened with OS_OpenCreate()
+ * @param[out] buffer    Storage location for file data @nonnull
+ * @param[in]  nbytes    Maximum number of bytes to read @nonzero
+ * @param[in]  offset    Offset in the file of the first byte to read, must not be negative
+ * @param[in]  user_arg  Passed back in the completion of this operation
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if the read was started
+ * @retval #OS_INVALID_POINTER if buffer is NULL
+ * @retval #OS_ERR_INVALID_SIZE if nbytes is zero or too large
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is negative
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a file (e.g. a socket)
+ * @retval #OS_QUEUE_FULL if #OS_MAX_ASYNC_IO operations are already in progress on the file
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support asynchronous file I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_AsyncReadSubmit(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset, void *user_arg);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Start writing to a file at a given offset without waiting
+ *
+ * Asynchronous version of OS_pwrite().  See OS_AsyncReadSubmit() for how the
+ * operation is completed.  The buffer must remain valid and unchanged until
+ * the completion has been collected.
+ *
+ * @param[in] filedes   The handle ID of a file opened with OS_OpenCreate()
+ * @param[in] buffer    Source location for file data @nonnull
+ * @param[in] nbytes    Number of bytes to write @nonzero
+ * @param[in] offset    Offset in the file of the first byte to write, must not be negative
+ * @param[in] user_arg  Passed back in the completion of this operation
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if the write was started
+ * @retval #OS_INVALID_POINTER if buffer is NULL
+ * @retval #OS_ERR_INVALID_SIZE if nbytes is zero or too large
+ * @retval #OS_ERR_INVALID_ARGUMENT if the offset is negative
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a file (e.g. a socket)
+ * @retval #OS_QUEUE_FULL if #OS_MAX_ASYNC_IO operations are already in progress on the file
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support asynchronous file I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_AsyncWriteSubmit(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset,
+                          void *user_arg);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for an asynchronous operation on a file to complete
+ *
+ * Outputs the completion of one operation started on the file with
+ * OS_AsyncReadSubmit() or OS_AsyncWriteSubmit(), waiting up to the given
+ * time if none has completed yet.  Completions are output in the order the
+ * operations finished, which may differ from the order they were submitted.
+ *
+ * The result in the completion is what OS_pread() or OS_pwrite() would have
+ * returned for the same operation.  Collecting a completion frees its place,
+ * allowing another operation to be submitted.
+ *
+ * The completions of a file are intended to be collected by one task.
+ *
+ * @param[in]  filedes     The handle ID the operations were submitted on
+ * @param[out] completion  The completion of one operation @nonnull
+ * @param[in]  msecs       Maximum time to wait in milliseconds, #OS_PEND to wait
+ *                         indefinitely, or #OS_CHECK to not wait at all
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if a completion was output
+ * @retval #OS_INVALID_POINTER if completion is NULL
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a file (e.g. a socket)
+ * @retval #OS_QUEUE_EMPTY if no operations are in progress on the file
+ * @retval #OS_ERROR_TIMEOUT if no operation completed in the given time
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support asynchronous file I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_AsyncWaitCompletion(osal_id_t filedes, OS_async_completion_t *completion, int32 msecs);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief File/Stream input read with a timeout
@@ -483,6 +770,37 @@ int32 OS_rename(const char *old_filename, const char *new_filename);
  */
 int32 OS_cp(const char *src, const char *dest);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies a range of bytes from one open file to another
+ *
+ * Copies len bytes starting at src_off in the source file to dst_off in the
+ * destination file.  Where the underlying OS supports it, the data is copied
+ * within the kernel (and possibly within the file system) without passing
+ * through an application buffer.
+ *
+ * The copy uses explicit offsets, so the current file position of neither
+ * handle is used or changed.  The destination file is extended as needed.
+ * The source and destination may be the same file, but the two ranges must
+ * not overlap.
+ *
+ * @param[in] src_fd    The handle ID of the file to copy from
+ * @param[in] src_off   Offset in the source file of the first byte to copy
+ * @param[in] dst_fd    The handle ID of the file to copy to
+ * @param[in] dst_off   Offset in the destination file at which to store the first byte
+ * @param[in] len       Number of bytes to copy.  A length of zero does nothing.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ARGUMENT if either offset or the length is negative
+ * @retval #OS_ERR_INVALID_ID if either file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the source file ended before len bytes were copied
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support copying a range of a file
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_offset_t src_off, osal_id_t dst_fd, osal_offset_t dst_off,
+                       osal_offset_t len);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Move a single file from src to dest
@@ -37,17 +37,75 @@ typedef struct
 {
     size_t            free_bytes;
     osal_blockcount_t free_blocks;
-    size_t            largest_free_block;
+    size_t            largest_free_block; /**< 0 if the underlying allocator does not report it */
 } OS_heap_prop_t;
 
 /** @defgroup OSAPIHeap OSAL Heap APIs
  * @{
  */
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Allocate a block of memory from the OSAL heap
+ *
+ * Small blocks are rounded up to a power of two size class, and freed blocks
+ * are kept in a per-task cache for reuse by subsequent allocations from the
+ * same task, avoiding contention on the system allocator.  Larger blocks are
+ * obtained directly from the system allocator.
+ *
+ * The size of the block is charged to the calling task until it is freed,
+ * see OS_HeapGetTaskUsage().  Blocks may be freed by any task.
+ *
+ * The returned memory is suitably aligned for any type, and is not initialized.
+ *
+ * @param[out] ptr  Set to the address of the allocated block @nonnull
+ * @param[in]  size Size of the block in bytes @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the ptr argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the size is zero or too large
+ * @retval #OS_ERROR if the memory could not be allocated
+ */
+int32 OS_HeapAlloc(void **ptr, size_t size);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Return a block of memory to the OSAL heap
+ *
+ * @param[in] ptr Address of a block previously returned by OS_HeapAlloc() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the ptr argument is NULL
+ */
+int32 OS_HeapFree(void *ptr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the number of bytes of the OSAL heap in use by a task
+ *
+ * Reports the total size of the blocks allocated by the task using
+ * OS_HeapAlloc() that have not yet been freed.  Memory obtained
+ * by other means is not included.
+ *
+ * @param[in]  task_id The task to report on
+ * @param[out] bytes   Set to the number of bytes in use @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the bytes argument is NULL
+ * @retval #OS_ERR_INVALID_ID if the ID does not refer to a task
+ */
+int32 OS_HeapGetTaskUsage(osal_id_t task_id, size_t *bytes);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Return current info on the heap
  *
+ * The free space includes blocks held for reuse in the OSAL task caches, in
+ * addition to that reported by the underlying system allocator.
+ *
  * @param[out] heap_prop Storage buffer for heap info
  *
  * @return Execution status, see @ref OSReturnCodes
@@ -27,6 +27,7 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
 
 /* Defines constants for making object ID's unique */
 #define OS_OBJECT_INDEX_MASK 0xFFFF /**< @brief Object index mask */
@@ -49,9 +50,32 @@
 #define OS_OBJECT_TYPE_OS_FILESYS  0x0B /**< @brief Object file system type */
 #define OS_OBJECT_TYPE_OS_CONSOLE  0x0C /**< @brief Object console type */
 #define OS_OBJECT_TYPE_OS_CONDVAR  0x0D /**< @brief Object condition variable type */
+#define OS_OBJECT_TYPE_OS_POLLER   0x0E /**< @brief Object poller type */
+#define OS_OBJECT_TYPE_OS_MEMPOOL  0x0F /**< @brief Object memory pool type */
 #define OS_OBJECT_TYPE_USER        0x10 /**< @brief Object user type */
 /**@}*/
 
+/**
+ * @brief Object table lock statistics
+ *
+ * Each object type has a table lock which is held while looking up,
+ * creating or deleting objects of that type.  A contended acquisition
+ * is one where another task held or was waiting for the lock at the
+ * time it was requested.  Time spent waiting for an object to change
+ * state (such as a pending create or delete) is not counted as holding
+ * the lock.
+ */
+typedef struct
+{
+    uint32    acquire_count;    /**< Number of times the lock was acquired */
+    uint32    contended_count;  /**< Number of acquisitions that had to wait for another task */
+    OS_time_t total_wait_time;  /**< Total time spent waiting to acquire the lock */
+    OS_time_t max_wait_time;    /**< Longest time spent waiting to acquire the lock */
+    OS_time_t total_hold_time;  /**< Total time the lock was held */
+    OS_time_t max_hold_time;    /**< Longest time the lock was held */
+    osal_id_t max_hold_task_id; /**< The task that held the lock for max_hold_time */
+} OS_lock_stats_t;
+
 /** @defgroup OSAPIObjUtil OSAL Object ID Utility APIs
  * @{
  */
@@ -273,6 +297,28 @@ void OS_ForEachObject(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void
 void OS_ForEachObjectOfType(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
                             void *callback_arg);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the table lock statistics of an object type
+ *
+ * Statistics are accumulated from the time OSAL is initialized, and include
+ * the lock acquired by this call to read them.  Locks held by tasks that were
+ * not created through OSAL, including the initial task, are attributed to a
+ * reserved ID in max_hold_task_id that does not match any task.
+ *
+ * @note Statistics are only collected if OSAL_CONFIG_LOCK_STATS is enabled
+ *
+ * @param[in]  idtype  The object type, see @ref OSObjectTypes
+ * @param[out] stats   Buffer to store the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the object type is not valid
+ * @retval #OS_INVALID_POINTER if pointer argument is NULL
+ * @retval #OS_ERR_NOT_IMPLEMENTED if statistics collection is not enabled
+ */
+int32 OS_ObjectTypeGetLockStats(osal_objtype_t idtype, OS_lock_stats_t *stats);
+
 /**@}*/
 
 #endif /* OSAPI_IDMAP_H */
@@ -0,0 +1,178 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ *
+ * Declarations and prototypes for memory pool objects
+ */
+
+#ifndef OSAPI_MEMPOOL_H
+#define OSAPI_MEMPOOL_H
+
+#include "osconfig.h"
+#include "common_types.h"
+
+/**
+ * @brief OSAL memory pool properties
+ *
+ * @sa OS_MemPoolGetInfo()
+ */
+typedef struct
+{
+    char              name[OS_MAX_API_NAME];
+    osal_id_t         creator;
+    size_t            block_size;      /**< Usable size of each block, as passed to OS_MemPoolCreate() */
+    osal_blockcount_t num_blocks;      /**< Total number of blocks in the pool */
+    osal_blockcount_t free_blocks;     /**< Number of blocks currently available */
+    osal_blockcount_t min_free_blocks; /**< Lowest number of blocks that have been available since creation */
+    uint32            failed_gets;     /**< Number of calls to OS_MemPoolGet() that did not obtain a block */
+} OS_mempool_prop_t;
+
+/** @defgroup OSAPIMemPool OSAL Memory Pool APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a fixed-block memory pool
+ *
+ * The memory for all of the blocks is allocated at the time the pool is
+ * created.  Blocks are then obtained with OS_MemPoolGet() and returned with
+ * OS_MemPoolPut(), both of which take a constant time regardless of the size
+ * of the pool and only hold a reference to the pool, not a lock.  This makes
+ * the pool suitable for allocations in time-critical code, where a
+ * general-purpose heap is not.
+ *
+ * Every block is aligned suitably for any type.
+ *
+ * @param[out]  pool_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   pool_name the name of the new resource to create @nonnull
+ * @param[in]   block_size the size of each block in bytes @nonzero
+ * @param[in]   num_blocks the number of blocks in the pool @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if pool_id or pool_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_INVALID_SIZE if block_size or num_blocks is zero or too large
+ * @retval #OS_ERR_NO_FREE_IDS if there are no more free memory pool Ids
+ * @retval #OS_ERR_NAME_TAKEN if there is already a memory pool with the same name
+ * @retval #OS_ERROR if the memory for the pool could not be allocated
+ */
+int32 OS_MemPoolCreate(osal_id_t *pool_id, const char *pool_name, size_t block_size, osal_blockcount_t num_blocks);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes the specified memory pool
+ *
+ * The memory for the blocks is released once any calls to OS_MemPoolGet()
+ * or OS_MemPoolPut() in progress have completed.  It is up to the application
+ * to ensure that none of the blocks are still in use.
+ *
+ * @param[in]   pool_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid memory pool
+ */
+int32 OS_MemPoolDelete(osal_id_t pool_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtains a block from a memory pool
+ *
+ * If no block is available, the calling task may optionally wait for one
+ * to be returned by another task.  The timeout is specified the same way as
+ * for OS_QueueGet():
+ *
+ *  - #OS_CHECK (0) to return immediately if no block is available
+ *  - #OS_PEND (-1) to wait indefinitely
+ *  - A positive number of milliseconds to wait
+ *
+ * @note Waiting for a block is not supported on all platforms.  Where it is
+ * not, #OS_ERR_NOT_IMPLEMENTED is returned if a wait would be needed.
+ *
+ * @param[in]   pool_id The object ID to operate on
+ * @param[out]  block Set to the address of the block @nonnull
+ * @param[in]   timeout The maximum time to wait for a block, in milliseconds
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if block is NULL
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid memory pool
+ * @retval #OS_ERROR_TIMEOUT if no block became available within the timeout
+ * @retval #OS_ERR_NOT_IMPLEMENTED if a wait is needed but is not supported on this platform
+ */
+int32 OS_MemPoolGet(osal_id_t pool_id, void **block, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Returns a block to a memory pool
+ *
+ * On success, ownership of the block passes back to the pool and the caller
+ * must not access it any further.  The block may be returned by any task,
+ * not only the one which obtained it.
+ *
+ * @param[in]   pool_id The object ID to operate on
+ * @param[in]   block A block previously obtained from the same pool with OS_MemPoolGet() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if block is NULL
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid memory pool
+ * @retval #OS_ERR_INVALID_ARGUMENT if the block does not belong to the pool
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the block has already been returned
+ */
+int32 OS_MemPoolPut(osal_id_t pool_id, void *block);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing memory pool ID by name
+ *
+ * @param[out]  pool_id will be set to the ID of the existing resource
+ * @param[in]   pool_name the name of the existing resource to find @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the name or id pointers are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND the name was not found in the table
+ */
+int32 OS_MemPoolGetIdByName(osal_id_t *pool_id, const char *pool_name);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Fill a property object buffer with details regarding the resource
+ *
+ * In addition to the name and creator, this reports the configuration of
+ * the pool and usage statistics.  As blocks may be obtained and returned
+ * concurrently, the statistics are a snapshot and may be slightly out of
+ * date by the time they are read.
+ *
+ * @param[in]   pool_id The object ID to operate on
+ * @param[out]  pool_prop The property object buffer to fill @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if pool_prop is NULL
+ * @retval #OS_ERR_INVALID_ID if the ID given is not a valid memory pool
+ */
+int32 OS_MemPoolGetInfo(osal_id_t pool_id, OS_mempool_prop_t *pool_prop);
+/**@}*/
+
+#endif /* OSAPI_MEMPOOL_H */
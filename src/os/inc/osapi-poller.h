@@ -0,0 +1,189 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Declarations and prototypes for poller objects
+ */
+
+#ifndef OSAPI_POLLER_H
+#define OSAPI_POLLER_H
+
+#include "osconfig.h"
+#include "common_types.h"
+
+#include "osapi-clock.h"  /* required for OS_time_t definition */
+#include "osapi-select.h" /* required for OS_STREAM_STATE flags */
+
+/**
+ * @brief An event reported by a poller
+ *
+ * Identifies a file handle which was found to be ready, along with the
+ * state(s) that were detected (OS_STREAM_STATE_READABLE and/or OS_STREAM_STATE_WRITABLE)
+ */
+typedef struct
+{
+    osal_id_t objid;
+    uint32    StateFlags;
+} OS_poller_event_t;
+
+/** @defgroup OSAPIPoller OSAL Poller APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a poller resource
+ *
+ * A poller holds a persistent set of file handles, along with the state(s) of
+ * interest for each.  Unlike OS_SelectMultiple(), the set does not need to be
+ * supplied again on every call, and a wait only returns the handles that are
+ * actually ready.  The cost of each wait is therefore proportional to the number
+ * of ready handles rather than the total number of handles in the set.
+ *
+ * File handles are added to the poller using OS_PollerAdd() and the poller is
+ * then waited on using OS_PollerWait() or OS_PollerWaitAbs().
+ *
+ * @param[out]  poller_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   poller_name the name of the new resource to create @nonnull
+ * @param[in]   options reserved for future use.  Should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if poller_id or poller_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are no more free poller Ids
+ * @retval #OS_ERR_NAME_TAKEN if there is already a poller with the same name
+ * @retval #OS_ERR_NOT_IMPLEMENTED if pollers are not supported on this platform
+ */
+int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes the specified poller
+ *
+ * The file handles in the set are not affected.
+ *
+ * @param[in] poller_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poller
+ */
+int32 OS_PollerDelete(osal_id_t poller_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a file handle to a poller, or changes the states of interest
+ *
+ * After this call, the poller will report the file handle whenever it is in
+ * any of the states given by StateFlags (OS_STREAM_STATE_READABLE and/or
+ * OS_STREAM_STATE_WRITABLE).  If the file handle is already in the set, the
+ * states of interest are replaced with the new value.
+ *
+ * A file handle which is closed is automatically removed from the set.
+ *
+ * @param[in] poller_id The poller ID to operate on
+ * @param[in] objid The file handle ID to add
+ * @param[in] StateFlags The state(s) to wait for
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the poller_id or objid is not valid
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the file handle does not support select/poll
+ */
+int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a file handle from a poller
+ *
+ * @param[in] poller_id The poller ID to operate on
+ * @param[in] objid The file handle ID to remove
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the poller_id or objid is not valid
+ * @retval #OS_ERROR if the file handle was not in the set
+ */
+int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for any file handle in a poller to become ready
+ *
+ * Blocks until at least one file handle in the set is in one of its states
+ * of interest, or the timeout has elapsed.  Up to max_events ready handles are
+ * written to the events array, and the number written is output via num_events.
+ *
+ * This API is identical to OS_PollerWait() except for the timeout parameter.  In
+ * this call, timeout is expressed as an absolute value of the OS clock, in the same
+ * time domain as obtained via OS_GetLocalTime().
+ *
+ * @param[in]  poller_id The poller ID to wait on
+ * @param[out] events Buffer to store the ready handles @nonnull
+ * @param[in]  max_events The number of entries in the events buffer @nonzero
+ * @param[out] num_events Set to the number of entries written to the events buffer @nonnull
+ * @param[in]  abs_timeout The absolute time that the call may block until
+ *
+ * @sa OS_PollerWait()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS If at least one handle is ready
+ * @retval #OS_ERROR_TIMEOUT If no handle became ready within the timeout
+ * @retval #OS_INVALID_POINTER if events or num_events is NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_events is zero
+ * @retval #OS_ERR_INVALID_ID if the poller_id is not valid
+ */
+int32 OS_PollerWaitAbs(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                       OS_time_t abs_timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for any file handle in a poller to become ready
+ *
+ * Blocks until at least one file handle in the set is in one of its states
+ * of interest, or the timeout has elapsed.  Up to max_events ready handles are
+ * written to the events array, and the number written is output via num_events.
+ *
+ * The timeout is expressed in milliseconds, relative to the time that the API was
+ * invoked.  Use OS_PollerWaitAbs() for higher timing precision.
+ *
+ * @param[in]  poller_id The poller ID to wait on
+ * @param[out] events Buffer to store the ready handles @nonnull
+ * @param[in]  max_events The number of entries in the events buffer @nonzero
+ * @param[out] num_events Set to the number of entries written to the events buffer @nonnull
+ * @param[in]  msecs Indicates the timeout. Positive values will wait up to that many milliseconds. Zero will not wait
+ * (poll). Negative values will wait forever (pend)
+ *
+ * @sa OS_PollerWaitAbs()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS If at least one handle is ready
+ * @retval #OS_ERROR_TIMEOUT If no handle became ready within the timeout
+ * @retval #OS_INVALID_POINTER if events or num_events is NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_events is zero
+ * @retval #OS_ERR_INVALID_ID if the poller_id is not valid
+ */
+int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                    int32 msecs);
+
+/**@}*/
+
+#endif /* OSAPI_POLLER_H */
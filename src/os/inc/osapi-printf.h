@@ -28,6 +28,14 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/** @defgroup OSPrintfModes OSAL printf output modes
+ * @{
+ */
+#define OS_PRINTF_MODE_IMMEDIATE 0 /**< @brief Messages are formatted by the calling task (default) */
+#define OS_PRINTF_MODE_DEFERRED  1 /**< @brief Arguments are recorded, messages are formatted on output */
+#define OS_PRINTF_MODE_BINARY    2 /**< @brief Arguments are recorded, binary records are output for offline decoding */
+/**@}*/
+
 /** @defgroup OSAPIPrintf OSAL Printf APIs
  * @{
  */
@@ -66,6 +74,41 @@ void OS_printf_disable(void);
  *
  */
 void OS_printf_enable(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Selects how OS_printf() messages are formatted
+ *
+ * In #OS_PRINTF_MODE_IMMEDIATE mode each message is fully formatted by the
+ * task calling OS_printf(), and the resulting text is buffered for output.
+ *
+ * In #OS_PRINTF_MODE_DEFERRED mode the calling task only records a pointer to
+ * the format string, a timestamp and the raw arguments.  Any strings passed
+ * as arguments are copied.  The message is formatted when it is output, which
+ * is normally done by the console utility task, keeping the formatting cost
+ * off of the calling task.
+ *
+ * #OS_PRINTF_MODE_BINARY mode records messages the same way, but instead of
+ * formatting them the console outputs binary records, which include the
+ * timestamp and the text of the format string.  These may be captured and
+ * decoded offline.  The records are written to the binary output of the BSP,
+ * which is separate from the console where the BSP supports it.  On the
+ * generic-linux BSP, this is the file named by the OSAL_PRINTF_BINARY_LOG
+ * environment variable.  Otherwise the records are mixed with any text
+ * written to the console directly, such as debug messages.
+ *
+ * @note In the deferred and binary modes, the format string passed to OS_printf()
+ * must remain valid until the message is output, which is always the case for
+ * string literals.  Messages using conversions that cannot be deferred (such as
+ * %%n or long double values) are formatted immediately in any mode.
+ *
+ * @param[in] mode One of the @ref OSPrintfModes values
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ARGUMENT if the mode is not valid
+ */
+int32 OS_printf_SetMode(uint32 mode);
 /**@}*/
 
 #endif /* OSAPI_PRINTF_H */
@@ -28,6 +28,32 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/**
+ * @brief Requests OS_QueueCreate() to use the operating system message queue
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that the queue should be implemented using the native message queue facility
+ * of the operating system, regardless of the OSAL_CONFIG_QUEUE_USERSPACE setting.
+ *
+ * This is the only type of queue on implementations that do not provide a
+ * user-space queue, and the flag has no effect on those implementations.
+ */
+#define OS_QUEUE_FLAG_SYSTEM 0x01
+
+/**
+ * @brief Requests OS_QueueCreate() to use an in-process user-space queue
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that the queue should be implemented in user space as a ring of fixed-size
+ * message slots, regardless of the OSAL_CONFIG_QUEUE_USERSPACE setting.
+ * Putting and getting messages does not involve the kernel unless a task
+ * needs to block.  Such a queue is only usable within the current process.
+ *
+ * Implementations that do not provide a user-space queue ignore this flag
+ * and use the operating system message queue.
+ */
+#define OS_QUEUE_FLAG_USERSPACE 0x02
+
 /** @brief OSAL queue properties */
 typedef struct
 {
@@ -52,7 +78,7 @@ typedef struct
  * @param[in]   queue_name the name of the new resource to create @nonnull
  * @param[in]   queue_depth the maximum depth of the queue
  * @param[in]   data_size the size of each entry in the queue @nonzero
- * @param[in]   flags options for the queue (reserved for future use, pass as 0)
+ * @param[in]   flags options for the queue, a bitwise OR of OS_QUEUE_FLAG_* values, or 0 for defaults
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -77,11 +103,16 @@ int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcoun
  * @note If There are messages on the queue, they will be lost and any subsequent
  * calls to QueueGet or QueuePut to this queue will result in errors
  *
+ * @note Tasks blocked getting a message from the queue are woken, and return
+ * #OS_ERR_INVALID_ID.  Where the underlying OS cannot wake them (queues that are
+ * not user-space queues), the queue cannot be deleted while a task is blocked on it.
+ *
  * @param[in] queue_id The object ID to delete
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
  * @retval #OS_ERR_INVALID_ID if the id passed in does not exist
+ * @retval #OS_ERR_OBJECT_IN_USE if another task is still using the queue
  * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
  */
 int32 OS_QueueDelete(osal_id_t queue_id);
@@ -129,6 +160,209 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
  */
 int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a batch of messages on a message queue
+ *
+ * This is equivalent to calling OS_QueuePut() for each message in turn, but
+ * with less overhead per message, as the queue is only looked up once and
+ * the implementation may put all of the messages in a single operation.
+ *
+ * The messages are stored consecutively in the data buffer, each one
+ * occupying "stride" bytes, of which the first sizes[i] bytes are the
+ * message content.  Messages are put in order until all have been put or
+ * the queue becomes full.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer containing the messages to put @nonnull
+ * @param[in]  stride The distance in bytes between the start of consecutive messages @nonzero
+ * @param[in]  sizes The size of each message, count entries @nonnull
+ * @param[in]  count The number of messages to put @nonzero
+ * @param[out] count_put Set to the number of messages that were put @nonnull
+ * @param[in]  flags Currently reserved/unused, should be passed as 0
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if all of the messages were put
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the stride or count is 0
+ * @retval #OS_QUEUE_INVALID_SIZE if any message is empty or too large, in which case none are put
+ * @retval #OS_QUEUE_FULL if the queue cannot accept all of the messages
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *data, size_t stride, const size_t *sizes, uint32 count,
+                       uint32 *count_put, uint32 flags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive a batch of messages from a message queue
+ *
+ * If no message is pending, the calling task will block until a message arrives
+ * or the timeout expires, as with OS_QueueGet().  Once at least one message is
+ * available, all pending messages up to the given count are returned without
+ * blocking any further.
+ *
+ * The messages are stored consecutively in the data buffer, each one
+ * occupying "stride" bytes, which must be at least the maximum message
+ * size of the queue.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data The buffer to store the received messages, count * stride bytes @nonnull
+ * @param[in]   stride The distance in bytes between the start of consecutive messages @nonzero
+ * @param[out]  sizes Set to the actual size of each message received, count entries @nonnull
+ * @param[in]   count The maximum number of messages to receive @nonzero
+ * @param[out]  count_copied Set to the number of messages received @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one message was received
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the stride or count is 0
+ * @retval #OS_QUEUE_INVALID_SIZE if the stride is smaller than the maximum message size
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t stride, size_t *sizes, uint32 count,
+                       uint32 *count_copied, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reserve a message buffer for a subsequent OS_QueueCommit()
+ *
+ * This is the first half of a zero-copy alternative to OS_QueuePut().  The
+ * caller obtains a pointer to a buffer of the maximum message size of the
+ * queue, fills in the message directly, and then calls OS_QueueCommit() to
+ * make the message available to getters.
+ *
+ * Where the implementation supports it (e.g. user-space queues on POSIX) the
+ * buffer is the queue storage itself, and the message is never copied.  On
+ * other queues the buffer is a temporary copy, and the message is copied into
+ * the queue at the time it is committed.
+ *
+ * The buffer is owned by the caller until it is passed to OS_QueueCommit()
+ * or OS_QueueCancel(), one of which must be called exactly once for every
+ * successful reservation.  Where
+ * the buffer is the queue storage, the space for the message is claimed at
+ * the time of the reservation, and messages are received in the order they
+ * were reserved rather than the order they were committed.
+ *
+ * @note All reserved buffers must be committed or cancelled before the queue is deleted.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data Set to the address of the reserved buffer @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_QUEUE_FULL if the queue cannot accept another message
+ * @retval #OS_ERROR if a temporary buffer could not be allocated
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **data);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a message previously reserved with OS_QueueReserve() on the queue
+ *
+ * On success, ownership of the buffer passes back to the queue and the caller
+ * must not access it any further.
+ *
+ * If the arguments are invalid, the call has no effect and a reserved buffer
+ * remains owned by the caller.  If the message cannot be put on the queue
+ * (which is only possible where the buffer is a temporary copy) the buffer
+ * is released and the message is discarded.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer obtained from OS_QueueReserve() @nonnull
+ * @param[in]  size The size of the message in the buffer @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+ * @retval #OS_ERR_INVALID_ARGUMENT if the buffer does not belong to the queue, or is a
+ *         temporary copy that was already committed or cancelled
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the buffer is not currently reserved
+ * @retval #OS_QUEUE_FULL if the queue cannot accept another message (copy only)
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *data, size_t size);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Cancel a reservation made with OS_QueueReserve() without putting a message
+ *
+ * On success, ownership of the buffer passes back to the queue and the caller
+ * must not access it any further.  Where the buffer is the queue storage, the
+ * space claimed for the message is skipped by getters and then reused.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer obtained from OS_QueueReserve() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the buffer does not belong to the queue, or is a
+ *         temporary copy that was already committed or cancelled
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the buffer is not currently reserved
+ */
+int32 OS_QueueCancel(osal_id_t queue_id, void *data);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Borrow the next message on a message queue without copying it
+ *
+ * This is a zero-copy alternative to OS_QueueGet().  Instead of copying the
+ * message into a caller-supplied buffer, a pointer to the buffer holding the
+ * message is returned.  Blocking behavior is the same as OS_QueueGet().
+ *
+ * Where the implementation supports it the buffer is the queue storage itself,
+ * otherwise it is a temporary copy.  In either case the buffer is owned by the
+ * caller until it is passed to OS_QueueReturn(), which must be done exactly
+ * once for every successfully borrowed message.  While borrowed, the storage
+ * for the message is not available for new messages.
+ *
+ * @note All borrowed buffers must be returned before the queue is deleted.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data Set to the address of the message buffer @nonnull
+ * @param[out]  size Set to the actual size of the message @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **data, size_t *size, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Return a message buffer previously obtained with OS_QueueBorrow()
+ *
+ * On success, ownership of the buffer passes back to the queue and the caller
+ * must not access it any further.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer obtained from OS_QueueBorrow() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the buffer does not belong to the queue, or is a
+ *         temporary copy that was already returned
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the buffer is not currently borrowed
+ */
+int32 OS_QueueReturn(osal_id_t queue_id, const void *data);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Find an existing queue ID by name
@@ -29,6 +29,7 @@
 #include "osconfig.h"
 #include "common_types.h"
 #include "osapi-clock.h"
+#include "osapi-file.h"
 
 /*
  * The absolute maximum size of a network address
@@ -113,6 +114,25 @@ typedef struct
     OS_SockAddrData_t AddrData;     /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief Describes a single datagram in a batched send or receive request
+ *
+ * For receive, Buffer and BufLen describe the storage for the datagram, and
+ * the actual datagram size and sender address are returned in MsgLen and Addr.
+ *
+ * For send, Buffer and BufLen describe the datagram to send and Addr holds the
+ * destination address.  The actual number of bytes sent is returned in MsgLen.
+ *
+ * @sa OS_SocketRecvFromMulti(), OS_SocketSendToMulti()
+ */
+typedef struct
+{
+    void *        Buffer; /**< @brief Datagram data buffer */
+    size_t        BufLen; /**< @brief Size of the datagram data buffer */
+    size_t        MsgLen; /**< @brief Actual length of the datagram sent or received */
+    OS_SockAddr_t Addr;   /**< @brief Remote network address */
+} OS_SockMsg_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -547,6 +567,103 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
  */
 int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads multiple datagrams from a message-oriented (datagram) socket
+ *
+ * Batched version of OS_SocketRecvFromAbs().  This waits up to the given timeout
+ * for the first datagram to become available, then collects any further datagrams
+ * which are already queued on the socket without blocking, up to the count given.
+ *
+ * On systems which support it, the datagrams are received with as few calls into
+ * the kernel as possible.
+ *
+ * @param[in]     sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] msgs         Array of message descriptors @nonnull
+ * @param[in]     count        The number of entries in the msgs array @nonzero
+ * @param[in]     abs_timeout  The absolute time at which the call should return if nothing received
+ *
+ * @return Count of datagrams received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in count or any buffer length is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the socket is not bound
+ * @retval #OS_ERROR_TIMEOUT if no datagram was received before the timeout
+ */
+int32 OS_SocketRecvFromMultiAbs(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, OS_time_t abs_timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads multiple datagrams from a message-oriented (datagram) socket
+ *
+ * Batched version of OS_SocketRecvFrom().  This waits up to the given timeout
+ * for the first datagram to become available, then collects any further datagrams
+ * which are already queued on the socket without blocking, up to the count given.
+ *
+ * The timeout is expressed in milliseconds, relative to the time that the API was
+ * invoked.  Use OS_SocketRecvFromMultiAbs() for higher timing precision.
+ *
+ * @param[in]     sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] msgs         Array of message descriptors @nonnull
+ * @param[in]     count        The number of entries in the msgs array @nonzero
+ * @param[in]     timeout      The maximum amount of time to wait or OS_PEND to wait forever
+ *
+ * @sa OS_SocketRecvFromMultiAbs()
+ *
+ * @return Count of datagrams received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in count or any buffer length is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the socket is not bound
+ * @retval #OS_ERROR_TIMEOUT if no datagram was received before the timeout
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends multiple datagrams to a message-oriented (datagram) socket
+ *
+ * Batched version of OS_SocketSendTo().  Each datagram is sent to the address
+ * stored in its descriptor, in array order.  As with OS_SocketSendTo(), this does
+ * not block; if the socket stops accepting data partway through the batch then
+ * the number of datagrams actually sent is returned.
+ *
+ * @param[in]     sock_id      The socket ID, which must be of the datagram type
+ * @param[in,out] msgs         Array of message descriptors @nonnull
+ * @param[in]     count        The number of entries in the msgs array @nonzero
+ *
+ * @return Count of datagrams sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in count or any buffer length is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ * @retval #OS_ERR_BAD_ADDRESS if any of the remote addresses is not valid
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends a datagram assembled from multiple buffers to a message-oriented (datagram) socket
+ *
+ * Gather version of OS_SocketSendTo().  The segments are concatenated, in order,
+ * into a single datagram.  This allows a header and payload held in separate
+ * buffers to be sent without first copying them together.
+ *
+ * @param[in]   sock_id      The socket ID, which must be of the datagram type
+ * @param[in]   iov          Array of segments describing the message data to send @nonnull
+ * @param[in]   iovcnt       Number of entries in the iov array @nonzero, at most #OS_IOV_MAX
+ * @param[in]   RemoteAddr   Buffer containing the remote network address to send to
+ *
+ * @return Count of actual bytes sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in segment count is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ */
+int32 OS_SocketSendV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
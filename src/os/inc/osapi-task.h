@@ -60,6 +60,7 @@ typedef struct
     osal_id_t       creator;
     size_t          stack_size;
     osal_priority_t priority;
+    size_t          stack_high_water; /**< Peak stack usage in bytes, or 0 if not tracked by the implementation */
 } OS_task_prop_t;
 
 /*
@@ -216,6 +217,10 @@ int32 OS_TaskGetIdByName(osal_id_t *task_id, const char *task_name);
  * all of the relevant info (creator, stack size, priority, name) about the
  * specified task.
  *
+ * On implementations which track it, the peak stack usage of the task is
+ * also reported.  On POSIX this is only available for tasks whose stack was
+ * allocated by OSAL from the task stack pool.
+ *
  * @param[in]   task_id The object ID to operate on
  * @param[out]  task_prop The property object buffer to fill @nonnull
  *
@@ -43,6 +43,36 @@ typedef struct
     uint32    accuracy;
 } OS_timebase_prop_t;
 
+/**
+ * @brief Number of bins in the latency and execution time histograms
+ *
+ * Bin 0 counts values of 0 microseconds, and bin N counts values in the
+ * range [2^(N-1), 2^N) microseconds.  The final bin also counts all values
+ * that are larger than its range.
+ */
+#define OS_TIMER_STATS_HISTOGRAM_BINS 20
+
+/**
+ * @brief Time base or timer statistics
+ *
+ * All times are in microseconds.  For a time base, each event is a tick
+ * and the latency is the delay of the tick beyond what was reported by
+ * the sync function.  For a timer, each event is a callback and the
+ * latency is the time from the nominal expiry to the start of the callback.
+ */
+typedef struct
+{
+    uint32 event_count;   /**< Number of ticks or callbacks recorded */
+    uint32 overrun_count; /**< Number of events which were late by one or more intervals */
+    uint32 latency_min;   /**< Minimum latency */
+    uint32 latency_max;   /**< Maximum latency */
+    uint32 latency_mean;  /**< Mean latency */
+    uint32 exec_time_max; /**< Maximum execution time */
+
+    uint32 latency_histogram[OS_TIMER_STATS_HISTOGRAM_BINS];   /**< log2 histogram of latency */
+    uint32 exec_time_histogram[OS_TIMER_STATS_HISTOGRAM_BINS]; /**< log2 histogram of execution time */
+} OS_timer_stats_t;
+
 /** @defgroup OSAPITimebase OSAL Time Base APIs
  * @{
  */
@@ -214,6 +244,33 @@ int32 OS_TimeBaseGetInfo(osal_id_t timebase_id, OS_timebase_prop_t *timebase_pro
  */
 int32 OS_TimeBaseGetFreeRun(osal_id_t timebase_id, uint32 *freerun_val);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the tick latency statistics of a time base
+ *
+ * Statistics are accumulated by the time base servicing task from the
+ * time the time base is created.  The latency of each tick is the delay
+ * beyond the time reported by the sync function, relative to the previous
+ * tick, and the execution time is the time spent processing the timer
+ * callbacks for that tick.  An overrun is counted when the time between
+ * consecutive ticks is at least twice the nominal interval.
+ *
+ * @note Statistics are only collected if OSAL_CONFIG_TIMER_STATS is enabled
+ *
+ * @note This configuration API must not be used from the context of a timer callback.
+ *
+ * @param[in]   timebase_id The timebase to operate on
+ * @param[out]  stats       Buffer to store the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid timebase
+ * @retval #OS_INVALID_POINTER if pointer argument is NULL
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if called from timer/timebase context
+ * @retval #OS_ERR_NOT_IMPLEMENTED if statistics collection is not enabled
+ */
+int32 OS_TimeBaseGetStats(osal_id_t timebase_id, OS_timer_stats_t *stats);
+
 /**@}*/
 
 #endif /* OSAPI_TIMEBASE_H */
@@ -27,6 +27,7 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-timebase.h"
 
 /*
 ** Typedefs
@@ -236,6 +237,32 @@ int32 OS_TimerGetIdByName(osal_id_t *timer_id, const char *timer_name);
  * @retval #OS_ERR_INCORRECT_OBJ_STATE if called from timer/timebase context
  */
 int32 OS_TimerGetInfo(osal_id_t timer_id, OS_timer_prop_t *timer_prop);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the callback latency statistics of a timer
+ *
+ * Statistics are accumulated by the time base servicing task from the
+ * time the timer is created.  The latency of each callback is the time
+ * from the nominal expiry of the timer to the start of the callback, and
+ * the execution time is the time spent in the callback.  An overrun is
+ * counted when a callback is late by one or more timer intervals.
+ *
+ * @note Statistics are only collected if OSAL_CONFIG_TIMER_STATS is enabled
+ *
+ * @note This configuration API must not be used from the context of a timer callback.
+ *
+ * @param[in]  timer_id      The timer ID to operate on
+ * @param[out] stats         Buffer to store the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid timer
+ * @retval #OS_INVALID_POINTER if the stats pointer is null
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if called from timer/timebase context
+ * @retval #OS_ERR_NOT_IMPLEMENTED if statistics collection is not enabled
+ */
+int32 OS_TimerGetStats(osal_id_t timer_id, OS_timer_stats_t *stats);
 /**@}*/
 
 #endif /* OSAPI_TIMER_H */
@@ -74,9 +74,11 @@ extern "C"
 #include "osapi-heap.h"
 #include "osapi-macros.h"
 #include "osapi-idmap.h"
+#include "osapi-mempool.h"
 #include "osapi-module.h"
 #include "osapi-mutex.h"
 #include "osapi-network.h"
+#include "osapi-poller.h"
 #include "osapi-printf.h"
 #include "osapi-queue.h"
 #include "osapi-select.h"
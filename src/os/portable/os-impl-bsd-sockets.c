@@ -43,6 +43,7 @@
  *  connect()
  *  recvfrom()
  *  sendto()
+ *  sendmsg()
  *  inet_pton()
  *  ntohl()/ntohs()
  *
@@ -78,6 +79,14 @@
 #define OS_IMPL_SET_SOCKET_FLAGS(tok) OS_SetSocketDefaultFlags_Impl(tok)
 #endif
 
+/*
+ * The maximum number of datagrams passed to the OS in a single batched send/receive.
+ * Larger requests are broken into multiple batches of this size.
+ */
+#ifndef OS_IMPL_SOCKET_MSG_BATCH
+#define OS_IMPL_SOCKET_MSG_BATCH 16
+#endif
+
 typedef union
 {
     char               data[OS_SOCKADDR_MAX_LEN];
@@ -472,34 +481,48 @@ int32 OS_SocketAccept_Impl(const OS_object_token_t *sock_token, const OS_object_
 
 /*----------------------------------------------------------------
  *
- *  Purpose: Implemented per internal OSAL API
- *           See prototype for argument/return detail
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the OS address length that corresponds to the address family
+ *           stored in the abstract address, or zero if the family is not known.
  *
  *-----------------------------------------------------------------*/
-int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr,
-                             OS_time_t abs_timeout)
+static socklen_t OS_SocketAddrLength_Impl(const OS_SockAddr_t *Addr)
+{
+    socklen_t addrlen;
+
+    switch (((const struct sockaddr *)&Addr->AddrData)->sa_family)
+    {
+        case AF_INET:
+            addrlen = sizeof(struct sockaddr_in);
+            break;
+#ifdef OS_NETWORK_SUPPORTS_IPV6
+        case AF_INET6:
+            addrlen = sizeof(struct sockaddr_in6);
+            break;
+#endif
+        default:
+            addrlen = 0;
+            break;
+    }
+
+    return addrlen;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits until the socket is readable or the timeout expires, and
+ *           determines the flags that the subsequent receive call should use.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_SocketWaitReadable_Impl(const OS_object_token_t *token, OS_time_t abs_timeout, int *waitflags)
 {
     int32                           return_code;
-    int                             os_result;
-    int                             waitflags;
     uint32                          operation;
-    struct sockaddr *               sa;
-    socklen_t                       addrlen;
     OS_impl_file_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
 
-    if (RemoteAddr == NULL)
-    {
-        sa      = NULL;
-        addrlen = 0;
-    }
-    else
-    {
-        addrlen = OS_SOCKADDR_MAX_LEN;
-        sa      = (struct sockaddr *)&RemoteAddr->AddrData;
-    }
-
     operation = OS_STREAM_STATE_READABLE;
     /*
      * If "O_NONBLOCK" flag is set then use select()
@@ -507,7 +530,7 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
      */
     if (impl->selectable)
     {
-        waitflags   = MSG_DONTWAIT;
+        *waitflags  = MSG_DONTWAIT;
         return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
     }
     else
@@ -515,45 +538,246 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
         /* This is a backup option - check if the abs timeout would be a poll/check op */
         if (OS_TimeToRelativeMilliseconds(abs_timeout) == OS_CHECK)
         {
-            waitflags = MSG_DONTWAIT;
+            *waitflags = MSG_DONTWAIT;
         }
         else
         {
             /* note timeout will not be honored if >0 */
-            waitflags = 0;
+            *waitflags = 0;
         }
         return_code = OS_SUCCESS;
     }
 
-    if (return_code == OS_SUCCESS)
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_READABLE) == 0)
     {
-        if ((operation & OS_STREAM_STATE_READABLE) == 0)
+        return_code = OS_ERROR_TIMEOUT;
+    }
+
+    return return_code;
+}
+
+#ifdef OS_IMPL_SOCKET_HAVE_MMSG
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Receives up to one batch of datagrams using a single recvmmsg() call.
+ *           Returns the number of datagrams received, or -1 with errno set.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_SocketRecvBatch_Impl(int fd, OS_SockMsg_t *msgs, uint32 count, int waitflags)
+{
+    struct mmsghdr mmsg[OS_IMPL_SOCKET_MSG_BATCH];
+    struct iovec   iov[OS_IMPL_SOCKET_MSG_BATCH];
+    int            os_result;
+    uint32         i;
+
+    if (count > OS_IMPL_SOCKET_MSG_BATCH)
+    {
+        count = OS_IMPL_SOCKET_MSG_BATCH;
+    }
+
+    memset(mmsg, 0, sizeof(mmsg[0]) * count);
+    for (i = 0; i < count; ++i)
+    {
+        iov[i].iov_base             = msgs[i].Buffer;
+        iov[i].iov_len              = msgs[i].BufLen;
+        mmsg[i].msg_hdr.msg_iov     = &iov[i];
+        mmsg[i].msg_hdr.msg_iovlen  = 1;
+        mmsg[i].msg_hdr.msg_name    = &msgs[i].Addr.AddrData;
+        mmsg[i].msg_hdr.msg_namelen = OS_SOCKADDR_MAX_LEN;
+    }
+
+    /* MSG_WAITFORONE: a blocking call returns as soon as the first datagram arrives */
+    os_result = recvmmsg(fd, mmsg, count, waitflags | MSG_WAITFORONE, NULL);
+
+    for (i = 0; os_result > 0 && i < (uint32)os_result; ++i)
+    {
+        msgs[i].MsgLen            = mmsg[i].msg_len;
+        msgs[i].Addr.ActualLength = mmsg[i].msg_hdr.msg_namelen;
+    }
+
+    return os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sends up to one batch of datagrams using a single sendmmsg() call.
+ *           Returns the number of datagrams sent, or -1 with errno set.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_SocketSendBatch_Impl(int fd, OS_SockMsg_t *msgs, uint32 count)
+{
+    struct mmsghdr mmsg[OS_IMPL_SOCKET_MSG_BATCH];
+    struct iovec   iov[OS_IMPL_SOCKET_MSG_BATCH];
+    int            os_result;
+    uint32         i;
+
+    if (count > OS_IMPL_SOCKET_MSG_BATCH)
+    {
+        count = OS_IMPL_SOCKET_MSG_BATCH;
+    }
+
+    memset(mmsg, 0, sizeof(mmsg[0]) * count);
+    for (i = 0; i < count; ++i)
+    {
+        iov[i].iov_base             = msgs[i].Buffer;
+        iov[i].iov_len              = msgs[i].BufLen;
+        mmsg[i].msg_hdr.msg_iov     = &iov[i];
+        mmsg[i].msg_hdr.msg_iovlen  = 1;
+        mmsg[i].msg_hdr.msg_name    = &msgs[i].Addr.AddrData;
+        mmsg[i].msg_hdr.msg_namelen = msgs[i].Addr.ActualLength;
+    }
+
+    os_result = sendmmsg(fd, mmsg, count, MSG_DONTWAIT);
+
+    for (i = 0; os_result > 0 && i < (uint32)os_result; ++i)
+    {
+        msgs[i].MsgLen = mmsg[i].msg_len;
+    }
+
+    return os_result;
+}
+
+#else
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Receives up to one batch of datagrams, one recvfrom() call per datagram.
+ *           Returns the number of datagrams received, or -1 with errno set.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_SocketRecvBatch_Impl(int fd, OS_SockMsg_t *msgs, uint32 count, int waitflags)
+{
+    int       os_result;
+    uint32    i;
+    socklen_t addrlen;
+
+    if (count > OS_IMPL_SOCKET_MSG_BATCH)
+    {
+        count = OS_IMPL_SOCKET_MSG_BATCH;
+    }
+
+    os_result = -1;
+    for (i = 0; i < count; ++i)
+    {
+        addrlen   = OS_SOCKADDR_MAX_LEN;
+        os_result = recvfrom(fd, msgs[i].Buffer, msgs[i].BufLen, waitflags, (struct sockaddr *)&msgs[i].Addr.AddrData,
+                             &addrlen);
+        if (os_result < 0)
         {
-            return_code = OS_ERROR_TIMEOUT;
+            break;
         }
-        else
+
+        msgs[i].MsgLen            = os_result;
+        msgs[i].Addr.ActualLength = addrlen;
+
+        /* only the first datagram may block */
+        waitflags = MSG_DONTWAIT;
+    }
+
+    if (i == 0)
+    {
+        return os_result;
+    }
+
+    return i;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sends up to one batch of datagrams, one sendto() call per datagram.
+ *           Returns the number of datagrams sent, or -1 with errno set.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_SocketSendBatch_Impl(int fd, OS_SockMsg_t *msgs, uint32 count)
+{
+    int    os_result;
+    uint32 i;
+
+    if (count > OS_IMPL_SOCKET_MSG_BATCH)
+    {
+        count = OS_IMPL_SOCKET_MSG_BATCH;
+    }
+
+    os_result = -1;
+    for (i = 0; i < count; ++i)
+    {
+        os_result = sendto(fd, msgs[i].Buffer, msgs[i].BufLen, MSG_DONTWAIT,
+                           (const struct sockaddr *)&msgs[i].Addr.AddrData, msgs[i].Addr.ActualLength);
+        if (os_result < 0)
         {
-            os_result = recvfrom(impl->fd, buffer, buflen, waitflags, sa, &addrlen);
-            if (os_result < 0)
+            break;
+        }
+
+        msgs[i].MsgLen = os_result;
+    }
+
+    if (i == 0)
+    {
+        return os_result;
+    }
+
+    return i;
+}
+
+#endif /* OS_IMPL_SOCKET_HAVE_MMSG */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr,
+                             OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    int                             waitflags;
+    struct sockaddr *               sa;
+    socklen_t                       addrlen;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (RemoteAddr == NULL)
+    {
+        sa      = NULL;
+        addrlen = 0;
+    }
+    else
+    {
+        addrlen = OS_SOCKADDR_MAX_LEN;
+        sa      = (struct sockaddr *)&RemoteAddr->AddrData;
+    }
+
+    return_code = OS_SocketWaitReadable_Impl(token, abs_timeout, &waitflags);
+    if (return_code == OS_SUCCESS)
+    {
+        os_result = recvfrom(impl->fd, buffer, buflen, waitflags, sa, &addrlen);
+        if (os_result < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
             {
-                if (errno == EAGAIN || errno == EWOULDBLOCK)
-                {
-                    return_code = OS_QUEUE_EMPTY;
-                }
-                else
-                {
-                    OS_DEBUG("recvfrom: %s\n", strerror(errno));
-                    return_code = OS_ERROR;
-                }
+                return_code = OS_QUEUE_EMPTY;
             }
             else
             {
-                return_code = os_result;
+                OS_DEBUG("recvfrom: %s\n", strerror(errno));
+                return_code = OS_ERROR;
+            }
+        }
+        else
+        {
+            return_code = os_result;
 
-                if (RemoteAddr != NULL)
-                {
-                    RemoteAddr->ActualLength = addrlen;
-                }
+            if (RemoteAddr != NULL)
+            {
+                RemoteAddr->ActualLength = addrlen;
             }
         }
     }
@@ -561,6 +785,59 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count,
+                                  OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    int                             waitflags;
+    uint32                          total;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    return_code = OS_SocketWaitReadable_Impl(token, abs_timeout, &waitflags);
+    if (return_code == OS_SUCCESS)
+    {
+        total = 0;
+        do
+        {
+            os_result = OS_SocketRecvBatch_Impl(impl->fd, &msgs[total], count - total, waitflags);
+            if (os_result <= 0)
+            {
+                break;
+            }
+
+            total += os_result;
+
+            /* only the first datagram may block, the remainder are taken only if already queued */
+            waitflags = MSG_DONTWAIT;
+        } while (os_result == OS_IMPL_SOCKET_MSG_BATCH && total < count);
+
+        if (total > 0)
+        {
+            return_code = total;
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return_code = OS_QUEUE_EMPTY;
+        }
+        else
+        {
+            OS_DEBUG("recvmsg: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -577,21 +854,8 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
 
-    sa = (const struct sockaddr *)&RemoteAddr->AddrData;
-    switch (sa->sa_family)
-    {
-        case AF_INET:
-            addrlen = sizeof(struct sockaddr_in);
-            break;
-#ifdef OS_NETWORK_SUPPORTS_IPV6
-        case AF_INET6:
-            addrlen = sizeof(struct sockaddr_in6);
-            break;
-#endif
-        default:
-            addrlen = 0;
-            break;
-    }
+    sa      = (const struct sockaddr *)&RemoteAddr->AddrData;
+    addrlen = OS_SocketAddrLength_Impl(RemoteAddr);
 
     if (addrlen != RemoteAddr->ActualLength)
     {
@@ -608,6 +872,96 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return os_result;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count)
+{
+    int                             os_result;
+    uint32                          i;
+    uint32                          total;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* validate all addresses first, so a bad entry does not leave a partially-sent batch */
+    for (i = 0; i < count; ++i)
+    {
+        if (OS_SocketAddrLength_Impl(&msgs[i].Addr) != msgs[i].Addr.ActualLength)
+        {
+            return OS_ERR_BAD_ADDRESS;
+        }
+    }
+
+    total = 0;
+    do
+    {
+        os_result = OS_SocketSendBatch_Impl(impl->fd, &msgs[total], count - total);
+        if (os_result <= 0)
+        {
+            break;
+        }
+
+        total += os_result;
+    } while (os_result == OS_IMPL_SOCKET_MSG_BATCH && total < count);
+
+    if (total == 0)
+    {
+        OS_DEBUG("sendmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return total;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                          const OS_SockAddr_t *RemoteAddr)
+{
+    int                             os_result;
+    uint32                          i;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    struct msghdr                   msg;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name    = (void *)&RemoteAddr->AddrData;
+    msg.msg_namelen = OS_SocketAddrLength_Impl(RemoteAddr);
+
+    if (msg.msg_namelen != RemoteAddr->ActualLength)
+    {
+        return OS_ERR_BAD_ADDRESS;
+    }
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        os_iov[i].iov_base = iov[i].Buffer;
+        os_iov[i].iov_len  = iov[i].Length;
+    }
+
+    msg.msg_iov    = os_iov;
+    msg.msg_iovlen = iovcnt;
+
+    os_result = sendmsg(impl->fd, &msg, MSG_DONTWAIT);
+    if (os_result < 0)
+    {
+        OS_DEBUG("sendmsg: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return os_result;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
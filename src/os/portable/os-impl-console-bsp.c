@@ -31,6 +31,7 @@
  ***************************************************************************************/
 
 #include <string.h>
+#include <stddef.h>
 #include <errno.h>
 
 #include "osapi-printf.h"
@@ -38,6 +39,7 @@
 #include "bsp-impl.h"
 
 #include "os-impl-console.h"
+#include "os-shared-common.h"
 #include "os-shared-printf.h"
 #include "os-shared-idmap.h"
 
@@ -45,6 +47,74 @@
                                 CONSOLE OUTPUT
  ***************************************************************************************/
 
+/*
+ * Space for formatting deferred messages and binary frame headers, one per output segment.
+ * This is only used while holding the BSP lock.
+ */
+static char OS_ConsoleScratch[OS_BSP_CONSOLE_MAX_SEGMENTS][OS_MAX_API_NAME + OS_BUFFER_SIZE];
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Add the segments for a binary frame of the given record
+ *
+ *    Returns the number of segments used
+ *
+ *-----------------------------------------------------------------*/
+static size_t OS_ConsoleBinaryFrame(OS_BSP_ConsoleSegment_t *Segments, char *Scratch, uint32 RecordHdr,
+                                    const char *RecordData)
+{
+    OS_console_binary_hdr_t FrameHdr;
+    OS_time_t               Timestamp;
+    const char *            Format;
+    size_t                  DataLen;
+    size_t                  NumSegments;
+
+    DataLen = RecordHdr & OS_CONSOLE_REC_LEN_MASK;
+
+    memset(&FrameHdr, 0, sizeof(FrameHdr));
+    FrameHdr.Magic          = OS_CONSOLE_BINARY_MAGIC;
+    FrameHdr.TicksPerSecond = OS_TIME_TICKS_PER_SECOND;
+
+    Segments[0].Str     = Scratch;
+    Segments[0].DataLen = sizeof(FrameHdr);
+    NumSegments         = 1;
+
+    if ((RecordHdr & OS_CONSOLE_REC_DEFERRED) != 0)
+    {
+        /* The record may not be aligned in the ring buffer, so copy the fields out */
+        memcpy(&Timestamp, &RecordData[offsetof(OS_console_deferred_t, Timestamp)], sizeof(Timestamp));
+        memcpy(&Format, &RecordData[offsetof(OS_console_deferred_t, Format)], sizeof(Format));
+        memcpy(&FrameHdr.NumWords, &RecordData[offsetof(OS_console_deferred_t, NumWords)], sizeof(FrameHdr.NumWords));
+        memcpy(&FrameHdr.StrSize, &RecordData[offsetof(OS_console_deferred_t, StrSize)], sizeof(FrameHdr.StrSize));
+
+        FrameHdr.Type      = OS_CONSOLE_BINARY_DEFERRED;
+        FrameHdr.Timestamp = Timestamp.ticks;
+        FrameHdr.FormatLen = strlen(Format);
+
+        /* The format text is taken from the original string, the arguments directly from the record */
+        Segments[1].Str     = Format;
+        Segments[1].DataLen = FrameHdr.FormatLen;
+        Segments[2].Str     = &RecordData[offsetof(OS_console_deferred_t, Words)];
+        Segments[2].DataLen = DataLen - offsetof(OS_console_deferred_t, Words);
+        NumSegments += 2;
+    }
+    else
+    {
+        FrameHdr.Type    = OS_CONSOLE_BINARY_TEXT;
+        FrameHdr.StrSize = DataLen;
+
+        Segments[1].Str     = RecordData;
+        Segments[1].DataLen = DataLen;
+        ++NumSegments;
+    }
+
+    FrameHdr.FrameLen = sizeof(FrameHdr) + FrameHdr.FormatLen + (FrameHdr.NumWords * sizeof(uint64)) + FrameHdr.StrSize;
+    memcpy(Scratch, &FrameHdr, sizeof(FrameHdr));
+
+    return NumSegments;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -53,41 +123,103 @@
  *-----------------------------------------------------------------*/
 void OS_ConsoleOutput_Impl(const OS_object_token_t *token)
 {
+    OS_BSP_ConsoleSegment_t       Segments[OS_BSP_CONSOLE_MAX_SEGMENTS];
+    size_t                        NumSegments;
     size_t                        StartPos;
-    size_t                        EndPos;
-    size_t                        WriteSize;
+    size_t                        ReadPos;
+    uint32                        RecordHdr;
+    uint32                        PrintfMode;
     OS_console_internal_record_t *console;
 
-    console  = OS_OBJECT_TABLE_GET(OS_console_table, *token);
-    StartPos = console->ReadPos;
-    EndPos   = console->WritePos;
+    console = OS_OBJECT_TABLE_GET(OS_console_table, *token);
 
+    /* In synchronous mode this may be called by several tasks, only one may read at a time */
     OS_BSP_Lock_Impl();
 
-    while (StartPos != EndPos)
+    ReadPos = atomic_load(&console->ReadPos);
+    do
     {
-        if (StartPos > EndPos)
+        StartPos    = ReadPos;
+        NumSegments = 0;
+
+        /* Each batch is either all binary frames or all text, as they may go to different places */
+        PrintfMode = OS_SharedGlobalVars.PrintfMode;
+
+        /* Gather complete records, stopping at the first one that is still being written */
+        while (NumSegments < OS_BSP_CONSOLE_MAX_SEGMENTS && ReadPos != atomic_load(&console->WritePos))
         {
-            /* handle wrap */
-            WriteSize = console->BufSize - StartPos;
+            RecordHdr = atomic_load_explicit(OS_CONSOLE_REC_HDR(console, ReadPos), memory_order_acquire);
+            if (RecordHdr == 0)
+            {
+                break;
+            }
+
+            if ((RecordHdr & OS_CONSOLE_REC_COMPLETE) != 0)
+            {
+                if (PrintfMode == OS_PRINTF_MODE_BINARY)
+                {
+                    /* A binary frame takes up to 3 segments, header, format, and arguments */
+                    if ((NumSegments + 3) > OS_BSP_CONSOLE_MAX_SEGMENTS)
+                    {
+                        break;
+                    }
+
+                    NumSegments += OS_ConsoleBinaryFrame(&Segments[NumSegments], OS_ConsoleScratch[NumSegments],
+                                                         RecordHdr, OS_CONSOLE_REC_DATA(console, ReadPos));
+                }
+                else if ((RecordHdr & OS_CONSOLE_REC_DEFERRED) != 0)
+                {
+                    Segments[NumSegments].Str = OS_ConsoleScratch[NumSegments];
+                    Segments[NumSegments].DataLen =
+                        OS_Console_FormatDeferred(console, OS_CONSOLE_REC_DATA(console, ReadPos),
+                                                  OS_ConsoleScratch[NumSegments], sizeof(OS_ConsoleScratch[0]));
+                    ++NumSegments;
+                }
+                else
+                {
+                    Segments[NumSegments].Str     = OS_CONSOLE_REC_DATA(console, ReadPos);
+                    Segments[NumSegments].DataLen = RecordHdr & OS_CONSOLE_REC_LEN_MASK;
+                    ++NumSegments;
+                }
+
+                ReadPos += OS_CONSOLE_REC_SIZE(RecordHdr & OS_CONSOLE_REC_LEN_MASK);
+            }
+            else
+            {
+                /* skip record, the next one is at the start of the buffer */
+                ReadPos = console->BufSize;
+            }
+
+            if (ReadPos >= console->BufSize)
+            {
+                /* handle wrap */
+                ReadPos = 0;
+            }
         }
-        else
+
+        if (NumSegments != 0 && PrintfMode == OS_PRINTF_MODE_BINARY)
         {
-            WriteSize = EndPos - StartPos;
+            OS_BSP_ConsoleBinaryOutputV_Impl(Segments, NumSegments);
+        }
+        else if (NumSegments != 0)
+        {
+            OS_BSP_ConsoleOutputV_Impl(Segments, NumSegments);
         }
 
-        OS_BSP_ConsoleOutput_Impl(&console->BufBase[StartPos], WriteSize);
-
-        StartPos += WriteSize;
-        if (StartPos >= console->BufSize)
+        /* Clear the consumed records before releasing the space to writers */
+        if (ReadPos < StartPos)
         {
-            /* handle wrap */
-            StartPos = 0;
+            memset(&console->BufBase[StartPos], 0, console->BufSize - StartPos);
+            memset(console->BufBase, 0, ReadPos);
+        }
+        else
+        {
+            memset(&console->BufBase[StartPos], 0, ReadPos - StartPos);
         }
-    }
 
-    OS_BSP_Unlock_Impl();
+        /* Update the global with the new read location */
+        atomic_store(&console->ReadPos, ReadPos);
+    } while (ReadPos != StartPos);
 
-    /* Update the global with the new read location */
-    console->ReadPos = StartPos;
+    OS_BSP_Unlock_Impl();
 }
@@ -0,0 +1,56 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file   os-impl-no-mempool.c
+ *
+ * Purpose: Memory pools are implemented entirely in the shared layer, but
+ * tasks cannot wait for a block to become available on this platform.
+ * OS_MemPoolGet() can still be used with a timeout of OS_CHECK.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-mempool.h"
+
+int32 OS_MemPoolCreate_Impl(const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+}
+
+int32 OS_MemPoolDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+}
+
+int32 OS_MemPoolWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+void OS_MemPoolWake_Impl(const OS_object_token_t *token)
+{
+    /* Nothing can be waiting */
+}
+
+uint32 OS_MemPoolGetCpu_Impl(void)
+{
+    return 0;
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file   os-impl-no-queue-multi.c
+ *
+ * Purpose: All functions return OS_ERR_NOT_IMPLEMENTED.
+ * This is used where the queue has no batch operation, in which
+ * case the shared layer puts/gets one message at a time.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-queue.h"
+
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *data, size_t stride, const size_t *sizes,
+                            uint32 count, uint32 *count_put, uint32 flags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t stride, size_t *sizes, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file   os-impl-no-queue-zerocopy.c
+ *
+ * Purpose: All functions return OS_ERR_NOT_IMPLEMENTED.
+ * This is used where the queue storage cannot be accessed directly, in
+ * which case the shared layer implements the zero-copy queue API by copying.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-queue.h"
+
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data, size_t size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_QueueCancel_Impl(const OS_object_token_t *token, void *data)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **data, size_t *size, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_QueueReturn_Impl(const OS_object_token_t *token, const void *data)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
@@ -32,6 +32,8 @@
  * so the application will also see any manual/administrative clock changes.
  *
  * The clock ID is selected by defining the #OSAL_GETTIME_SOURCE_CLOCK macro.
+ *
+ * The internal monotonic time source always uses CLOCK_MONOTONIC.
  */
 
 /****************************************************************************************
@@ -87,6 +89,34 @@ int32 OS_GetLocalTime_Impl(OS_time_t *time_struct)
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+{
+    int             Status;
+    int32           ReturnCode;
+    struct timespec TimeSp;
+
+    Status = clock_gettime(CLOCK_MONOTONIC, &TimeSp);
+
+    if (Status == 0)
+    {
+        *time_struct = OS_TimeAssembleFromNanoseconds(TimeSp.tv_sec, TimeSp.tv_nsec);
+        ReturnCode   = OS_SUCCESS;
+    }
+    else
+    {
+        OS_DEBUG("Error calling clock_gettime: %s\n", strerror(errno));
+        ReturnCode = OS_ERROR;
+    }
+
+    return ReturnCode;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -38,6 +38,8 @@
  *
  *   read()
  *   write()
+ *   readv()
+ *   writev()
  *   close()
  */
 #include <string.h>
@@ -263,3 +265,175 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    ssize_t                         os_result;
+    off_t                           os_offset;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * No select() is done here, unlike OS_GenericRead_Impl().  Positional
+     * reads only apply to regular files, which are always ready.
+     */
+    os_offset = offset;
+    if (os_offset != offset)
+    {
+        /* the offset does not fit in off_t on this platform */
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    os_result = pread(impl->fd, buffer, nbytes, os_offset);
+    if (os_result < 0)
+    {
+        OS_DEBUG("pread: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* type conversion from ssize_t to int32 for return */
+    return (int32)os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+                            osal_offset_t offset)
+{
+    ssize_t                         os_result;
+    off_t                           os_offset;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* As in OS_GenericPread_Impl(), no select() is needed for regular files */
+    os_offset = offset;
+    if (os_offset != offset)
+    {
+        /* the offset does not fit in off_t on this platform */
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    os_result = pwrite(impl->fd, buffer, nbytes, os_offset);
+    if (os_result < 0)
+    {
+        OS_DEBUG("pwrite: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* type conversion from ssize_t to int32 for return */
+    return (int32)os_result;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                           OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    uint32                          operation;
+    uint32                          i;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        os_iov[i].iov_base = iov[i].Buffer;
+        os_iov[i].iov_len  = iov[i].Length;
+    }
+
+    return_code = OS_SUCCESS;
+    operation   = OS_STREAM_STATE_READABLE;
+
+    /* Same as OS_GenericRead_Impl(), select() is needed if the handle is non-blocking */
+    if (impl->selectable)
+    {
+        return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
+    }
+
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_READABLE) != 0)
+    {
+        os_result = readv(impl->fd, os_iov, iovcnt);
+        if (os_result < 0)
+        {
+            OS_DEBUG("readv: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            /* type conversion from ssize_t to int32 for return */
+            return_code = (int32)os_result;
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            OS_time_t abs_timeout)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    uint32                          operation;
+    uint32                          i;
+    struct iovec                    os_iov[OS_IOV_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    for (i = 0; i < iovcnt; ++i)
+    {
+        os_iov[i].iov_base = iov[i].Buffer;
+        os_iov[i].iov_len  = iov[i].Length;
+    }
+
+    return_code = OS_SUCCESS;
+    operation   = OS_STREAM_STATE_WRITABLE;
+
+    /* Same as OS_GenericWrite_Impl(), select() is needed if the handle is non-blocking */
+    if (impl->selectable)
+    {
+        return_code = OS_SelectSingle_Impl(token, &operation, abs_timeout);
+    }
+
+    if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_WRITABLE) != 0)
+    {
+        os_result = writev(impl->fd, os_iov, iovcnt);
+        if (os_result < 0)
+        {
+            OS_DEBUG("writev: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            /* type conversion from ssize_t to int32 for return */
+            return_code = (int32)os_result;
+        }
+    }
+
+    return return_code;
+}
@@ -27,16 +27,22 @@
 #define OS_IMPL_BINSEM_H
 
 #include "osconfig.h"
-#include <pthread.h>
-#include <signal.h>
+#include "os-shared-globaldefs.h"
+#include <stdatomic.h>
+
+/*
+ * Layout of the binary semaphore state word:
+ *  - bit 0 is the semaphore value
+ *  - the remaining bits are a counter which is incremented on every flush
+ */
+#define OS_IMPL_BINSEM_VALUE     0x00000001
+#define OS_IMPL_BINSEM_FLUSH_INC 0x00000002
 
 /* Binary Semaphores */
 typedef struct
 {
-    pthread_mutex_t       id;
-    pthread_cond_t        cv;
-    volatile sig_atomic_t flush_request;
-    volatile sig_atomic_t current_value;
+    OS_CACHE_ALIGNED atomic_uint state;       /**< Semaphore value and flush counter, also used as the futex word */
+    atomic_uint                  num_waiters; /**< Number of tasks pending in a take operation */
 } OS_impl_binsem_internal_record_t;
 
 /* Tables where the OS object information is stored */
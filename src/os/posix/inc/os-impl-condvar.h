@@ -27,13 +27,14 @@
 #define OS_IMPL_CONDVAR_H
 
 #include "osconfig.h"
+#include "os-shared-globaldefs.h"
 #include <pthread.h>
 
 /* CondVares */
 typedef struct
 {
-    pthread_mutex_t mut;
-    pthread_cond_t  cv;
+    OS_CACHE_ALIGNED pthread_mutex_t mut;
+    pthread_cond_t                   cv;
 } OS_impl_condvar_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -27,11 +27,13 @@
 #define OS_IMPL_COUNTSEM_H
 
 #include "osconfig.h"
-#include <semaphore.h>
+#include "os-shared-globaldefs.h"
+#include <stdatomic.h>
 
 typedef struct
 {
-    sem_t id;
+    OS_CACHE_ALIGNED atomic_uint value;       /**< Semaphore value, also used as the futex word */
+    atomic_uint                  num_waiters; /**< Number of tasks pending in a take operation */
 } OS_impl_countsem_internal_record_t;
 
 /* Tables where the OS object information is stored */
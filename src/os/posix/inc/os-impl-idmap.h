@@ -27,13 +27,13 @@
 #define OS_IMPL_IDMAP_H
 
 #include "osconfig.h"
+#include "os-shared-globaldefs.h"
 #include "osapi-idmap.h"
 #include <pthread.h>
 
 typedef struct
 {
-    pthread_mutex_t mutex;
-    pthread_cond_t  cond;
+    OS_CACHE_ALIGNED pthread_mutex_t mutex;
 } OS_impl_objtype_lock_t;
 
 /* Tables where the lock state information is stored */
@@ -29,14 +29,19 @@
 #include "osconfig.h"
 #include "common_types.h"
 #include <unistd.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
+/* State of asynchronous I/O on a file, created when first used */
+typedef struct OS_impl_file_async OS_impl_file_async_t;
+
 typedef struct
 {
-    int  fd;
-    bool selectable;
+    int                   fd;
+    bool                  selectable;
+    OS_impl_file_async_t *async;
 } OS_impl_file_internal_record_t;
 
 /*
@@ -27,12 +27,13 @@
 #define OS_IMPL_MUTEX_H
 
 #include "osconfig.h"
+#include "os-shared-globaldefs.h"
 #include <pthread.h>
 
 /* Mutexes */
 typedef struct
 {
-    pthread_mutex_t id;
+    OS_CACHE_ALIGNED pthread_mutex_t id;
 } OS_impl_mutex_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -0,0 +1,43 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ */
+
+#ifndef OS_IMPL_POLLER_H
+#define OS_IMPL_POLLER_H
+
+#include "osconfig.h"
+#include "os-impl-io.h"
+
+#include <sys/epoll.h>
+
+/* Pollers */
+typedef struct
+{
+    int epoll_fd;
+} OS_impl_poller_internal_record_t;
+
+/* Tables where the OS object information is stored */
+extern OS_impl_poller_internal_record_t OS_impl_poller_table[OS_MAX_POLLERS];
+
+#endif /* OS_IMPL_POLLER_H */
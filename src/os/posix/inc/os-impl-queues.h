@@ -27,12 +27,68 @@
 #define OS_IMPL_QUEUES_H
 
 #include "osconfig.h"
+#include "os-shared-globaldefs.h"
 #include <mqueue.h>
+#include <stdatomic.h>
+
+/*
+ * Ownership of a user-space queue slot by a zero-copy API caller.
+ * Slots used by OS_QueuePut/OS_QueueGet are never in the caller's hands.
+ */
+enum
+{
+    OS_IMPL_QUEUE_SLOT_QUEUED,   /**< Slot is owned by the queue */
+    OS_IMPL_QUEUE_SLOT_RESERVED, /**< Slot is owned by a caller of OS_QueueReserve */
+    OS_IMPL_QUEUE_SLOT_BORROWED, /**< Slot is owned by a caller of OS_QueueBorrow */
+    OS_IMPL_QUEUE_SLOT_CANCELLED /**< Slot holds no message after OS_QueueCancel, getters skip it */
+};
+
+/*
+ * Header of a single message slot in a user-space queue.
+ * The message data immediately follows this header.
+ */
+typedef struct
+{
+    atomic_uint_fast64_t sequence; /**< Position of the put/get that may next use this slot */
+    uint32               size;     /**< Size of the message stored in this slot */
+    atomic_uint          owner;    /**< One of the OS_IMPL_QUEUE_SLOT values */
+} OS_impl_queue_slot_t;
+
+/*
+ * State of a user-space queue.
+ *
+ * This is a bounded multi-producer/multi-consumer ring of fixed size slots,
+ * in which the sequence number in each slot indicates whether it is ready
+ * to be filled or emptied at a given position.
+ *
+ * The "put_count" member is used as a futex word for tasks waiting
+ * for a message to arrive, and is incremented on every put, and when
+ * the queue is marked as being deleted.
+ *
+ * The members updated by tasks putting messages, those updated by tasks
+ * getting messages, and those which do not change after creation are each
+ * on separate cache lines, so producers and consumers on different CPUs
+ * do not contend for the same line.
+ */
+typedef struct
+{
+    OS_CACHE_ALIGNED atomic_uint_fast64_t put_pos;
+    atomic_uint                           put_count;
+
+    OS_CACHE_ALIGNED atomic_uint_fast64_t get_pos;
+    atomic_uint                           num_waiters;
+    atomic_uint                           deleting; /**< Set while the queue is being deleted */
+
+    OS_CACHE_ALIGNED size_t depth;
+    size_t                  slot_size;
+    uint8 *                 slots;
+} OS_impl_queue_ring_t;
 
 /* queues */
 typedef struct
 {
-    mqd_t id;
+    mqd_t                 id;
+    OS_impl_queue_ring_t *ring; /**< Only set for user-space queues, NULL otherwise */
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
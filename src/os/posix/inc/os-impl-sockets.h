@@ -47,4 +47,13 @@
  */
 #define OS_IMPL_SOCKET_FLAGS O_NONBLOCK
 
+/*
+ * Linux provides recvmmsg()/sendmmsg() to move a batch of datagrams
+ * in a single system call.  These are GNU extensions, so they are only
+ * declared if the build enables them via _GNU_SOURCE.
+ */
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#define OS_IMPL_SOCKET_HAVE_MMSG
+#endif
+
 #endif /* OS_IMPL_SOCKETS_H */
@@ -35,6 +35,8 @@
 typedef struct
 {
     pthread_t id;
+    void *    pool_stack;    /**< Stack from the stack pool, or NULL if not from the pool */
+    size_t    pool_stack_sz; /**< Usable size of pool_stack */
 } OS_impl_task_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -43,4 +45,10 @@ extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
 int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, osal_stackptr_t stackptr,
                                        size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg);
 
+int32  OS_Posix_StackPoolInit(size_t pool_size);
+void * OS_Posix_StackPoolAlloc(size_t *stacksz);
+void   OS_Posix_StackPoolRelease(void *stack, size_t stacksz);
+void   OS_Posix_StackPoolReleaseOnExit(pthread_t thread, void *stack, size_t stacksz);
+size_t OS_Posix_StackPoolGetUsage(const void *stack, size_t stacksz);
+
 #endif /* OS_IMPL_TASKS_H */
@@ -36,6 +36,7 @@ typedef struct
     pthread_mutex_t handler_mutex;
     timer_t         host_timerid;
     int             assigned_signal;
+    int             timer_fd;
     sigset_t        sigset;
     sig_atomic_t    reset_flag;
 } OS_impl_timebase_internal_record_t;
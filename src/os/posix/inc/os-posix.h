@@ -44,6 +44,7 @@
 #include <mqueue.h>
 #include <fcntl.h>
 #include <semaphore.h>
+#include <stdatomic.h>
 #include <sys/types.h>
 #include <sys/signal.h>
 
@@ -97,6 +98,8 @@ int32 OS_Posix_BinSemAPI_Impl_Init(void);
 int32 OS_Posix_CountSemAPI_Impl_Init(void);
 int32 OS_Posix_MutexAPI_Impl_Init(void);
 int32 OS_Posix_CondVarAPI_Impl_Init(void);
+int32 OS_Posix_PollerAPI_Impl_Init(void);
+int32 OS_Posix_MemPoolAPI_Impl_Init(void);
 int32 OS_Posix_ModuleAPI_Impl_Init(void);
 int32 OS_Posix_TimeBaseAPI_Impl_Init(void);
 int32 OS_Posix_StreamAPI_Impl_Init(void);
@@ -106,5 +109,12 @@ int32 OS_Posix_FileSysAPI_Impl_Init(void);
 int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype);
 
 void OS_Posix_CompAbsDelayTime(uint32 msecs, struct timespec *tm);
+void OS_Posix_ConvertAbsTime(clockid_t from_clock, const struct timespec *from_time, clockid_t to_clock,
+                             struct timespec *to_time);
+bool OS_Posix_DeadlineReached(const struct timespec *deadline);
+int  OS_Posix_CondInitMonotonic(pthread_cond_t *cond);
+
+int32 OS_Posix_FutexWait(atomic_uint *futex_word, uint32 expected_value, const struct timespec *abstime);
+void  OS_Posix_FutexWake(atomic_uint *futex_word, uint32 num_waiters);
 
 #endif /* OS_POSIX_H */
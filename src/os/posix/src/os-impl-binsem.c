@@ -34,55 +34,27 @@
 #include "os-shared-binsem.h"
 #include "os-impl-binsem.h"
 
-/*
- * This controls the maximum time that the calling thread will wait to
- * acquire the condition mutex before returning an error.
- *
- * Under normal conditions, this lock is held by giving/taking threads very
- * briefly, so the lock should be available with minimal delay.  However,
- * if the "taking" thread is canceled or exits abnormally without releasing the
- * lock, it means any other task accessing the sem can get blocked indefinitely.
- *
- * There should be no reason for a user to configure this, as it should
- * not be relevant in a normally operating system.  This only prevents a
- * deadlock condition in off-nominal circumstances.
- */
-#define OS_POSIX_BINSEM_MAX_WAIT_SECONDS 2
-
 /* Tables where the OS object information is stored */
 OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
 
+CompileTimeAssert(sizeof(OS_impl_binsem_internal_record_t) % OS_CACHE_LINE_SIZE == 0, BinSemRecordSize);
+
 /*---------------------------------------------------------------------------------------
- * Helper function for acquiring the mutex when beginning a binary sem operation
- * This uses timedlock to avoid waiting forever, and is put into a wrapper function
- * to avoid pending forever.  The code should never pend on these for a long time.
+ * Helper function for when a task stops pending on a binary sem, including if the
+ * task is canceled while pending.
+ *
+ * If a give woke this task but it is not going to take the sem (i.e. it timed out
+ * or was canceled at the same time) then the wakeup must be passed on to another
+ * pending task, otherwise that task could stay blocked even though the sem is full.
  ----------------------------------------------------------------------------------------*/
-int32 OS_Posix_BinSemAcquireMutex(pthread_mutex_t *mut)
+static void OS_Posix_BinSemWaitDone(void *arg)
 {
-    struct timespec timeout;
+    OS_impl_binsem_internal_record_t *sem = arg;
 
-    if (clock_gettime(CLOCK_REALTIME, &timeout) != 0)
+    if (atomic_fetch_sub(&sem->num_waiters, 1) > 1 && (atomic_load(&sem->state) & OS_IMPL_BINSEM_VALUE) != 0)
     {
-        return OS_SEM_FAILURE;
+        OS_Posix_FutexWake(&sem->state, 1);
     }
-
-    timeout.tv_sec += OS_POSIX_BINSEM_MAX_WAIT_SECONDS;
-
-    if (pthread_mutex_timedlock(mut, &timeout) != 0)
-    {
-        return OS_SEM_FAILURE;
-    }
-
-    return OS_SUCCESS;
-}
-
-/*---------------------------------------------------------------------------------------
- * Helper function for releasing the mutex in case the thread
- * executing pthread_condwait() is canceled.
- ----------------------------------------------------------------------------------------*/
-void OS_Posix_BinSemReleaseMutex(void *mut)
-{
-    pthread_mutex_unlock(mut);
 }
 
 /****************************************************************************************
@@ -91,10 +63,11 @@ void OS_Posix_BinSemReleaseMutex(void *mut)
 
 /*
  * Note that the pthreads world does not provide VxWorks-style binary semaphores that the OSAL API is modeled after.
- * Instead, semaphores are simulated using pthreads mutexes, condition variables, and a bit of internal state.
+ * Instead, semaphores are simulated using a single atomic state word, which holds both the value and a count of
+ * flush operations, and the Linux futex facility to block on that word.
  *
- * IMPORTANT: the side effect of this is that Binary Semaphores are not usable from signal handlers / ISRs.
- * Use Counting Semaphores instead.
+ * Give and take operations on a semaphore which no other task is pending on consist of a single atomic operation,
+ * and the futex system call is only used if a task actually needs to block or be woken up.
  */
 
 /*---------------------------------------------------------------------------------------
@@ -117,12 +90,6 @@ int32 OS_Posix_BinSemAPI_Impl_Init(void)
  *-----------------------------------------------------------------*/
 int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
 {
-    int                               ret;
-    int                               attr_created;
-    int                               mutex_created;
-    int                               cond_created;
-    int32                             return_code;
-    pthread_mutexattr_t               mutex_attr;
     OS_impl_binsem_internal_record_t *sem;
 
     /*
@@ -135,108 +102,12 @@ int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value,
         initial_value = 1;
     }
 
-    attr_created  = 0;
-    mutex_created = 0;
-    cond_created  = 0;
-    sem           = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
-    memset(sem, 0, sizeof(*sem));
-
-    do
-    {
-        /*
-         ** Initialize the pthread mutex attribute structure with default values
-         */
-        ret = pthread_mutexattr_init(&mutex_attr);
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: pthread_mutexattr_init failed: %s\n", strerror(ret));
-            return_code = OS_SEM_FAILURE;
-            break;
-        }
-
-        /* After this point, the attr object should be destroyed before return */
-        attr_created = 1;
-
-        /*
-         ** Use priority inheritance
-         */
-        ret = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: pthread_mutexattr_setprotocol failed: %s\n", strerror(ret));
-            return_code = OS_SEM_FAILURE;
-            break;
-        }
-
-        /*
-         ** Initialize the mutex that is used with the condition variable
-         */
-        ret = pthread_mutex_init(&(sem->id), &mutex_attr);
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: pthread_mutex_init failed: %s\n", strerror(ret));
-            return_code = OS_SEM_FAILURE;
-            break;
-        }
-
-        mutex_created = 1;
-
-        /*
-         ** Initialize the condition variable
-         */
-        ret = pthread_cond_init(&(sem->cv), NULL);
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
-            return_code = OS_SEM_FAILURE;
-            break;
-        }
-
-        cond_created = 1;
-
-        /*
-         * Check sem call, avoids unreachable destroy logic
-         */
-        ret = pthread_cond_signal(&(sem->cv));
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: initial pthread_cond_signal failed: %s\n", strerror(ret));
-            return_code = OS_SEM_FAILURE;
-            break;
-        }
-
-        /*
-         ** fill out the proper OSAL table fields
-         */
-
-        sem->current_value = initial_value;
-
-        return_code = OS_SUCCESS;
-    } while (0);
-
-    /* Clean up resources if the operation failed */
-    if (return_code != OS_SUCCESS)
-    {
-        if (mutex_created)
-        {
-            pthread_mutex_destroy(&(sem->id));
-        }
-        if (cond_created)
-        {
-            pthread_cond_destroy(&(sem->cv));
-        }
-    }
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
-    if (attr_created)
-    {
-        /* Done with the attribute object -
-         * this call is a no-op in linux - but for other implementations if
-         * the create call allocated something this should free it
-         */
-        pthread_mutexattr_destroy(&mutex_attr);
-    }
+    atomic_init(&sem->state, initial_value);
+    atomic_init(&sem->num_waiters, 0);
 
-    return return_code;
+    return OS_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -248,32 +119,17 @@ int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value,
 int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
 {
     OS_impl_binsem_internal_record_t *sem;
-    int32                             return_code;
 
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
-    if (pthread_cond_destroy(&(sem->cv)) != 0)
+    if (atomic_load(&sem->num_waiters) != 0)
     {
-        /* sem could be busy, i.e. some task is pending on it already.
+        /* sem is busy, i.e. some task is pending on it already.
          * that means it cannot be deleted at this time. */
-        return_code = OS_SEM_FAILURE;
-    }
-    else
-    {
-        /* Now that the CV is destroyed this sem is unusable,
-         * so we must do our best to clean everything else.  Even if cleanup
-         * does not fully work, returning anything other than OS_SUCCESS would
-         * suggest to the caller that the sem is still usable which it is not.
-         */
-        return_code = OS_SUCCESS;
-
-        /* destroy the associated mutex --
-         * Note that this might fail if the mutex is locked,
-         * but there is no sane way to recover from that (see above). */
-        pthread_mutex_destroy(&(sem->id));
+        return OS_SEM_FAILURE;
     }
 
-    return return_code;
+    return OS_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -285,37 +141,25 @@ int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
 int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
 {
     OS_impl_binsem_internal_record_t *sem;
+    uint32                            prev_state;
 
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
+    /* Binary semaphores are always set as "1" when given */
+    prev_state = atomic_fetch_or(&sem->state, OS_IMPL_BINSEM_VALUE);
+
     /*
-     * Note there is a possibility that another thread is concurrently taking this sem,
-     * and has just checked the current_value but not yet inside the cond_wait call.
-     *
-     * To address this possibility - the lock must be taken here.  This is unfortunate
-     * as it means there may be a task switch when _giving_ a binary semaphore.  But the
-     * alternative of having a BinSemGive not wake up the other thread is a bigger issue.
-     *
-     * Counting sems do not suffer from this, as there is a native POSIX mechanism for those.
-     *
-     * Note: This lock should be readily available, with only minimal delay if any.
-     * If a long delay occurs here, it means something is fundamentally wrong.
+     * Takers increment num_waiters before checking the state word, and the futex
+     * wait fails if the state word changed since then, so either the taker sees
+     * the new value or this sees the waiter.  If the value was already 1 then
+     * a waiter was already woken by a previous give.
      */
-
-    /* Lock the mutex ( not the table! ) */
-    if (OS_Posix_BinSemAcquireMutex(&sem->id) != OS_SUCCESS)
+    if ((prev_state & OS_IMPL_BINSEM_VALUE) == 0 && atomic_load(&sem->num_waiters) != 0)
     {
-        return OS_SEM_FAILURE;
+        /* unblock one thread that is waiting on this sem */
+        OS_Posix_FutexWake(&sem->state, 1);
     }
 
-    /* Binary semaphores are always set as "1" when given */
-    sem->current_value = 1;
-
-    /* unblock one thread that is waiting on this sem */
-    pthread_cond_signal(&(sem->cv));
-
-    pthread_mutex_unlock(&(sem->id));
-
     return OS_SUCCESS;
 }
 
@@ -331,22 +175,17 @@ int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
 
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
-    /* Lock the mutex ( not the table! ) */
-    if (OS_Posix_BinSemAcquireMutex(&sem->id) != OS_SUCCESS)
-    {
-        return OS_SEM_FAILURE;
-    }
-
     /* increment the flush counter.  Any other threads that are
      * currently pending in SemTake() will see the counter change and
-     * return _without_ modifying the semaphore count.
+     * return _without_ modifying the semaphore value.
      */
-    ++sem->flush_request;
+    atomic_fetch_add(&sem->state, OS_IMPL_BINSEM_FLUSH_INC);
 
     /* unblock all threads that are be waiting on this sem */
-    pthread_cond_broadcast(&(sem->cv));
-
-    pthread_mutex_unlock(&(sem->id));
+    if (atomic_load(&sem->num_waiters) != 0)
+    {
+        OS_Posix_FutexWake(&sem->state, INT_MAX);
+    }
 
     return OS_SUCCESS;
 }
@@ -361,79 +200,88 @@ int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
 ---------------------------------------------------------------------------------------*/
 static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
 {
-    sig_atomic_t                      flush_count;
+    uint32                            state;
+    uint32                            flush_count;
     int32                             return_code;
     OS_impl_binsem_internal_record_t *sem;
 
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
     /*
-     * Note - this lock should be quickly available - should not delay here.
-     * The main delay is in the pthread_cond_wait() below.
+     * Fast path: if the value was 1, clearing it takes the semaphore
+     * and nothing else is needed.
      */
-    /* Lock the mutex ( not the table! ) */
-    if (OS_Posix_BinSemAcquireMutex(&sem->id) != OS_SUCCESS)
+    state = atomic_fetch_and(&sem->state, ~OS_IMPL_BINSEM_VALUE);
+    if ((state & OS_IMPL_BINSEM_VALUE) != 0)
     {
-        return OS_SEM_FAILURE;
+        return OS_SUCCESS;
     }
 
-    /* because pthread_cond_wait() is also a cancellation point,
-     * this uses a cleanup handler to ensure that if canceled during this call,
-     * the mutex is also released */
-    pthread_cleanup_push(OS_Posix_BinSemReleaseMutex, &sem->id);
-
-    return_code = OS_SUCCESS;
-
     /*
      * Note that for vxWorks compatibility, we need to stop pending on the semaphore
      * and return from this function under two possible circumstances:
      *
-     *  a) the semaphore count was nonzero (may be pre-existing or due to a give)
-     *     this is the normal case, we should decrement the count by 1 and return.
+     *  a) the semaphore value became nonzero (due to a give)
+     *     this is the normal case, we should set the value back to 0 and return.
      *  b) the semaphore got "flushed"
-     *     in this case ALL tasks are un-blocked and we do NOT decrement the count.
+     *     in this case ALL tasks are un-blocked and we do NOT modify the value.
+     *
+     * The flush counter from the snapshot above is used to detect (b).
      */
+    flush_count = state & ~OS_IMPL_BINSEM_VALUE;
+    return_code = OS_SUCCESS;
 
-    /*
-     * first take a local snapshot of the flush request counter,
-     * if it changes, we know that someone else called SemFlush.
-     */
-    flush_count = sem->flush_request;
+    /* because the futex wait is a cancellation point,
+     * this uses a cleanup handler to ensure that if canceled during this call,
+     * the waiter count is also released */
+    atomic_fetch_add(&sem->num_waiters, 1);
+    pthread_cleanup_push(OS_Posix_BinSemWaitDone, sem);
 
-    /* Note - the condition must be checked in a while loop because
-     * even if pthread_cond_wait() returns, it does NOT guarantee that
-     * the condition we are looking for has been met.
-     *
-     * Also if the current_value is already nonzero we will not wait.
-     */
-    while (sem->current_value == 0 && sem->flush_request == flush_count)
+    state = atomic_load(&sem->state);
+    while (true)
     {
-        /* Must pend until something changes */
-        if (timeout == NULL)
+        if ((state & ~OS_IMPL_BINSEM_VALUE) != flush_count)
         {
-            /* wait forever */
-            pthread_cond_wait(&(sem->cv), &(sem->id));
+            /* flushed */
+            break;
         }
-        else if (pthread_cond_timedwait(&(sem->cv), &(sem->id), timeout) == ETIMEDOUT)
+
+        if ((state & OS_IMPL_BINSEM_VALUE) != 0)
+        {
+            /* on failure this reloads state and the loop checks again */
+            if (atomic_compare_exchange_weak(&sem->state, &state, state & ~OS_IMPL_BINSEM_VALUE))
+            {
+                break;
+            }
+            continue;
+        }
+
+        /* Must pend until something changes */
+        return_code = OS_Posix_FutexWait(&sem->state, state, timeout);
+        if (return_code != OS_SUCCESS)
         {
-            return_code = OS_SEM_TIMEOUT;
             break;
         }
-    }
 
-    /* If the flush counter did not change, set the value to zero */
-    if (return_code == OS_SUCCESS && sem->flush_request == flush_count)
-    {
-        sem->current_value = 0;
+        state = atomic_load(&sem->state);
     }
 
     /*
      * Pop the cleanup handler.
      * Passing "true" means it will be executed, which
-     * handles releasing the mutex.
+     * handles releasing the waiter count.
      */
     pthread_cleanup_pop(true);
 
+    if (return_code == OS_ERROR_TIMEOUT)
+    {
+        return_code = OS_SEM_TIMEOUT;
+    }
+    else if (return_code != OS_SUCCESS)
+    {
+        return_code = OS_SEM_FAILURE;
+    }
+
     return return_code;
 }
 
@@ -479,6 +327,6 @@ int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *s
     sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
 
     /* put the info into the structure */
-    sem_prop->value = sem->current_value;
+    sem_prop->value = atomic_load(&sem->state) & OS_IMPL_BINSEM_VALUE;
     return OS_SUCCESS;
 }
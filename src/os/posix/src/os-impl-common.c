@@ -94,6 +94,12 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return_code = OS_Posix_CondVarAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            return_code = OS_Posix_PollerAPI_Impl_Init();
+            break;
+        case OS_OBJECT_TYPE_OS_MEMPOOL:
+            return_code = OS_Posix_MemPoolAPI_Impl_Init();
+            break;
         default:
             break;
     }
@@ -143,10 +149,13 @@ void OS_ApplicationShutdown_Impl(void)
  * computes the absolute time at which this time interval will expire.
  * The absolute time is programmed into a struct.
  *
+ * The result is relative to CLOCK_MONOTONIC, so the deadline is not
+ * affected if the system time is changed while waiting.
+ *
  *-----------------------------------------------------------------*/
 void OS_Posix_CompAbsDelayTime(uint32 msecs, struct timespec *tm)
 {
-    clock_gettime(CLOCK_REALTIME, tm);
+    clock_gettime(CLOCK_MONOTONIC, tm);
 
     /* add the delay to the current time */
     tm->tv_sec += (time_t)(msecs / 1000);
@@ -159,3 +168,87 @@ void OS_Posix_CompAbsDelayTime(uint32 msecs, struct timespec *tm)
         tm->tv_sec++;
     }
 }
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Converts an absolute time relative to from_clock into the equivalent
+ * absolute time relative to to_clock, based on the current offset
+ * between the two clocks.
+ *
+ * This is for system calls which only accept a CLOCK_REALTIME deadline,
+ * and for converting an absolute system time given by the application
+ * into a CLOCK_MONOTONIC deadline.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_ConvertAbsTime(clockid_t from_clock, const struct timespec *from_time, clockid_t to_clock,
+                             struct timespec *to_time)
+{
+    struct timespec from_now;
+    struct timespec to_now;
+
+    clock_gettime(from_clock, &from_now);
+    clock_gettime(to_clock, &to_now);
+
+    to_time->tv_sec  = to_now.tv_sec + (from_time->tv_sec - from_now.tv_sec);
+    to_time->tv_nsec = to_now.tv_nsec + (from_time->tv_nsec - from_now.tv_nsec);
+
+    if (to_time->tv_nsec < 0)
+    {
+        to_time->tv_nsec += 1000000000L;
+        to_time->tv_sec--;
+    }
+    else if (to_time->tv_nsec >= 1000000000L)
+    {
+        to_time->tv_nsec -= 1000000000L;
+        to_time->tv_sec++;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Checks if the CLOCK_MONOTONIC deadline computed by
+ * OS_Posix_CompAbsDelayTime() has been reached.
+ *
+ *-----------------------------------------------------------------*/
+bool OS_Posix_DeadlineReached(const struct timespec *deadline)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (now.tv_sec > deadline->tv_sec || (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Initializes a condition variable which uses CLOCK_MONOTONIC for
+ * timed waits, so that it is consistent with OS_Posix_CompAbsDelayTime().
+ *
+ * Returns 0 on success or an error number, like pthread_cond_init().
+ *
+ *-----------------------------------------------------------------*/
+int OS_Posix_CondInitMonotonic(pthread_cond_t *cond)
+{
+    int                ret;
+    pthread_condattr_t cond_attr;
+
+    ret = pthread_condattr_init(&cond_attr);
+    if (ret == 0)
+    {
+        ret = pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+        if (ret == 0)
+        {
+            ret = pthread_cond_init(cond, &cond_attr);
+        }
+
+        pthread_condattr_destroy(&cond_attr);
+    }
+
+    return ret;
+}
@@ -35,6 +35,8 @@
 /* Tables where the OS object information is stored */
 OS_impl_condvar_internal_record_t OS_impl_condvar_table[OS_MAX_CONDVARS];
 
+CompileTimeAssert(sizeof(OS_impl_condvar_internal_record_t) % OS_CACHE_LINE_SIZE == 0, CondVarRecordSize);
+
 /*---------------------------------------------------------------------------------------
  * Helper function for releasing the mutex in case the thread
  * executing pthread_cond_wait() is canceled.
@@ -87,9 +89,9 @@ int32 OS_CondVarCreate_Impl(const OS_object_token_t *token, uint32 options)
     else
     {
         /*
-        ** create the condvar
+        ** create the condvar, using the monotonic clock for timed waits
         */
-        status = pthread_cond_init(&impl->cv, NULL);
+        status = OS_Posix_CondInitMonotonic(&impl->cv);
         if (status != 0)
         {
             pthread_mutex_destroy(&impl->mut);
@@ -260,14 +262,22 @@ int32 OS_CondVarWait_Impl(const OS_object_token_t *token)
  *-----------------------------------------------------------------*/
 int32 OS_CondVarTimedWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_wakeup_time)
 {
+    struct timespec                    wakeup_time;
     struct timespec                    limit;
     int                                status;
     OS_impl_condvar_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_condvar_table, *token);
 
-    limit.tv_sec  = OS_TimeGetTotalSeconds(*abs_wakeup_time);
-    limit.tv_nsec = OS_TimeGetNanosecondsPart(*abs_wakeup_time);
+    wakeup_time.tv_sec  = OS_TimeGetTotalSeconds(*abs_wakeup_time);
+    wakeup_time.tv_nsec = OS_TimeGetNanosecondsPart(*abs_wakeup_time);
+
+    /*
+     * The wakeup time is in terms of the system clock (OS_GetLocalTime), but the
+     * condvar uses the monotonic clock, so that a change to the system clock while
+     * waiting does not cause a premature timeout or an excessive delay.
+     */
+    OS_Posix_ConvertAbsTime(CLOCK_REALTIME, &wakeup_time, CLOCK_MONOTONIC, &limit);
 
     pthread_cleanup_push(OS_Posix_CondVarReleaseMutex, &impl->mut);
     status = pthread_cond_timedwait(&impl->cv, &impl->mut, &limit);
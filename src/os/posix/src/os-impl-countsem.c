@@ -42,15 +42,61 @@
 /* Tables where the OS object information is stored */
 OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
 
+CompileTimeAssert(sizeof(OS_impl_countsem_internal_record_t) % OS_CACHE_LINE_SIZE == 0, CountSemRecordSize);
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for when a task stops pending on a counting sem, including if the
+ * task is canceled while pending.
+ *
+ * If a give woke this task but it is not going to take the sem (i.e. it timed out
+ * or was canceled at the same time) then the wakeup must be passed on to another
+ * pending task, otherwise that task could stay blocked even though the value is nonzero.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_CountSemWaitDone(void *arg)
+{
+    OS_impl_countsem_internal_record_t *impl = arg;
+
+    if (atomic_fetch_sub(&impl->num_waiters, 1) > 1 && atomic_load(&impl->value) != 0)
+    {
+        OS_Posix_FutexWake(&impl->value, 1);
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function that decrements the semaphore value if it is nonzero.
+ * Returns true if successful, false if the value was zero.
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_CountSemTryDecrement(OS_impl_countsem_internal_record_t *impl)
+{
+    uint32 value;
+
+    value = atomic_load(&impl->value);
+    while (value != 0)
+    {
+        /* on failure this reloads value and the loop checks again */
+        if (atomic_compare_exchange_weak(&impl->value, &value, value - 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /****************************************************************************************
                                COUNTING SEMAPHORE API
  ***************************************************************************************/
 
 /*
- * Unlike binary semaphores, counting semaphores can use the standard POSIX semaphore facility.
- * This has the advantage of more correct behavior on "give" operations:
+ * Counting semaphores are implemented in the same manner as binary semaphores, using an
+ * atomic value and the Linux futex facility to block on it.  This has the advantage of
+ * more correct behavior on "give" operations:
  *  - give may be done from a signal / ISR context
  *  - give should not cause an unexpected task switch nor should it ever block
+ *
+ * Give and take operations on a semaphore which no other task is pending on consist of a
+ * single atomic operation, and the futex system call is only used if a task actually needs
+ * to block or be woken up.
  */
 
 /*---------------------------------------------------------------------------------------
@@ -82,10 +128,8 @@ int32 OS_CountSemCreate_Impl(const OS_object_token_t *token, uint32 sem_initial_
         return OS_INVALID_SEM_VALUE;
     }
 
-    if (sem_init(&impl->id, 0, sem_initial_value) < 0)
-    {
-        return OS_SEM_FAILURE;
-    }
+    atomic_init(&impl->value, sem_initial_value);
+    atomic_init(&impl->num_waiters, 0);
 
     return OS_SUCCESS;
 }
@@ -102,8 +146,9 @@ int32 OS_CountSemDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
 
-    if (sem_destroy(&impl->id) < 0)
+    if (atomic_load(&impl->num_waiters) != 0)
     {
+        /* sem is busy, i.e. some task is pending on it already */
         return OS_SEM_FAILURE;
     }
 
@@ -119,35 +164,82 @@ int32 OS_CountSemDelete_Impl(const OS_object_token_t *token)
 int32 OS_CountSemGive_Impl(const OS_object_token_t *token)
 {
     OS_impl_countsem_internal_record_t *impl;
+    uint32                              value;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
 
-    if (sem_post(&impl->id) < 0)
+    value = atomic_load(&impl->value);
+    do
     {
-        return OS_SEM_FAILURE;
+        if (value >= SEM_VALUE_MAX)
+        {
+            return OS_SEM_FAILURE;
+        }
+    } while (!atomic_compare_exchange_weak(&impl->value, &value, value + 1));
+
+    /*
+     * Takers increment num_waiters before checking the value, and the futex
+     * wait fails if the value changed since then, so either the taker sees
+     * the new value or this sees the waiter.
+     */
+    if (atomic_load(&impl->num_waiters) != 0)
+    {
+        OS_Posix_FutexWake(&impl->value, 1);
     }
 
     return OS_SUCCESS;
 }
 
-/*----------------------------------------------------------------
- *
- *  Purpose: Implemented per internal OSAL API
- *           See prototype for argument/return detail
- *
- *-----------------------------------------------------------------*/
-int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericCountSemTake_Impl
+
+   Purpose: Helper function that takes a counting semaphore with a "timespec" timeout
+            If the value is zero this will block until the value becomes nonzero.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericCountSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
 {
+    int32                               return_code;
     OS_impl_countsem_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
 
-    if (sem_wait(&impl->id) < 0)
+    /* Fast path: the value was nonzero */
+    if (OS_Posix_CountSemTryDecrement(impl))
     {
-        return OS_SEM_FAILURE;
+        return OS_SUCCESS;
     }
 
-    return OS_SUCCESS;
+    return_code = OS_SUCCESS;
+
+    /* because the futex wait is a cancellation point,
+     * this uses a cleanup handler to ensure that if canceled during this call,
+     * the waiter count is also released */
+    atomic_fetch_add(&impl->num_waiters, 1);
+    pthread_cleanup_push(OS_Posix_CountSemWaitDone, impl);
+
+    while (!OS_Posix_CountSemTryDecrement(impl))
+    {
+        /* Must pend until the value becomes nonzero */
+        return_code = OS_Posix_FutexWait(&impl->value, 0, timeout);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    pthread_cleanup_pop(true);
+
+    if (return_code == OS_ERROR_TIMEOUT)
+    {
+        return_code = OS_SEM_TIMEOUT;
+    }
+    else if (return_code != OS_SUCCESS)
+    {
+        return_code = OS_SEM_FAILURE;
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -156,34 +248,27 @@ int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
 {
-    struct timespec                     ts;
-    int                                 result;
-    OS_impl_countsem_internal_record_t *impl;
+    return (OS_GenericCountSemTake_Impl(token, NULL));
+}
 
-    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
 
     /*
      ** Compute an absolute time for the delay
      */
     OS_Posix_CompAbsDelayTime(msecs, &ts);
 
-    if (sem_timedwait(&impl->id, &ts) == 0)
-    {
-        result = OS_SUCCESS;
-    }
-    else if (errno == ETIMEDOUT)
-    {
-        result = OS_SEM_TIMEOUT;
-    }
-    else
-    {
-        /* unspecified failure */
-        result = OS_SEM_FAILURE;
-    }
-
-    return result;
+    return (OS_GenericCountSemTake_Impl(token, &ts));
 }
 
 /*----------------------------------------------------------------
@@ -194,17 +279,11 @@ int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
  *-----------------------------------------------------------------*/
 int32 OS_CountSemGetInfo_Impl(const OS_object_token_t *token, OS_count_sem_prop_t *count_prop)
 {
-    int                                 sval;
     OS_impl_countsem_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
 
-    if (sem_getvalue(&impl->id, &sval) < 0)
-    {
-        return OS_SEM_FAILURE;
-    }
-
     /* put the info into the structure */
-    count_prop->value = sval;
+    count_prop->value = atomic_load(&impl->value);
     return OS_SUCCESS;
 }
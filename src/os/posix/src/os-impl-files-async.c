@@ -0,0 +1,852 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Asynchronous file I/O.  Where the kernel supports it, operations are handed
+ * to an io_uring instance created for the file, so any number of them can be
+ * in progress without a thread for each.  Otherwise they are handed to a small
+ * pool of threads, shared by all files, which use pread()/pwrite().
+ *
+ * The state is only created when a file is first used this way, and is
+ * referenced from the entry of the file in OS_impl_filehandle_table.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * syscall() is not exposed by the X/Open feature set selected by the BSP,
+ * so this also needs the glibc default (BSD/SVID) feature set.
+ */
+#define _DEFAULT_SOURCE
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+/*
+ * io_uring is only used if the headers are recent enough to have plain
+ * read and write operations, which came with IORING_FEAT_RW_CUR_POS.
+ */
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+#endif
+
+/*
+ * The number of threads in the pool used when io_uring is not available.
+ * These are started when first needed and are not stopped again.
+ */
+#define OS_IMPL_FILE_ASYNC_POOL_THREADS 4
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+typedef enum
+{
+    OS_IMPL_FILE_ASYNC_OP_FREE,
+    OS_IMPL_FILE_ASYNC_OP_PENDING, /* submitted, not yet complete */
+    OS_IMPL_FILE_ASYNC_OP_DONE     /* complete, waiting to be collected */
+} OS_impl_file_async_op_state_t;
+
+typedef struct OS_impl_file_async_op
+{
+    struct OS_impl_file_async_op *next;  /* next in the queue of the thread pool */
+    OS_impl_file_async_t *        async; /* the file this operation belongs to */
+    OS_async_request_t            request;
+    int32                         result;
+    OS_impl_file_async_op_state_t state;
+} OS_impl_file_async_op_t;
+
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+typedef struct
+{
+    int                  fd; /* -1 if io_uring is not used for this file */
+    void *               sq_ring;
+    size_t               sq_ring_size;
+    void *               cq_ring;
+    size_t               cq_ring_size;
+    struct io_uring_sqe *sqes;
+    size_t               sqes_size;
+    atomic_uint *        sq_tail;
+    uint32 *             sq_array;
+    uint32               sq_mask;
+    atomic_uint *        cq_head;
+    atomic_uint *        cq_tail;
+    struct io_uring_cqe *cqes;
+    uint32               cq_mask;
+} OS_impl_file_uring_t;
+#endif
+
+struct OS_impl_file_async
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  cond; /* signaled by the thread pool when an operation completes */
+    int             fd;
+    uint32          num_pending;
+    uint32          done_head; /* index in done_list of the oldest completion */
+    uint32          done_count;
+    uint32          done_list[OS_MAX_ASYNC_IO];
+
+    OS_impl_file_async_op_t ops[OS_MAX_ASYNC_IO];
+
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+    OS_impl_file_uring_t ring;
+#endif
+};
+
+/*
+ * The thread pool.  The lock also protects the "async" pointers
+ * in OS_impl_filehandle_table.
+ */
+static struct
+{
+    pthread_mutex_t          lock;
+    pthread_cond_t           cond;
+    OS_impl_file_async_op_t *head;
+    OS_impl_file_async_op_t *tail;
+    uint32                   num_threads;
+} OS_impl_file_async_pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0};
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Records the result of an operation and queues its completion
+ *          to be collected.  The result is the number of bytes transferred,
+ *          or a negative errno value.
+ *          Must be called with the lock of the file held.
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncComplete(OS_impl_file_async_t *async, uint32 op_idx, int64 result)
+{
+    OS_impl_file_async_op_t *op;
+
+    op = &async->ops[op_idx];
+
+    if (result < 0)
+    {
+        OS_DEBUG("Async I/O: %s\n", strerror((int)-result));
+        op->result = OS_ERROR;
+    }
+    else
+    {
+        op->result = (int32)result;
+    }
+
+    op->state = OS_IMPL_FILE_ASYNC_OP_DONE;
+    async->done_list[(async->done_head + async->done_count) % OS_MAX_ASYNC_IO] = op_idx;
+    ++async->done_count;
+    --async->num_pending;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Body of the threads in the pool.  Each takes the oldest queued
+ *          operation and performs it, forever.
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_FileAsyncPoolThread(void *arg)
+{
+    OS_impl_file_async_op_t *op;
+    OS_impl_file_async_t *   async;
+    ssize_t                  result;
+
+    while (true)
+    {
+        pthread_mutex_lock(&OS_impl_file_async_pool.lock);
+        while (OS_impl_file_async_pool.head == NULL)
+        {
+            pthread_cond_wait(&OS_impl_file_async_pool.cond, &OS_impl_file_async_pool.lock);
+        }
+
+        op                           = OS_impl_file_async_pool.head;
+        OS_impl_file_async_pool.head = op->next;
+        if (OS_impl_file_async_pool.head == NULL)
+        {
+            OS_impl_file_async_pool.tail = NULL;
+        }
+        pthread_mutex_unlock(&OS_impl_file_async_pool.lock);
+
+        async = op->async;
+        do
+        {
+            if (op->request.op == OS_ASYNC_OP_READ)
+            {
+                result = pread(async->fd, op->request.buffer, op->request.nbytes, op->request.offset);
+            }
+            else
+            {
+                result = pwrite(async->fd, op->request.buffer, op->request.nbytes, op->request.offset);
+            }
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0)
+        {
+            result = -errno;
+        }
+
+        pthread_mutex_lock(&async->lock);
+        OS_Posix_FileAsyncComplete(async, (uint32)(op - async->ops), result);
+        pthread_cond_broadcast(&async->cond);
+        pthread_mutex_unlock(&async->lock);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Starts the threads of the pool, if not already running.
+ *          Must be called with the pool lock held.
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncPoolStart(void)
+{
+    pthread_attr_t attr;
+    pthread_t      thread;
+    int            ret;
+
+    if (OS_impl_file_async_pool.num_threads > 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    while (OS_impl_file_async_pool.num_threads < OS_IMPL_FILE_ASYNC_POOL_THREADS)
+    {
+        ret = pthread_create(&thread, &attr, OS_Posix_FileAsyncPoolThread, NULL);
+        if (ret != 0)
+        {
+            OS_DEBUG("pthread_create: %s\n", strerror(ret));
+            break;
+        }
+
+        ++OS_impl_file_async_pool.num_threads;
+    }
+
+    pthread_attr_destroy(&attr);
+
+    /* Fewer threads than intended still work, just with less concurrency */
+    if (OS_impl_file_async_pool.num_threads == 0)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Converts a CLOCK_MONOTONIC deadline into a poll() timeout,
+ *          rounding up so the wait does not end before the deadline.
+ *          A NULL deadline means to wait indefinitely.
+ *-----------------------------------------------------------------*/
+static int OS_Posix_FileAsyncPollTimeout(const struct timespec *deadline)
+{
+    struct timespec now;
+    int64           msec;
+
+    if (deadline == NULL)
+    {
+        return -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    msec = ((int64)(deadline->tv_sec - now.tv_sec) * 1000) + ((deadline->tv_nsec - now.tv_nsec + 999999) / 1000000);
+    if (msec <= 0)
+    {
+        return 0;
+    }
+    if (msec > INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    return (int)msec;
+}
+
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Releases the resources of an io_uring instance, including
+ *          those of one which was only partly set up.
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncRingTeardown(OS_impl_file_uring_t *ring)
+{
+    if (ring->sqes != NULL)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+    {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL)
+    {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+    if (ring->fd >= 0)
+    {
+        close(ring->fd);
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Creates an io_uring instance and maps its rings.  This fails
+ *          if the kernel does not support io_uring or is too old to have
+ *          plain read and write operations, or if io_uring is disabled
+ *          (e.g. by a seccomp filter in a container).
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncRingSetup(OS_impl_file_uring_t *ring)
+{
+    struct io_uring_params params;
+    void *                 map;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->fd = syscall(__NR_io_uring_setup, OS_MAX_ASYNC_IO, &params);
+    if (ring->fd < 0)
+    {
+        OS_DEBUG("io_uring_setup: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+    {
+        OS_Posix_FileAsyncRingTeardown(ring);
+        return OS_ERROR;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + (params.sq_entries * sizeof(uint32));
+    ring->cq_ring_size = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ring->sqes_size    = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    /* Newer kernels allow both rings to be mapped at once */
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        if (ring->cq_ring_size > ring->sq_ring_size)
+        {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    map = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+               IORING_OFF_SQ_RING);
+    if (map == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        OS_Posix_FileAsyncRingTeardown(ring);
+        return OS_ERROR;
+    }
+    ring->sq_ring = map;
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else
+    {
+        map = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                   IORING_OFF_CQ_RING);
+        if (map == MAP_FAILED)
+        {
+            OS_DEBUG("mmap: %s\n", strerror(errno));
+            OS_Posix_FileAsyncRingTeardown(ring);
+            return OS_ERROR;
+        }
+        ring->cq_ring = map;
+    }
+
+    map = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (map == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        OS_Posix_FileAsyncRingTeardown(ring);
+        return OS_ERROR;
+    }
+    ring->sqes = map;
+
+    ring->sq_tail  = (atomic_uint *)((uint8 *)ring->sq_ring + params.sq_off.tail);
+    ring->sq_array = (uint32 *)((uint8 *)ring->sq_ring + params.sq_off.array);
+    ring->sq_mask  = *(uint32 *)((uint8 *)ring->sq_ring + params.sq_off.ring_mask);
+    ring->cq_head  = (atomic_uint *)((uint8 *)ring->cq_ring + params.cq_off.head);
+    ring->cq_tail  = (atomic_uint *)((uint8 *)ring->cq_ring + params.cq_off.tail);
+    ring->cqes     = (struct io_uring_cqe *)((uint8 *)ring->cq_ring + params.cq_off.cqes);
+    ring->cq_mask  = *(uint32 *)((uint8 *)ring->cq_ring + params.cq_off.ring_mask);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Hands an operation to the kernel.  As there are never more
+ *          operations in progress than entries in the rings, there is
+ *          always room for it.
+ *          Must be called with the lock of the file held.
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncRingSubmit(OS_impl_file_async_t *async, uint32 op_idx)
+{
+    OS_impl_file_uring_t *   ring;
+    OS_impl_file_async_op_t *op;
+    struct io_uring_sqe *    sqe;
+    uint32                   tail;
+    uint32                   sq_idx;
+    long                     ret;
+
+    ring   = &async->ring;
+    op     = &async->ops[op_idx];
+    tail   = atomic_load_explicit(ring->sq_tail, memory_order_relaxed);
+    sq_idx = tail & ring->sq_mask;
+    sqe    = &ring->sqes[sq_idx];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = (op->request.op == OS_ASYNC_OP_READ) ? IORING_OP_READ : IORING_OP_WRITE;
+    sqe->fd        = async->fd;
+    sqe->off       = op->request.offset;
+    sqe->addr      = (uintptr_t)op->request.buffer;
+    sqe->len       = op->request.nbytes;
+    sqe->user_data = op_idx;
+
+    ring->sq_array[sq_idx] = sq_idx;
+    atomic_store_explicit(ring->sq_tail, tail + 1, memory_order_release);
+
+    do
+    {
+        ret = syscall(__NR_io_uring_enter, ring->fd, 1, 0, 0, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret != 1)
+    {
+        /* The kernel did not take the entry, so take it back */
+        OS_DEBUG("io_uring_enter: %s\n", ret < 0 ? strerror(errno) : "not submitted");
+        atomic_store_explicit(ring->sq_tail, tail, memory_order_release);
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Moves all the completions posted by the kernel to the
+ *          completion list of the file.
+ *          Must be called with the lock of the file held.
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncRingReap(OS_impl_file_async_t *async)
+{
+    OS_impl_file_uring_t *     ring;
+    const struct io_uring_cqe *cqe;
+    uint32                     head;
+    uint32                     tail;
+
+    ring = &async->ring;
+    head = atomic_load_explicit(ring->cq_head, memory_order_relaxed);
+    tail = atomic_load_explicit(ring->cq_tail, memory_order_acquire);
+
+    while (head != tail)
+    {
+        cqe = &ring->cqes[head & ring->cq_mask];
+        OS_Posix_FileAsyncComplete(async, (uint32)cqe->user_data, cqe->res);
+        ++head;
+    }
+
+    atomic_store_explicit(ring->cq_head, head, memory_order_release);
+}
+
+#endif /* OS_IMPL_FILE_ASYNC_HAVE_IO_URING */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Waits for an operation on the file to complete, or for the
+ *          deadline (if not NULL).  This may return early, so the caller
+ *          must check the state of the file again.
+ *          Must be called with the lock of the file held.
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncWaitEvent(OS_impl_file_async_t *async, const struct timespec *deadline)
+{
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+    struct pollfd pfd;
+
+    if (async->ring.fd >= 0)
+    {
+        /* The io_uring file descriptor is readable while there are completions to reap */
+        pfd.fd      = async->ring.fd;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        pthread_mutex_unlock(&async->lock);
+        poll(&pfd, 1, OS_Posix_FileAsyncPollTimeout(deadline));
+        pthread_mutex_lock(&async->lock);
+        return;
+    }
+#endif
+
+    if (deadline == NULL)
+    {
+        pthread_cond_wait(&async->cond, &async->lock);
+    }
+    else
+    {
+        pthread_cond_timedwait(&async->cond, &async->lock, deadline);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Collects all completions which the kernel has posted.
+ *          Must be called with the lock of the file held.
+ *-----------------------------------------------------------------*/
+static inline void OS_Posix_FileAsyncUpdate(OS_impl_file_async_t *async)
+{
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+    if (async->ring.fd >= 0)
+    {
+        OS_Posix_FileAsyncRingReap(async);
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Creates the asynchronous I/O state for a file descriptor,
+ *          using io_uring if possible, or the thread pool otherwise.
+ *          Must be called with the pool lock held.
+ *-----------------------------------------------------------------*/
+static OS_impl_file_async_t *OS_Posix_FileAsyncCreate(int fd)
+{
+    OS_impl_file_async_t *async;
+    int32                 return_code;
+
+    async = malloc(sizeof(*async));
+    if (async == NULL)
+    {
+        OS_DEBUG("Cannot allocate asynchronous I/O state\n");
+        return NULL;
+    }
+
+    memset(async, 0, sizeof(*async));
+    async->fd = fd;
+
+    if (pthread_mutex_init(&async->lock, NULL) != 0)
+    {
+        free(async);
+        return NULL;
+    }
+
+    if (OS_Posix_CondInitMonotonic(&async->cond) != 0)
+    {
+        pthread_mutex_destroy(&async->lock);
+        free(async);
+        return NULL;
+    }
+
+    return_code = OS_ERROR;
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+    return_code = OS_Posix_FileAsyncRingSetup(&async->ring);
+#endif
+    if (return_code != OS_SUCCESS)
+    {
+        return_code = OS_Posix_FileAsyncPoolStart();
+    }
+
+    if (return_code != OS_SUCCESS)
+    {
+        pthread_cond_destroy(&async->cond);
+        pthread_mutex_destroy(&async->lock);
+        free(async);
+        return NULL;
+    }
+
+    return async;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Gets the asynchronous I/O state of a file, creating it if
+ *          it does not exist yet and "create" is set.  Returns NULL if
+ *          the state does not exist or could not be created.
+ *-----------------------------------------------------------------*/
+static OS_impl_file_async_t *OS_Posix_FileAsyncGet(OS_impl_file_internal_record_t *impl, bool create)
+{
+    OS_impl_file_async_t *async;
+
+    pthread_mutex_lock(&OS_impl_file_async_pool.lock);
+
+    async = impl->async;
+    if (async == NULL && create)
+    {
+        async       = OS_Posix_FileAsyncCreate(impl->fd);
+        impl->async = async;
+    }
+
+    pthread_mutex_unlock(&OS_impl_file_async_pool.lock);
+
+    return async;
+}
+
+/****************************************************************************************
+                            ASYNCHRONOUS FILE I/O API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncSubmit_Impl(const OS_object_token_t *token, const OS_async_request_t *request)
+{
+    OS_impl_file_internal_record_t *impl;
+    OS_impl_file_async_t *          async;
+    OS_impl_file_async_op_t *       op;
+    uint32                          op_idx;
+    int32                           return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    async = OS_Posix_FileAsyncGet(impl, true);
+    if (async == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    pthread_mutex_lock(&async->lock);
+
+    for (op_idx = 0; op_idx < OS_MAX_ASYNC_IO; ++op_idx)
+    {
+        if (async->ops[op_idx].state == OS_IMPL_FILE_ASYNC_OP_FREE)
+        {
+            break;
+        }
+    }
+
+    if (op_idx >= OS_MAX_ASYNC_IO)
+    {
+        return_code = OS_QUEUE_FULL;
+    }
+    else
+    {
+        op          = &async->ops[op_idx];
+        op->async   = async;
+        op->request = *request;
+        op->next    = NULL;
+        op->state   = OS_IMPL_FILE_ASYNC_OP_PENDING;
+        ++async->num_pending;
+
+        return_code = OS_SUCCESS;
+
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+        if (async->ring.fd >= 0)
+        {
+            return_code = OS_Posix_FileAsyncRingSubmit(async, op_idx);
+        }
+        else
+#endif
+        {
+            pthread_mutex_lock(&OS_impl_file_async_pool.lock);
+            if (OS_impl_file_async_pool.tail == NULL)
+            {
+                OS_impl_file_async_pool.head = op;
+            }
+            else
+            {
+                OS_impl_file_async_pool.tail->next = op;
+            }
+            OS_impl_file_async_pool.tail = op;
+            pthread_cond_signal(&OS_impl_file_async_pool.cond);
+            pthread_mutex_unlock(&OS_impl_file_async_pool.lock);
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            op->state = OS_IMPL_FILE_ASYNC_OP_FREE;
+            --async->num_pending;
+        }
+    }
+
+    pthread_mutex_unlock(&async->lock);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWaitCompletion_Impl(const OS_object_token_t *token, OS_async_completion_t *completion, int32 msecs)
+{
+    OS_impl_file_internal_record_t *impl;
+    OS_impl_file_async_t *          async;
+    OS_impl_file_async_op_t *       op;
+    struct timespec                 deadline;
+    int32                           return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* Nothing was ever submitted on this file */
+    async = OS_Posix_FileAsyncGet(impl, false);
+    if (async == NULL)
+    {
+        return OS_QUEUE_EMPTY;
+    }
+
+    if (msecs > 0)
+    {
+        OS_Posix_CompAbsDelayTime(msecs, &deadline);
+    }
+
+    pthread_mutex_lock(&async->lock);
+
+    while (true)
+    {
+        OS_Posix_FileAsyncUpdate(async);
+
+        if (async->done_count > 0)
+        {
+            op = &async->ops[async->done_list[async->done_head]];
+
+            completion->user_arg = op->request.user_arg;
+            completion->result   = op->result;
+            op->state            = OS_IMPL_FILE_ASYNC_OP_FREE;
+
+            async->done_head = (async->done_head + 1) % OS_MAX_ASYNC_IO;
+            --async->done_count;
+
+            return_code = OS_SUCCESS;
+            break;
+        }
+
+        if (async->num_pending == 0)
+        {
+            return_code = OS_QUEUE_EMPTY;
+            break;
+        }
+
+        if (msecs == 0 || (msecs > 0 && OS_Posix_DeadlineReached(&deadline)))
+        {
+            return_code = OS_ERROR_TIMEOUT;
+            break;
+        }
+
+        OS_Posix_FileAsyncWaitEvent(async, (msecs > 0) ? &deadline : NULL);
+    }
+
+    pthread_mutex_unlock(&async->lock);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncClose_Impl(const OS_object_token_t *token)
+{
+    OS_impl_file_internal_record_t *impl;
+    OS_impl_file_async_t *          async;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    async = OS_Posix_FileAsyncGet(impl, false);
+    if (async == NULL)
+    {
+        return OS_SUCCESS;
+    }
+
+    /* The buffers belong to the application, so every operation must be finished */
+    pthread_mutex_lock(&async->lock);
+    while (true)
+    {
+        OS_Posix_FileAsyncUpdate(async);
+        if (async->num_pending == 0)
+        {
+            break;
+        }
+        OS_Posix_FileAsyncWaitEvent(async, NULL);
+    }
+    pthread_mutex_unlock(&async->lock);
+
+#ifdef OS_IMPL_FILE_ASYNC_HAVE_IO_URING
+    if (async->ring.fd >= 0)
+    {
+        OS_Posix_FileAsyncRingTeardown(&async->ring);
+    }
+#endif
+
+    pthread_mutex_lock(&OS_impl_file_async_pool.lock);
+    impl->async = NULL;
+    pthread_mutex_unlock(&OS_impl_file_async_pool.lock);
+
+    pthread_cond_destroy(&async->cond);
+    pthread_mutex_destroy(&async->lock);
+    free(async);
+
+    return OS_SUCCESS;
+}
@@ -27,8 +27,15 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+/*
+ * copy_file_range() is not exposed by the X/Open feature set selected by
+ * the BSP, so this needs the GNU feature set.
+ */
+#define _GNU_SOURCE
+
 #include <fcntl.h>
 #include <dirent.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -36,6 +43,36 @@
 #include "os-posix.h"
 #include "os-impl-files.h"
 #include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+/*
+ * copy_file_range() is available on Linux since glibc 2.27.  Elsewhere,
+ * ranges are always copied through a buffer with pread()/pwrite().
+ */
+#if defined(__linux__) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define OS_IMPL_FILES_HAVE_COPY_FILE_RANGE
+#endif
+
+/*
+ * Limits on the size of the buffer used to copy a range of a file when it
+ * cannot be done in the kernel.  The buffer is sized to fit the range being
+ * copied, so small files do not pay for a large allocation and large files
+ * are copied with few system calls.
+ */
+#define OS_IMPL_FILE_COPY_MIN_BUFFER 4096
+#define OS_IMPL_FILE_COPY_MAX_BUFFER (1024 * 1024)
+
+/*
+ * Size of the local buffer used if the copy buffer cannot be allocated
+ */
+#define OS_IMPL_FILE_COPY_STACK_BUFFER 512
+
+/*
+ * The most that is asked of the kernel in a single copy_file_range() call.
+ * It will copy less than this anyway, but this keeps the count within the
+ * range of ssize_t on all platforms.
+ */
+#define OS_IMPL_FILE_COPY_MAX_CHUNK 0x40000000
 
 /****************************************************************************************
                                      GLOBALS
@@ -99,3 +136,293 @@ int32 OS_Posix_StreamAPI_Impl_Init(void)
 
     return OS_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Helper function to copy a range of a file through a buffer in memory,
+ * using positional reads and writes.  This is used when the kernel cannot
+ * copy the range directly, for instance between different file systems.
+ *
+ * The "copied" output is updated as data is written.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileCopyBuffered(int src_fd, off_t src_pos, int dst_fd, off_t dst_pos, osal_offset_t len,
+                                       osal_offset_t *copied)
+{
+    uint8         stack_buffer[OS_IMPL_FILE_COPY_STACK_BUFFER];
+    uint8 *       buffer;
+    size_t        buffer_size;
+    size_t        chunk;
+    size_t        wr_total;
+    ssize_t       rd_size;
+    ssize_t       wr_size;
+    osal_offset_t remaining;
+    struct stat   st;
+    int32         return_code;
+
+    /* size the buffer to the amount left to copy, within limits */
+    if (len >= 0)
+    {
+        remaining = len - *copied;
+    }
+    else if (fstat(src_fd, &st) == 0 && st.st_size > src_pos)
+    {
+        remaining = st.st_size - src_pos;
+    }
+    else
+    {
+        remaining = 0;
+    }
+
+    if (remaining < OS_IMPL_FILE_COPY_MIN_BUFFER)
+    {
+        buffer_size = OS_IMPL_FILE_COPY_MIN_BUFFER;
+    }
+    else if (remaining > OS_IMPL_FILE_COPY_MAX_BUFFER)
+    {
+        buffer_size = OS_IMPL_FILE_COPY_MAX_BUFFER;
+    }
+    else
+    {
+        buffer_size = remaining;
+    }
+
+    buffer = malloc(buffer_size);
+    if (buffer == NULL)
+    {
+        buffer      = stack_buffer;
+        buffer_size = sizeof(stack_buffer);
+    }
+
+    return_code = OS_SUCCESS;
+    while (return_code == OS_SUCCESS && (len < 0 || *copied < len))
+    {
+        chunk = buffer_size;
+        if (len >= 0 && (len - *copied) < (osal_offset_t)chunk)
+        {
+            chunk = len - *copied;
+        }
+
+        rd_size = pread(src_fd, buffer, chunk, src_pos);
+        if (rd_size < 0)
+        {
+            if (errno != EINTR)
+            {
+                OS_DEBUG("pread: %s\n", strerror(errno));
+                return_code = OS_ERROR;
+            }
+            continue;
+        }
+        if (rd_size == 0)
+        {
+            break;
+        }
+
+        wr_total = 0;
+        while (wr_total < (size_t)rd_size)
+        {
+            wr_size = pwrite(dst_fd, &buffer[wr_total], rd_size - wr_total, dst_pos);
+            if (wr_size < 0)
+            {
+                if (errno != EINTR)
+                {
+                    OS_DEBUG("pwrite: %s\n", strerror(errno));
+                    return_code = OS_ERROR;
+                    break;
+                }
+                continue;
+            }
+
+            wr_total += wr_size;
+            dst_pos += wr_size;
+            *copied += wr_size;
+        }
+
+        src_pos += wr_total;
+    }
+
+    if (buffer != stack_buffer)
+    {
+        free(buffer);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, osal_offset_t src_off,
+                            const OS_object_token_t *dst_token, osal_offset_t dst_off, osal_offset_t len,
+                            osal_offset_t *copied)
+{
+    OS_impl_file_internal_record_t *src_impl;
+    OS_impl_file_internal_record_t *dst_impl;
+    off_t                           src_pos;
+    off_t                           dst_pos;
+
+    src_impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *src_token);
+    dst_impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *dst_token);
+
+    *copied = 0;
+    src_pos = src_off;
+    dst_pos = dst_off;
+
+    /* the offsets may not fit if off_t is only 32 bits */
+    if (src_pos != src_off || dst_pos != dst_off)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+#ifdef OS_IMPL_FILES_HAVE_COPY_FILE_RANGE
+    {
+        size_t  chunk;
+        ssize_t os_result;
+
+        /*
+         * The kernel updates both positions as it goes, so if it turns out
+         * it cannot do the copy, the buffered copy picks up where it stopped.
+         */
+        while (len < 0 || *copied < len)
+        {
+            chunk = OS_IMPL_FILE_COPY_MAX_CHUNK;
+            if (len >= 0 && (len - *copied) < (osal_offset_t)chunk)
+            {
+                chunk = len - *copied;
+            }
+
+            os_result = copy_file_range(src_impl->fd, &src_pos, dst_impl->fd, &dst_pos, chunk, 0);
+            if (os_result == 0)
+            {
+                return OS_SUCCESS;
+            }
+            if (os_result > 0)
+            {
+                *copied += os_result;
+            }
+            else if (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP ||
+                     errno == EBADF)
+            {
+                /* not possible for these files, so copy through a buffer */
+                break;
+            }
+            else if (errno != EINTR)
+            {
+                OS_DEBUG("copy_file_range: %s\n", strerror(errno));
+                return OS_ERROR;
+            }
+        }
+
+        if (len >= 0 && *copied >= len)
+        {
+            return OS_SUCCESS;
+        }
+    }
+#endif
+
+    return OS_Posix_FileCopyBuffered(src_impl->fd, src_pos, dst_impl->fd, dst_pos, len, copied);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, osal_offset_t offset, size_t len, uint32 access,
+                      OS_file_mapping_t *mapping)
+{
+    OS_impl_file_internal_record_t *impl;
+    struct stat                     st;
+    long                            page_size;
+    off_t                           base_offset;
+    size_t                          size;
+    int                             prot;
+    void *                          base;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * Accessing a mapping beyond the end of the file raises SIGBUS,
+     * so the range is checked against the file size here.
+     */
+    if (fstat(impl->fd, &st) < 0)
+    {
+        OS_DEBUG("fstat: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (offset < 0 || offset > st.st_size || len > (size_t)(st.st_size - offset))
+    {
+        return OS_ERR_INVALID_SIZE;
+    }
+
+    /* mmap() requires the offset to be a multiple of the page size */
+    page_size   = sysconf(_SC_PAGESIZE);
+    base_offset = offset - (offset % page_size);
+    size        = len + (offset - base_offset);
+
+    prot = 0;
+    if ((access & OS_FILE_MAP_READ) != 0)
+    {
+        prot |= PROT_READ;
+    }
+    if ((access & OS_FILE_MAP_WRITE) != 0)
+    {
+        prot |= PROT_WRITE;
+    }
+
+    base = mmap(NULL, size, prot, MAP_SHARED, impl->fd, base_offset);
+    if (base == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* The hints are only advice, so failures are not reported */
+    if ((access & OS_FILE_MAP_SEQUENTIAL) != 0)
+    {
+        posix_madvise(base, size, POSIX_MADV_SEQUENTIAL);
+    }
+    if ((access & OS_FILE_MAP_WILLNEED) != 0)
+    {
+        posix_madvise(base, size, POSIX_MADV_WILLNEED);
+    }
+
+    mapping->base   = base;
+    mapping->size   = size;
+    mapping->addr   = (uint8 *)base + (offset - base_offset);
+    mapping->access = access;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, OS_file_mapping_t *mapping)
+{
+    int32 return_code;
+
+    return_code = OS_SUCCESS;
+
+    if ((mapping->access & OS_FILE_MAP_WRITE) != 0 && msync(mapping->base, mapping->size, MS_SYNC) < 0)
+    {
+        OS_DEBUG("msync: %s\n", strerror(errno));
+        return_code = OS_ERROR;
+    }
+
+    if (munmap(mapping->base, mapping->size) < 0)
+    {
+        OS_DEBUG("munmap: %s\n", strerror(errno));
+        return_code = OS_ERROR;
+    }
+
+    return return_code;
+}
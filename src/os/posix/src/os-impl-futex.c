@@ -0,0 +1,115 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * syscall() is not exposed by the X/Open feature set selected by the BSP,
+ * so this also needs the glibc default (BSD/SVID) feature set.
+ */
+#define _DEFAULT_SOURCE
+
+#include "os-posix.h"
+
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/****************************************************************************************
+                                  FUTEX WRAPPERS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Blocks the calling thread while the value of the futex word is equal
+ * to expected_value, until woken by OS_Posix_FutexWake() or until the
+ * absolute (CLOCK_MONOTONIC) time in abstime is reached.  If abstime
+ * is NULL the wait is indefinite.
+ *
+ * Returns OS_SUCCESS if woken, interrupted, or if the value of the
+ * futex word was already different than expected_value.  The caller
+ * must always re-check its condition after this returns.
+ * Returns OS_ERROR_TIMEOUT if the time expired.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FutexWait(atomic_uint *futex_word, uint32 expected_value, const struct timespec *abstime)
+{
+    long  status;
+    int   saved_errno;
+    int   old_cancel_type;
+    int32 return_code;
+
+    /*
+     * Unlike the blocking calls in the C library, a raw system call is not a
+     * cancellation point, so a task blocked here could not be deleted.  Enable
+     * asynchronous cancellation for the duration of the wait to make it behave
+     * like one.  Callers should use pthread_cleanup_push() if they need to undo
+     * anything in case the task is deleted while waiting.
+     *
+     * FUTEX_WAIT_BITSET is used rather than FUTEX_WAIT because it accepts
+     * an absolute time.  Without FUTEX_CLOCK_REALTIME the time is relative to
+     * CLOCK_MONOTONIC, consistent with OS_Posix_CompAbsDelayTime().
+     */
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &old_cancel_type);
+    status = syscall(SYS_futex, futex_word, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, expected_value, abstime, NULL,
+                     FUTEX_BITSET_MATCH_ANY);
+    saved_errno = errno;
+    pthread_setcanceltype(old_cancel_type, NULL);
+    errno = saved_errno;
+
+    if (status == 0 || errno == EAGAIN || errno == EINTR)
+    {
+        return_code = OS_SUCCESS;
+    }
+    else if (errno == ETIMEDOUT)
+    {
+        return_code = OS_ERROR_TIMEOUT;
+    }
+    else
+    {
+        OS_DEBUG("futex(FUTEX_WAIT_BITSET): %s\n", strerror(errno));
+        return_code = OS_ERROR;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Wakes up to num_waiters threads blocked in OS_Posix_FutexWait()
+ * on the same futex word.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(atomic_uint *futex_word, uint32 num_waiters)
+{
+    if (syscall(SYS_futex, futex_word, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, num_waiters, NULL, NULL, 0) < 0)
+    {
+        OS_DEBUG("futex(FUTEX_WAKE): %s\n", strerror(errno));
+    }
+}
@@ -30,6 +30,13 @@
 #include "os-posix.h"
 #include "os-shared-heap.h"
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#if __GLIBC_PREREQ(2, 33)
+#define OS_IMPL_HAVE_MALLINFO2
+#endif
+#endif
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -38,8 +45,24 @@
  *-----------------------------------------------------------------*/
 int32 OS_HeapGetInfo_Impl(OS_heap_prop_t *heap_prop)
 {
+#ifdef OS_IMPL_HAVE_MALLINFO2
+    struct mallinfo2 info;
+
+    info = mallinfo2();
+
+    /*
+     * glibc does not report the size of the largest free chunk, so
+     * it is left as 0 (unknown).
+     */
+    heap_prop->free_bytes         = info.fordblks;
+    heap_prop->free_blocks        = OSAL_BLOCKCOUNT_C(info.ordblks + info.smblks);
+    heap_prop->largest_free_block = 0;
+
+    return OS_SUCCESS;
+#else
     /*
-    ** Not implemented yet
+    ** Not implemented for this C library
     */
     return OS_ERR_NOT_IMPLEMENTED;
+#endif
 }
@@ -47,6 +47,10 @@ static OS_impl_objtype_lock_t OS_module_table_lock;
 static OS_impl_objtype_lock_t OS_filesys_table_lock;
 static OS_impl_objtype_lock_t OS_console_lock;
 static OS_impl_objtype_lock_t OS_condvar_lock;
+static OS_impl_objtype_lock_t OS_poller_lock;
+static OS_impl_objtype_lock_t OS_mempool_lock;
+
+CompileTimeAssert(sizeof(OS_impl_objtype_lock_t) % OS_CACHE_LINE_SIZE == 0, ObjTypeLockSize);
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -63,17 +67,10 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
     [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_lock,
     [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_lock,
+    [OS_OBJECT_TYPE_OS_POLLER]   = &OS_poller_lock,
+    [OS_OBJECT_TYPE_OS_MEMPOOL]  = &OS_mempool_lock,
 };
 
-/*---------------------------------------------------------------------------------------
- * Helper function for releasing the mutex in case the thread
- * executing pthread_condwait() is canceled.
- ----------------------------------------------------------------------------------------*/
-void OS_Posix_ReleaseTableMutex(void *mut)
-{
-    pthread_mutex_unlock(mut);
-}
-
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -112,14 +109,6 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
 
     if (impl != NULL)
     {
-        /* Notify any waiting threads that the state _may_ have changed */
-        ret = pthread_cond_broadcast(&impl->cond);
-        if (ret != 0)
-        {
-            OS_DEBUG("pthread_cond_broadcast(&impl->cond): %s", strerror(ret));
-            /* unexpected but keep going (not critical) */
-        }
-
         ret = pthread_mutex_unlock(&impl->mutex);
         if (ret != 0)
         {
@@ -134,21 +123,11 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq, uint32 attempts)
 {
-    OS_impl_objtype_lock_t *impl;
-    struct timespec         ts;
+    struct timespec ts;
 
-    impl = OS_impl_objtype_lock_table[objtype];
-
-    /*
-     * because pthread_cond_timedwait() is also a cancellation point,
-     * this pushes a cleanup handler to ensure that if canceled during this call,
-     * the mutex will be released.
-     */
-    pthread_cleanup_push(OS_Posix_ReleaseTableMutex, &impl->mutex);
-
-    clock_gettime(CLOCK_REALTIME, &ts);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
 
     if (attempts <= 10)
     {
@@ -166,9 +145,26 @@ void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
         ++ts.tv_sec;
     }
 
-    pthread_cond_timedwait(&impl->cond, &impl->mutex, &ts);
+    /*
+     * The futex only blocks if the state word still holds state_seq, so a
+     * change made after the table is unlocked here is not missed.  Because
+     * the table is not locked while waiting, nothing needs to be released
+     * if the task is canceled.
+     */
+    OS_Unlock_Global_Impl(objtype);
+    OS_Posix_FutexWait(state_word, state_seq, &ts);
+    OS_Lock_Global_Impl(objtype);
+}
 
-    pthread_cleanup_pop(false);
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word)
+{
+    OS_Posix_FutexWake(state_word, INT_MAX);
 }
 
 /*---------------------------------------------------------------------------------------
@@ -234,16 +230,6 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype)
             return_code = OS_ERROR;
             break;
         }
-
-        /* create a condition variable with default attributes.
-         * This will be broadcast every time the object table changes */
-        ret = pthread_cond_init(&impl->cond, NULL);
-        if (ret != 0)
-        {
-            OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
-            return_code = OS_ERROR;
-            break;
-        }
     } while (0);
 
     return return_code;
@@ -0,0 +1,186 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Waiting for a block uses a futex on the free block count of the pool,
+ * which is maintained by the shared layer.  The system call is only made
+ * if a task actually needs to block, or if there is a task to wake up.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * sched_getcpu() is not exposed by the X/Open feature set selected by
+ * the BSP, so this needs the GNU feature set.
+ */
+#define _GNU_SOURCE
+
+#include "os-posix.h"
+#include "os-impl-mempool.h"
+#include "os-shared-mempool.h"
+#include "os-shared-idmap.h"
+
+#include <sched.h>
+
+/* Tables where the OS object information is stored */
+OS_impl_mempool_internal_record_t OS_impl_mempool_table[OS_MAX_MEMPOOLS];
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for when a task stops waiting on a pool, including if the
+ * task is canceled while waiting.
+ *
+ * Every waiter is woken when a block becomes available, so unlike a binary
+ * semaphore there is no wakeup to pass on here.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_MemPoolWaitDone(void *arg)
+{
+    OS_impl_mempool_internal_record_t *impl = arg;
+
+    atomic_fetch_sub(&impl->num_waiters, 1);
+}
+
+/****************************************************************************************
+                                  MEMORY POOL API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_MemPoolAPI_Impl_Init(void)
+{
+    memset(OS_impl_mempool_table, 0, sizeof(OS_impl_mempool_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolCreate_Impl(const OS_object_token_t *token)
+{
+    OS_impl_mempool_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mempool_table, *token);
+
+    atomic_store(&impl->num_waiters, 0);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolDelete_Impl(const OS_object_token_t *token)
+{
+    /* Nothing to release, the futex is just a word in the shared record */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_timeout)
+{
+    OS_impl_mempool_internal_record_t *impl;
+    OS_mempool_internal_record_t *     pool;
+    struct timespec                    ts;
+    struct timespec *                  ts_ptr;
+    int32                              return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mempool_table, *token);
+    pool = OS_OBJECT_TABLE_GET(OS_mempool_table, *token);
+
+    /* The shared layer computes the timeout from OS_GetMonotonicTime_Impl(), the same clock as the futex */
+    if (abs_timeout != NULL)
+    {
+        ts.tv_sec  = OS_TimeGetTotalSeconds(*abs_timeout);
+        ts.tv_nsec = OS_TimeGetNanosecondsPart(*abs_timeout);
+        ts_ptr     = &ts;
+    }
+    else
+    {
+        ts_ptr = NULL;
+    }
+
+    /*
+     * The waiter count must be incremented before the futex checks the free
+     * count, so that a task which makes a block available either sees this
+     * task waiting, or the futex sees that the count is no longer zero.
+     */
+    atomic_fetch_add(&impl->num_waiters, 1);
+    pthread_cleanup_push(OS_Posix_MemPoolWaitDone, impl);
+
+    return_code = OS_Posix_FutexWait(&pool->free_count, 0, ts_ptr);
+
+    pthread_cleanup_pop(1);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_MemPoolWake_Impl(const OS_object_token_t *token)
+{
+    OS_impl_mempool_internal_record_t *impl;
+    OS_mempool_internal_record_t *     pool;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mempool_table, *token);
+    pool = OS_OBJECT_TABLE_GET(OS_mempool_table, *token);
+
+    if (atomic_load(&impl->num_waiters) != 0)
+    {
+        OS_Posix_FutexWake(&pool->free_count, INT_MAX);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_MemPoolGetCpu_Impl(void)
+{
+    int cpu;
+
+    cpu = sched_getcpu();
+    if (cpu < 0)
+    {
+        cpu = 0;
+    }
+
+    return cpu;
+}
@@ -35,6 +35,8 @@
 /* Tables where the OS object information is stored */
 OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
 
+CompileTimeAssert(sizeof(OS_impl_mutex_internal_record_t) % OS_CACHE_LINE_SIZE == 0, MutexRecordSize);
+
 /****************************************************************************************
                                   MUTEX API
  ***************************************************************************************/
@@ -0,0 +1,270 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Poller objects are implemented on top of the Linux epoll facility.  The
+ * interest set lives in the kernel, so each wait only costs in proportion
+ * to the number of ready file handles.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-poller.h"
+#include "os-shared-clock.h"
+#include "os-shared-poller.h"
+#include "os-shared-idmap.h"
+
+/* Tables where the OS object information is stored */
+OS_impl_poller_internal_record_t OS_impl_poller_table[OS_MAX_POLLERS];
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Convert an absolute timeout into an epoll_wait() timeout,
+ *          rounding up so the wait does not end before the deadline.
+ *-----------------------------------------------------------------*/
+static int OS_Posix_PollerTimeout(OS_time_t abs_timeout)
+{
+    OS_time_t curr_time;
+    int64     usec;
+
+    /* Implementations may pass OS_TIME_MAX to mean wait forever */
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        return -1;
+    }
+
+    /* All non-positive time values are in the past, no need to read the clock */
+    if (OS_TimeGetSign(abs_timeout) <= 0)
+    {
+        return 0;
+    }
+
+    OS_GetLocalTime_Impl(&curr_time);
+    usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(abs_timeout, curr_time));
+    if (usec <= 0)
+    {
+        return 0;
+    }
+    if (usec >= ((int64)INT32_MAX * 1000))
+    {
+        return INT32_MAX;
+    }
+
+    return (int)((usec + 999) / 1000);
+}
+
+/****************************************************************************************
+                                  POLLER API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_PollerAPI_Impl_Init(void)
+{
+    memset(OS_impl_poller_table, 0, sizeof(OS_impl_poller_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_poller_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    impl->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->epoll_fd < 0)
+    {
+        OS_DEBUG("Error: Poller could not be created. ID = %lu: %s\n",
+                 OS_ObjectIdToInteger(OS_ObjectIdFromToken(token)), strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_poller_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    close(impl->epoll_fd);
+    impl->epoll_fd = -1;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags)
+{
+    OS_impl_poller_internal_record_t *impl;
+    OS_impl_file_internal_record_t   *stream;
+    struct epoll_event                ev;
+    int                               status;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    /*
+     * If called on a stream_id which does not support this
+     * operation, return immediately and do not invoke the system call
+     */
+    if (!stream->selectable)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        ev.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        ev.events |= EPOLLOUT;
+    }
+
+    /* The OSAL ID is kept with the entry, so no lookup is needed when it becomes ready */
+    ev.data.u64 = OS_ObjectIdToInteger(OS_ObjectIdFromToken(stream_token));
+
+    status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_ADD, stream->fd, &ev);
+    if (status < 0 && errno == EEXIST)
+    {
+        status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_MOD, stream->fd, &ev);
+    }
+    if (status < 0)
+    {
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    OS_impl_poller_internal_record_t *impl;
+    OS_impl_file_internal_record_t   *stream;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (epoll_ctl(impl->epoll_fd, EPOLL_CTL_DEL, stream->fd, NULL) < 0)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+                         uint32 *num_events, OS_time_t abs_timeout)
+{
+    OS_impl_poller_internal_record_t *impl;
+    struct epoll_event                evbuf[OS_MAX_NUM_OPEN_FILES];
+    int                               os_status;
+    int                               i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    /* There can never be more ready handles than there are file handles */
+    if (max_events > OS_MAX_NUM_OPEN_FILES)
+    {
+        max_events = OS_MAX_NUM_OPEN_FILES;
+    }
+
+    do
+    {
+        os_status = epoll_wait(impl->epoll_fd, evbuf, max_events, OS_Posix_PollerTimeout(abs_timeout));
+    } while (os_status < 0 && errno == EINTR);
+
+    if (os_status < 0)
+    {
+        OS_DEBUG("epoll_wait: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < os_status; ++i)
+    {
+        events[i].objid      = OS_ObjectIdFromInteger((unsigned long)evbuf[i].data.u64);
+        events[i].StateFlags = 0;
+
+        /* Error and hangup conditions are reported as readable, the same as select() does */
+        if (evbuf[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+        {
+            events[i].StateFlags |= OS_STREAM_STATE_READABLE;
+        }
+        if (evbuf[i].events & EPOLLOUT)
+        {
+            events[i].StateFlags |= OS_STREAM_STATE_WRITABLE;
+        }
+    }
+
+    *num_events = os_status;
+
+    return OS_SUCCESS;
+}
@@ -37,6 +37,411 @@
 /* Tables where the OS object information is stored */
 OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+CompileTimeAssert(sizeof(OS_impl_queue_ring_t) % OS_CACHE_LINE_SIZE == 0, QueueRingSize);
+
+/****************************************************************************************
+                                USER-SPACE QUEUE HELPERS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot of a user-space queue for the given put/get position
+ *
+ *-----------------------------------------------------------------*/
+static inline OS_impl_queue_slot_t *OS_Posix_QueueRingSlot(OS_impl_queue_ring_t *ring, uint_fast64_t pos)
+{
+    return (OS_impl_queue_slot_t *)(void *)&ring->slots[(pos % ring->depth) * ring->slot_size];
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Allocates and initializes a user-space queue
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingCreate(OS_impl_queue_internal_record_t *impl, const OS_queue_internal_record_t *queue)
+{
+    OS_impl_queue_ring_t *ring;
+    void *                mem;
+    size_t                slot_size;
+    size_t                i;
+
+    if (queue->max_depth == 0)
+    {
+        OS_DEBUG("OS_QueueCreate Error: user-space queue depth must be nonzero\n");
+        return OS_ERROR;
+    }
+
+    /* Each slot is a header plus the message data, rounded up to keep the headers aligned */
+    slot_size = sizeof(OS_impl_queue_slot_t) + queue->max_size;
+    slot_size = (slot_size + sizeof(OS_impl_queue_slot_t) - 1) & ~(sizeof(OS_impl_queue_slot_t) - 1);
+
+    /* The ring must be aligned to a cache line for its layout to be effective */
+    if (posix_memalign(&mem, OS_CACHE_LINE_SIZE, sizeof(*ring) + (queue->max_depth * slot_size)) != 0)
+    {
+        OS_DEBUG("OS_QueueCreate Error: cannot allocate user-space queue\n");
+        return OS_ERROR;
+    }
+
+    ring = mem;
+
+    memset(ring, 0, sizeof(*ring));
+    ring->depth     = queue->max_depth;
+    ring->slot_size = slot_size;
+    ring->slots     = (uint8 *)&ring[1];
+
+    atomic_init(&ring->put_pos, 0);
+    atomic_init(&ring->get_pos, 0);
+    atomic_init(&ring->put_count, 0);
+    atomic_init(&ring->num_waiters, 0);
+    atomic_init(&ring->deleting, 0);
+
+    /* Initially each slot is ready to be filled by the put at the same position */
+    for (i = 0; i < ring->depth; ++i)
+    {
+        atomic_init(&OS_Posix_QueueRingSlot(ring, i)->sequence, i);
+        atomic_init(&OS_Posix_QueueRingSlot(ring, i)->owner, OS_IMPL_QUEUE_SLOT_QUEUED);
+    }
+
+    impl->ring = ring;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Claims up to max_count consecutive slots of a user-space queue
+ *           to put messages into, never blocks
+ *
+ *  Returns: The number of slots claimed, starting at *pos_out, or 0 if full
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_QueueRingClaimPutRange(OS_impl_queue_ring_t *ring, uint32 max_count, uint_fast64_t *pos_out)
+{
+    uint_fast64_t pos;
+    uint_fast64_t seq;
+    uint32        count;
+
+    /*
+     * Claim the slots from the current put position.  A slot is only available if its
+     * sequence number equals the position, otherwise it still holds a message from the
+     * previous trip around the ring (queue is full) or another task claimed it first.
+     */
+    pos = atomic_load_explicit(&ring->put_pos, memory_order_relaxed);
+    while (true)
+    {
+        for (count = 0; count < max_count; ++count)
+        {
+            seq = atomic_load_explicit(&OS_Posix_QueueRingSlot(ring, pos + count)->sequence, memory_order_acquire);
+            if (seq != pos + count)
+            {
+                break;
+            }
+        }
+
+        if (count != 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&ring->put_pos, &pos, pos + count, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if ((int64)(seq - pos) < 0)
+        {
+            return 0;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&ring->put_pos, memory_order_relaxed);
+        }
+    }
+
+    *pos_out = pos;
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Claims the next slot of a user-space queue to put a message into, never blocks
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimPut(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t **slot_out)
+{
+    uint_fast64_t pos;
+
+    if (OS_Posix_QueueRingClaimPutRange(ring, 1, &pos) == 0)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    *slot_out = OS_Posix_QueueRingSlot(ring, pos);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Makes the message in a slot claimed for putting available to getters
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingPublish(OS_impl_queue_slot_t *slot)
+{
+    /* the sequence of a claimed slot is the put position, and becomes one more than that when full */
+    atomic_fetch_add_explicit(&slot->sequence, 1, memory_order_release);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Wakes getters waiting for the given number of newly published messages
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingNotify(OS_impl_queue_ring_t *ring, uint32 count)
+{
+    /*
+     * Only make the system call to wake a getter if one is (or is about to be) waiting.
+     * Getters increment num_waiters before waiting, and the wait itself fails if
+     * put_count has changed, so a getter cannot miss a message.
+     */
+    atomic_fetch_add(&ring->put_count, count);
+    if (atomic_load(&ring->num_waiters) != 0)
+    {
+        OS_Posix_FutexWake(&ring->put_count, count);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Makes a slot claimed for getting available to putters again
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingRelease(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t *slot)
+{
+    /* release the slot to the put that is one full trip around the ring from the get position */
+    atomic_fetch_add_explicit(&slot->sequence, ring->depth - 1, memory_order_release);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Claims up to max_count consecutive slots of a user-space queue
+ *           to get messages from, never blocks
+ *
+ *  Returns: The number of slots claimed, starting at *pos_out, or 0 if empty
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_QueueRingTryClaimGetRange(OS_impl_queue_ring_t *ring, uint32 max_count, uint_fast64_t *pos_out)
+{
+    OS_impl_queue_slot_t *slot;
+    uint_fast64_t         pos;
+    uint_fast64_t         seq;
+    uint32                count;
+
+    /*
+     * Claim the slots from the current get position.  A slot has a message
+     * in it if the sequence number is one more than the position, and it
+     * was not published by a cancelled reservation.
+     */
+    pos = atomic_load_explicit(&ring->get_pos, memory_order_relaxed);
+    while (true)
+    {
+        for (count = 0; count < max_count; ++count)
+        {
+            slot = OS_Posix_QueueRingSlot(ring, pos + count);
+            seq  = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+            if (seq != pos + count + 1 || atomic_load(&slot->owner) == OS_IMPL_QUEUE_SLOT_CANCELLED)
+            {
+                break;
+            }
+        }
+
+        if (count != 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&ring->get_pos, &pos, pos + count, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (seq == pos + 1)
+        {
+            /* the first slot is a cancelled reservation, so claim it and make it available to putters again */
+            if (atomic_compare_exchange_weak_explicit(&ring->get_pos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                atomic_store(&slot->owner, OS_IMPL_QUEUE_SLOT_QUEUED);
+                OS_Posix_QueueRingRelease(ring, slot);
+                pos = atomic_load_explicit(&ring->get_pos, memory_order_relaxed);
+            }
+        }
+        else if ((int64)(seq - (pos + 1)) < 0)
+        {
+            return 0;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&ring->get_pos, memory_order_relaxed);
+        }
+    }
+
+    *pos_out = pos;
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Un-registers a task waiting on a user-space queue
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingWaitDone(void *arg)
+{
+    OS_impl_queue_ring_t *ring = arg;
+
+    atomic_fetch_sub(&ring->num_waiters, 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases the reference to the queue held by the shared layer,
+ *           if the task is deleted while blocked getting a message.
+ *           Otherwise the queue could never be deleted.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueReleaseRef(void *arg)
+{
+    OS_object_token_t token = *(const OS_object_token_t *)arg;
+
+    OS_ObjectIdRelease(&token);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Claims up to max_count consecutive slots of a user-space queue
+ *           to get messages from, blocking if empty
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimGetRange(OS_impl_queue_ring_t *ring, uint32 max_count, uint_fast64_t *pos_out,
+                                             uint32 *count_out, int32 timeout)
+{
+    int32                  return_code;
+    uint32                 put_count;
+    struct timespec        ts;
+    const struct timespec *abstime;
+
+    if (timeout == OS_PEND || timeout == OS_CHECK)
+    {
+        abstime = NULL;
+    }
+    else
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+        abstime = &ts;
+    }
+
+    while (true)
+    {
+        /* this must be read before checking the queue, as the futex will not block if it changed since */
+        put_count = atomic_load(&ring->put_count);
+
+        *count_out = OS_Posix_QueueRingTryClaimGetRange(ring, max_count, pos_out);
+        if (*count_out != 0)
+        {
+            return_code = OS_SUCCESS;
+            break;
+        }
+
+        if (timeout == OS_CHECK)
+        {
+            return_code = OS_QUEUE_EMPTY;
+            break;
+        }
+
+        if (atomic_load(&ring->deleting) != 0)
+        {
+            /* the queue is about to be deleted, so the caller must let go of it */
+            return_code = OS_ERR_INVALID_ID;
+            break;
+        }
+
+        /*
+         * The wait is a cancellation point, so this pushes a cleanup handler
+         * to ensure the waiter count is corrected if the task is deleted.
+         */
+        atomic_fetch_add(&ring->num_waiters, 1);
+        pthread_cleanup_push(OS_Posix_QueueRingWaitDone, ring);
+        return_code = OS_Posix_FutexWait(&ring->put_count, put_count, abstime);
+        pthread_cleanup_pop(true);
+
+        if (return_code == OS_ERROR_TIMEOUT)
+        {
+            return_code = OS_QUEUE_TIMEOUT;
+            break;
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Claims the next slot of a user-space queue to get a message from, blocking if empty
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimGet(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t **slot_out, int32 timeout)
+{
+    int32         return_code;
+    uint_fast64_t pos;
+    uint32        count;
+
+    return_code = OS_Posix_QueueRingClaimGetRange(ring, 1, &pos, &count, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        *slot_out = OS_Posix_QueueRingSlot(ring, pos);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot of a user-space queue holding the given message data
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingLookup(OS_impl_queue_ring_t *ring, const void *data, OS_impl_queue_slot_t **slot_out)
+{
+    cpuaddr offset;
+
+    /* the data must be at the start of a slot's message area, immediately after the header */
+    offset = (cpuaddr)data - (cpuaddr)ring->slots;
+    if ((cpuaddr)data < (cpuaddr)ring->slots || offset >= (ring->depth * ring->slot_size) ||
+        (offset % ring->slot_size) != sizeof(OS_impl_queue_slot_t))
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    *slot_out = (OS_impl_queue_slot_t *)(void *)&ring->slots[offset - sizeof(OS_impl_queue_slot_t)];
+
+    return OS_SUCCESS;
+}
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -89,6 +494,21 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+    impl->ring = NULL;
+
+    /*
+     * Select a user-space queue if requested by flags, or by default
+     * per the build configuration if not overridden by flags.
+     */
+#ifdef OSAL_CONFIG_QUEUE_USERSPACE
+    if ((flags & OS_QUEUE_FLAG_USERSPACE) != 0 || (flags & OS_QUEUE_FLAG_SYSTEM) == 0)
+#else
+    if ((flags & OS_QUEUE_FLAG_USERSPACE) != 0)
+#endif
+    {
+        return OS_Posix_QueueRingCreate(impl, queue);
+    }
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -165,6 +585,13 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+    if (impl->ring != NULL)
+    {
+        free(impl->ring);
+        impl->ring = NULL;
+        return OS_SUCCESS;
+    }
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -179,6 +606,29 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_QueueSetDeleting_Impl(const OS_object_token_t *token, bool deleting)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* A task blocked in mq_receive() cannot be woken, so only user-space queues do anything */
+    if (impl->ring != NULL)
+    {
+        atomic_store(&impl->ring->deleting, deleting);
+
+        /* changing put_count makes a waiter that has not yet blocked return immediately */
+        atomic_fetch_add(&impl->ring->put_count, 1);
+        OS_Posix_FutexWake(&impl->ring->put_count, INT_MAX);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -190,14 +640,38 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     int32                            return_code;
     ssize_t                          sizeCopied;
     struct timespec                  ts;
+    struct timespec                  deadline;
     OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+    if (impl->ring != NULL)
+    {
+        pthread_cleanup_push(OS_Posix_QueueReleaseRef, (void *)token);
+        return_code = OS_Posix_QueueRingClaimGet(impl->ring, &slot, timeout);
+        pthread_cleanup_pop(false);
+
+        if (return_code == OS_SUCCESS)
+        {
+            /* Note the shared layer already confirmed that size is at least max_size */
+            memcpy(data, &slot[1], slot->size);
+            *size_copied = slot->size;
+            OS_Posix_QueueRingRelease(impl->ring, slot);
+        }
+        else
+        {
+            *size_copied = OSAL_SIZE_C(0);
+        }
+
+        return return_code;
+    }
+
     /*
      ** Read the message queue for data
      */
     sizeCopied = -1;
+    pthread_cleanup_push(OS_Posix_QueueReleaseRef, (void *)token);
     if (timeout == OS_PEND)
     {
         /*
@@ -223,22 +697,28 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
         if (timeout == OS_CHECK)
         {
             memset(&ts, 0, sizeof(ts));
+            sizeCopied = mq_timedreceive(impl->id, data, size, NULL, &ts);
         }
         else
         {
-            OS_Posix_CompAbsDelayTime(timeout, &ts);
-        }
+            OS_Posix_CompAbsDelayTime(timeout, &deadline);
 
-        /*
-         ** If the mq_timedreceive call is interrupted by a system call or signal,
-         ** call it again.
-         */
-        do
-        {
-            sizeCopied = mq_timedreceive(impl->id, data, size, NULL, &ts);
-        } while (timeout != OS_CHECK && sizeCopied < 0 && errno == EINTR);
+            /*
+             ** mq_timedreceive only accepts a CLOCK_REALTIME deadline, so the monotonic
+             ** deadline is converted before every attempt.  If the call is interrupted by
+             ** a system call or signal, or times out early because the system time was
+             ** changed, call it again.
+             */
+            do
+            {
+                OS_Posix_ConvertAbsTime(CLOCK_MONOTONIC, &deadline, CLOCK_REALTIME, &ts);
+                sizeCopied = mq_timedreceive(impl->id, data, size, NULL, &ts);
+            } while (sizeCopied < 0 &&
+                     (errno == EINTR || (errno == ETIMEDOUT && !OS_Posix_DeadlineReached(&deadline))));
+        }
 
     } /* END timeout */
+    pthread_cleanup_pop(false);
 
     /* Figure out the return code */
     if (sizeCopied == -1)
@@ -288,9 +768,24 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     int                              result;
     struct timespec                  ts;
     OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+    if (impl->ring != NULL)
+    {
+        return_code = OS_Posix_QueueRingClaimPut(impl->ring, &slot);
+        if (return_code == OS_SUCCESS)
+        {
+            memcpy(&slot[1], data, size);
+            slot->size = size;
+            OS_Posix_QueueRingPublish(slot);
+            OS_Posix_QueueRingNotify(impl->ring, 1);
+        }
+
+        return return_code;
+    }
+
     /*
      * NOTE - using a zero timeout here for the same reason that QueueGet does ---
      * checking the attributes and doing the actual send is non-atomic, and if
@@ -321,3 +816,279 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data)
+{
+    int32                            return_code;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* direct access is only possible for user-space queues */
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    return_code = OS_Posix_QueueRingClaimPut(impl->ring, &slot);
+    if (return_code == OS_SUCCESS)
+    {
+        atomic_store(&slot->owner, OS_IMPL_QUEUE_SLOT_RESERVED);
+        *data = &slot[1];
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data, size_t size)
+{
+    int32                            return_code;
+    unsigned int                     owner;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    return_code = OS_Posix_QueueRingLookup(impl->ring, data, &slot);
+    if (return_code == OS_SUCCESS)
+    {
+        /* this check also ensures that only one caller can commit the slot */
+        owner = OS_IMPL_QUEUE_SLOT_RESERVED;
+        if (!atomic_compare_exchange_strong(&slot->owner, &owner, OS_IMPL_QUEUE_SLOT_QUEUED))
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            slot->size = size;
+            OS_Posix_QueueRingPublish(slot);
+            OS_Posix_QueueRingNotify(impl->ring, 1);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCancel_Impl(const OS_object_token_t *token, void *data)
+{
+    int32                            return_code;
+    unsigned int                     owner;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    return_code = OS_Posix_QueueRingLookup(impl->ring, data, &slot);
+    if (return_code == OS_SUCCESS)
+    {
+        /*
+         * The slot cannot be handed back to putters out of order, so it is
+         * published like a message and getters skip over it.  Getters are
+         * woken as messages committed after this one may be waiting behind it.
+         */
+        owner = OS_IMPL_QUEUE_SLOT_RESERVED;
+        if (!atomic_compare_exchange_strong(&slot->owner, &owner, OS_IMPL_QUEUE_SLOT_CANCELLED))
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            slot->size = 0;
+            OS_Posix_QueueRingPublish(slot);
+            OS_Posix_QueueRingNotify(impl->ring, 1);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **data, size_t *size, int32 timeout)
+{
+    int32                            return_code;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* direct access is only possible for user-space queues */
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    pthread_cleanup_push(OS_Posix_QueueReleaseRef, (void *)token);
+    return_code = OS_Posix_QueueRingClaimGet(impl->ring, &slot, timeout);
+    pthread_cleanup_pop(false);
+
+    if (return_code == OS_SUCCESS)
+    {
+        atomic_store(&slot->owner, OS_IMPL_QUEUE_SLOT_BORROWED);
+        *data = &slot[1];
+        *size = slot->size;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReturn_Impl(const OS_object_token_t *token, const void *data)
+{
+    int32                            return_code;
+    unsigned int                     owner;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    return_code = OS_Posix_QueueRingLookup(impl->ring, data, &slot);
+    if (return_code == OS_SUCCESS)
+    {
+        /* this check also ensures that only one caller can return the slot */
+        owner = OS_IMPL_QUEUE_SLOT_BORROWED;
+        if (!atomic_compare_exchange_strong(&slot->owner, &owner, OS_IMPL_QUEUE_SLOT_QUEUED))
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            OS_Posix_QueueRingRelease(impl->ring, slot);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *data, size_t stride, const size_t *sizes,
+                            uint32 count, uint32 *count_put, uint32 flags)
+{
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+    uint_fast64_t                    pos;
+    uint32                           num_claimed;
+    uint32                           i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* the message queue has no batch operation, let the shared layer do one message at a time */
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    /* claim as many slots as are free at once, and then wake getters once for all of them */
+    num_claimed = OS_Posix_QueueRingClaimPutRange(impl->ring, count, &pos);
+    for (i = 0; i < num_claimed; ++i)
+    {
+        slot = OS_Posix_QueueRingSlot(impl->ring, pos + i);
+        memcpy(&slot[1], (const uint8 *)data + (i * stride), sizes[i]);
+        slot->size = sizes[i];
+        OS_Posix_QueueRingPublish(slot);
+    }
+
+    if (num_claimed != 0)
+    {
+        OS_Posix_QueueRingNotify(impl->ring, num_claimed);
+    }
+
+    *count_put = num_claimed;
+
+    if (num_claimed < count)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t stride, size_t *sizes, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    int32                            return_code;
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_slot_t *           slot;
+    uint_fast64_t                    pos;
+    uint32                           num_claimed;
+    uint32                           i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* the message queue has no batch operation, let the shared layer do one message at a time */
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    num_claimed = 0;
+    pthread_cleanup_push(OS_Posix_QueueReleaseRef, (void *)token);
+    return_code = OS_Posix_QueueRingClaimGetRange(impl->ring, count, &pos, &num_claimed, timeout);
+    pthread_cleanup_pop(false);
+    for (i = 0; i < num_claimed; ++i)
+    {
+        /* Note the shared layer already confirmed that stride is at least max_size */
+        slot = OS_Posix_QueueRingSlot(impl->ring, pos + i);
+        memcpy((uint8 *)data + (i * stride), &slot[1], slot->size);
+        sizes[i] = slot->size;
+        OS_Posix_QueueRingRelease(impl->ring, slot);
+    }
+
+    *count_copied = num_claimed;
+
+    return return_code;
+}
@@ -0,0 +1,374 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Pool of pre-allocated task stacks, with guard pages and stack usage tracking.
+ *
+ * Stacks are carved out of a single arena which is mapped when the task API is
+ * initialized.  Each stack is a power-of-two sized block which begins with a guard
+ * page, and a stack which is released goes onto a free list for its block size so it
+ * can be reused by the next task of a similar size without another mmap/munmap.
+ *
+ * The usable part of each stack is kept zero-filled while not in use, so the peak
+ * stack usage of a task can be determined by finding the deepest non-zero location.
+ * Zero is used because fresh pages of the arena read as zero without having been
+ * written, so a stack carved from the arena does not need to be filled and its
+ * pages are only committed when the task actually uses them.  A task that writes
+ * only zeros at its deepest point will have its usage under-reported.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * MAP_ANONYMOUS and pthread_tryjoin_np() are not exposed by the X/Open
+ * feature set selected by the BSP, so this needs the GNU feature set.
+ */
+#define _GNU_SOURCE
+
+#include "os-posix.h"
+#include "os-impl-tasks.h"
+
+#include <sys/mman.h>
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Block sizes are powers of two, so this is the number of bits in size_t
+ */
+#define OS_IMPL_STACKPOOL_NUM_CLASSES (sizeof(size_t) * 8)
+
+/****************************************************************************************
+                                   LOCAL TYPEDEFS
+ ***************************************************************************************/
+
+/*
+ * A stack belonging to a task which exited by itself, which cannot be
+ * reused until the thread has actually terminated.
+ */
+typedef struct
+{
+    pthread_t thread;
+    void *    stack;
+    size_t    stacksz;
+} OS_impl_stackpool_exited_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    uint8 *         base;
+    size_t          size;
+    size_t          used;
+    void *          free_list[OS_IMPL_STACKPOOL_NUM_CLASSES];
+
+    OS_impl_stackpool_exited_t exited[OS_MAX_TASKS];
+    uint32                     num_exited;
+} OS_impl_stackpool_t;
+
+/****************************************************************************************
+                                     GLOBALS
+ ***************************************************************************************/
+
+static OS_impl_stackpool_t OS_impl_stackpool;
+
+/****************************************************************************************
+                                 LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Gets the size class (log2 of the block size) of a stack with the
+ * given usable size, which must have been obtained from this pool.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_Posix_StackPoolGetClass(size_t stacksz)
+{
+    uint32 size_class;
+    size_t block_size;
+
+    block_size = stacksz + POSIX_GlobalVars.PageSize;
+    size_class = 0;
+    while (((size_t)1 << size_class) < block_size)
+    {
+        ++size_class;
+    }
+
+    return size_class;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Puts a stack onto the free list for its size class.
+ * The pool lock must be held by the caller.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_StackPoolPutFree(void *stack, size_t stacksz)
+{
+    uint32 size_class;
+    size_t usage;
+
+    /*
+     * Only the part of the stack which was actually used needs to be cleared again.
+     * The lowest word is then used to link the free list, it is cleared on reuse.
+     */
+    usage = OS_Posix_StackPoolGetUsage(stack, stacksz);
+    memset((uint8 *)stack + stacksz - usage, 0, usage);
+
+    size_class                              = OS_Posix_StackPoolGetClass(stacksz);
+    *(void **)stack                         = OS_impl_stackpool.free_list[size_class];
+    OS_impl_stackpool.free_list[size_class] = stack;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Recycles the stacks of any self-exited tasks whose threads have terminated.
+ * The pool lock must be held by the caller.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_StackPoolReap(void)
+{
+    uint32                      i;
+    OS_impl_stackpool_exited_t *entry;
+
+    i = 0;
+    while (i < OS_impl_stackpool.num_exited)
+    {
+        entry = &OS_impl_stackpool.exited[i];
+        if (pthread_tryjoin_np(entry->thread, NULL) == 0)
+        {
+            OS_Posix_StackPoolPutFree(entry->stack, entry->stacksz);
+
+            --OS_impl_stackpool.num_exited;
+            *entry = OS_impl_stackpool.exited[OS_impl_stackpool.num_exited];
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+/****************************************************************************************
+                                 STACK POOL API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Maps the stack arena.  The pool_size is rounded down to a whole number
+ * of pages, if zero the pool is not used and all stacks are allocated by
+ * the pthreads library as usual.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_StackPoolInit(size_t pool_size)
+{
+    void *arena;
+    int   ret;
+
+    /*
+     * If OSAL is initialized again in the same process, keep using the existing
+     * pool, as it may still be joining the threads of tasks which exited by themselves.
+     */
+    if (OS_impl_stackpool.base != NULL)
+    {
+        return OS_SUCCESS;
+    }
+
+    memset(&OS_impl_stackpool, 0, sizeof(OS_impl_stackpool));
+
+    pool_size -= pool_size % POSIX_GlobalVars.PageSize;
+    if (pool_size == 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    ret = pthread_mutex_init(&OS_impl_stackpool.lock, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_mutex_init failed: %s\n", strerror(ret));
+        return OS_ERROR;
+    }
+
+    /*
+     * Pages of the arena are not committed until a stack is carved out of it
+     */
+    arena = mmap(NULL, pool_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (arena == MAP_FAILED)
+    {
+        OS_DEBUG("Error: mmap of %lu byte stack pool failed: %s\n", (unsigned long)pool_size, strerror(errno));
+        pthread_mutex_destroy(&OS_impl_stackpool.lock);
+        return OS_ERROR;
+    }
+
+    OS_impl_stackpool.base = arena;
+    OS_impl_stackpool.size = pool_size;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Gets a stack of at least *stacksz bytes from the pool.  On success
+ * *stacksz is set to the actual usable size of the stack.
+ *
+ * Returns NULL if the pool is not enabled or is exhausted, in which
+ * case the caller should let the pthreads library allocate the stack.
+ *
+ *-----------------------------------------------------------------*/
+void *OS_Posix_StackPoolAlloc(size_t *stacksz)
+{
+    uint32 size_class;
+    size_t block_size;
+    uint8 *block;
+    void * stack;
+
+    if (OS_impl_stackpool.base == NULL)
+    {
+        return NULL;
+    }
+
+    size_class = OS_Posix_StackPoolGetClass(*stacksz);
+    block_size = (size_t)1 << size_class;
+    stack      = NULL;
+
+    pthread_mutex_lock(&OS_impl_stackpool.lock);
+
+    OS_Posix_StackPoolReap();
+
+    if (OS_impl_stackpool.free_list[size_class] != NULL)
+    {
+        stack                                   = OS_impl_stackpool.free_list[size_class];
+        OS_impl_stackpool.free_list[size_class] = *(void **)stack;
+        memset(stack, 0, sizeof(void *));
+    }
+    else if (block_size <= (OS_impl_stackpool.size - OS_impl_stackpool.used))
+    {
+        /*
+         * Carve a new block from the arena.  The guard page at the low end
+         * stays in place when the stack is recycled.  The rest of the block
+         * has never been written, so it already reads as zero.
+         */
+        block = OS_impl_stackpool.base + OS_impl_stackpool.used;
+        if (mprotect(block, POSIX_GlobalVars.PageSize, PROT_NONE) == 0)
+        {
+            OS_impl_stackpool.used += block_size;
+            stack = block + POSIX_GlobalVars.PageSize;
+        }
+        else
+        {
+            OS_DEBUG("Error: mprotect of stack guard page failed: %s\n", strerror(errno));
+        }
+    }
+
+    pthread_mutex_unlock(&OS_impl_stackpool.lock);
+
+    if (stack != NULL)
+    {
+        *stacksz = block_size - POSIX_GlobalVars.PageSize;
+    }
+
+    return stack;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Returns a stack to the pool.  The thread using the stack must have
+ * already terminated, i.e. it was joined by the caller.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_StackPoolRelease(void *stack, size_t stacksz)
+{
+    pthread_mutex_lock(&OS_impl_stackpool.lock);
+    OS_Posix_StackPoolPutFree(stack, stacksz);
+    pthread_mutex_unlock(&OS_impl_stackpool.lock);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Returns the stack of a task which is exiting by itself to the pool.
+ *
+ * The stack is still in use until the thread has terminated, so the thread
+ * is left joinable and the stack is recycled once the pool has joined it.
+ * If too many tasks are pending in this state, the thread is detached
+ * instead and the stack is not reused.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_StackPoolReleaseOnExit(pthread_t thread, void *stack, size_t stacksz)
+{
+    OS_impl_stackpool_exited_t *entry;
+
+    pthread_mutex_lock(&OS_impl_stackpool.lock);
+
+    if (OS_impl_stackpool.num_exited < OS_MAX_TASKS)
+    {
+        entry          = &OS_impl_stackpool.exited[OS_impl_stackpool.num_exited];
+        entry->thread  = thread;
+        entry->stack   = stack;
+        entry->stacksz = stacksz;
+        ++OS_impl_stackpool.num_exited;
+    }
+    else
+    {
+        pthread_detach(thread);
+    }
+
+    pthread_mutex_unlock(&OS_impl_stackpool.lock);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Purpose:  Local helper function
+ *
+ * Gets the peak number of bytes used on a stack from the pool, by
+ * finding the deepest location which is no longer zero.
+ *
+ *-----------------------------------------------------------------*/
+size_t OS_Posix_StackPoolGetUsage(const void *stack, size_t stacksz)
+{
+    const uint32 *word;
+    const uint32 *end;
+
+    /* Stacks grow down, so the deepest point is the lowest address */
+    word = stack;
+    end  = word + (stacksz / sizeof(*word));
+    while (word < end && *word == 0)
+    {
+        ++word;
+    }
+
+    return (size_t)((const uint8 *)end - (const uint8 *)word);
+}
@@ -439,6 +439,12 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
     }
     POSIX_GlobalVars.PageSize = ret_long;
 
+    /*
+     * Failure to create the task stack pool is not fatal, stacks
+     * will be allocated by the pthreads library instead.
+     */
+    OS_Posix_StackPoolInit((size_t)OS_TASK_STACK_POOL_KB * 1024);
+
     return OS_SUCCESS;
 }
 
@@ -587,6 +593,8 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
 {
     OS_VoidPtrValueWrapper_t        arg;
     int32                           return_code;
+    osal_stackptr_t                 stackptr;
+    size_t                          stacksz;
     OS_impl_task_internal_record_t *impl;
     OS_task_internal_record_t *     task;
 
@@ -598,8 +606,37 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
     task = OS_OBJECT_TABLE_GET(OS_task_table, *token);
     impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
 
-    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_pointer, task->stack_size,
-                                                   OS_PthreadTaskEntry, arg.opaque_arg);
+    stackptr         = task->stack_pointer;
+    stacksz          = task->stack_size;
+    impl->pool_stack = NULL;
+
+    if (stackptr == OSAL_TASK_STACK_ALLOCATE)
+    {
+        /*
+         * Try to get the stack from the pool, with the same budget for TCB/TLS overhead
+         * that would be added if the stack is allocated by pthreads.
+         */
+        stacksz += OS_IMPL_STACK_EXTRA;
+        stackptr = OS_Posix_StackPoolAlloc(&stacksz);
+        if (stackptr != OSAL_TASK_STACK_ALLOCATE)
+        {
+            impl->pool_stack    = stackptr;
+            impl->pool_stack_sz = stacksz;
+        }
+        else
+        {
+            stacksz = task->stack_size;
+        }
+    }
+
+    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, stackptr, stacksz, OS_PthreadTaskEntry,
+                                                   arg.opaque_arg);
+
+    if (return_code != OS_SUCCESS && impl->pool_stack != NULL)
+    {
+        OS_Posix_StackPoolRelease(impl->pool_stack, impl->pool_stack_sz);
+        impl->pool_stack = NULL;
+    }
 
     return return_code;
 }
@@ -617,6 +654,17 @@ int32 OS_TaskDetach_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
 
+    if (impl->pool_stack != NULL)
+    {
+        /*
+         * The thread is left joinable, as the stack pool needs to
+         * know when it has terminated in order to reuse the stack.
+         */
+        OS_Posix_StackPoolReleaseOnExit(impl->id, impl->pool_stack, impl->pool_stack_sz);
+        impl->pool_stack = NULL;
+        return OS_SUCCESS;
+    }
+
     ret = pthread_detach(impl->id);
 
     if (ret != 0)
@@ -697,7 +745,16 @@ int32 OS_TaskDelete_Impl(const OS_object_token_t *token)
             OS_DEBUG("pthread_join: Failed on Task ID = %lu, err = %s\n",
                      OS_ObjectIdToInteger(OS_ObjectIdFromToken(token)), strerror(ret));
         }
+        else if (impl->pool_stack != NULL)
+        {
+            /* The thread has terminated, so its stack can be reused */
+            OS_Posix_StackPoolRelease(impl->pool_stack, impl->pool_stack_sz);
+        }
     }
+
+    /* If the thread could not be joined its stack (if from the pool) is not reused */
+    impl->pool_stack = NULL;
+
     return OS_SUCCESS;
 }
 
@@ -848,6 +905,16 @@ osal_id_t OS_TaskGetId_Impl(void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop)
 {
+    OS_impl_task_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    /* Stack usage is only known if the stack came from the pool */
+    if (impl->pool_stack != NULL)
+    {
+        task_prop->stack_high_water = OS_Posix_StackPoolGetUsage(impl->pool_stack, impl->pool_stack_sz);
+    }
+
     return OS_SUCCESS;
 }
 
@@ -26,6 +26,9 @@
  * This implementation depends on the POSIX Timer API which may not be available
  * in older versions of the Linux kernel. It was developed and tested on
  * RHEL 5 ./ CentOS 5 with Linux kernel 2.6.18
+ *
+ * If OSAL_CONFIG_TIMEBASE_TIMERFD is enabled, the Linux timerfd API is used
+ * instead of POSIX timers and RT signals to generate a simulated tick.
  */
 
 /****************************************************************************************
@@ -40,6 +43,10 @@
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
 
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+#include <sys/timerfd.h>
+#endif
+
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
  ***************************************************************************************/
@@ -179,6 +186,66 @@ static uint32 OS_TimeBase_SigWaitImpl(osal_id_t obj_id)
     return interval_time;
 }
 
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *  Note: The timerfd reports the number of expirations since the previous
+ *        read, so if the handler thread was delayed for more than one interval
+ *        the missed intervals are included in the returned tick time.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_TimerFdWaitImpl(osal_id_t obj_id)
+{
+    ssize_t                             ret;
+    OS_object_token_t                   token;
+    OS_impl_timebase_internal_record_t *impl;
+    OS_timebase_internal_record_t *     timebase;
+    uint32                              interval_time;
+    uint64                              expirations;
+
+    interval_time = 0;
+
+    if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, obj_id, &token) == OS_SUCCESS)
+    {
+        impl     = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
+
+        ret = read(impl->timer_fd, &expirations, sizeof(expirations));
+
+        if (ret != sizeof(expirations) || expirations == 0)
+        {
+            /*
+             * the read call failed or was interrupted.
+             * returning 0 will cause the process to repeat.
+             */
+        }
+        else if (impl->reset_flag == 0)
+        {
+            /*
+             * Normal steady-state behavior.
+             * interval_time reflects the configured interval time, for each expiration.
+             */
+            interval_time = timebase->nominal_interval_time * (uint32)expirations;
+        }
+        else
+        {
+            /*
+             * Reset/First interval behavior.
+             * timer_set() was invoked since the previous interval occurred (if any).
+             * interval_time reflects the configured start time, plus any intervals after that.
+             */
+            interval_time = timebase->nominal_start_time +
+                            (timebase->nominal_interval_time * (uint32)(expirations - 1));
+            impl->reset_flag = 0;
+        }
+    }
+
+    return interval_time;
+}
+#endif
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -355,6 +422,7 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
     }
 
     local->assigned_signal = 0;
+    local->timer_fd        = -1;
 
     /*
      * Set up the necessary OS constructs
@@ -365,6 +433,27 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
      * If no external sync function is provided then this will set up a POSIX
      * timer to locally simulate the timer tick using the CPU clock.
      */
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+    if (timebase->external_sync == NULL)
+    {
+        /*
+        ** Create the timer
+        ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
+        ** even if the system clock is stepped (e.g. clock_settime).
+        */
+        local->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (local->timer_fd < 0)
+        {
+            /* not fatal, the RT signal method below is used instead */
+            OS_DEBUG("Error in timerfd_create: %s\n", strerror(errno));
+        }
+        else
+        {
+            timebase->external_sync = OS_TimeBase_TimerFdWaitImpl;
+        }
+    }
+#endif
+
     if (timebase->external_sync == NULL)
     {
         sigemptyset(&local->sigset);
@@ -496,7 +585,7 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
     return_code = OS_SUCCESS;
 
     /* There is only something to do here if we are generating a simulated tick */
-    if (local->assigned_signal != 0)
+    if (local->assigned_signal != 0 || local->timer_fd >= 0)
     {
         /*
         ** Convert from Microseconds to timespec structures
@@ -508,13 +597,22 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
         /*
         ** Program the real timer
         */
-        status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
-                               &timeout,               /* struct itimerspec */
-                               NULL);                  /* Oldvalue */
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+        if (local->timer_fd >= 0)
+        {
+            status = timerfd_settime(local->timer_fd, 0, &timeout, NULL);
+        }
+        else
+#endif
+        {
+            status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
+                                   &timeout,               /* struct itimerspec */
+                                   NULL);                  /* Oldvalue */
+        }
 
         if (status < 0)
         {
-            OS_DEBUG("Error in timer_settime: %s\n", strerror(errno));
+            OS_DEBUG("Error programming timer: %s\n", strerror(errno));
             return_code = OS_TIMER_ERR_INTERNAL;
         }
         else if (interval_time > 0)
@@ -549,6 +647,12 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
     /*
     ** Delete the timer
     */
+    if (local->timer_fd >= 0)
+    {
+        close(local->timer_fd);
+        local->timer_fd = -1;
+    }
+
     if (local->assigned_signal != 0)
     {
         status = timer_delete(local->host_timerid);
@@ -56,6 +56,8 @@ static OS_impl_objtype_lock_t OS_module_table_lock;
 static OS_impl_objtype_lock_t OS_filesys_table_lock;
 static OS_impl_objtype_lock_t OS_console_lock;
 static OS_impl_objtype_lock_t OS_condvar_lock;
+static OS_impl_objtype_lock_t OS_poller_lock;
+static OS_impl_objtype_lock_t OS_mempool_lock;
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -72,6 +74,8 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
     [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_lock,
     [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_lock,
+    [OS_OBJECT_TYPE_OS_POLLER]   = &OS_poller_lock,
+    [OS_OBJECT_TYPE_OS_MEMPOOL]  = &OS_mempool_lock,
 };
 
 /*----------------------------------------------------------------
@@ -126,7 +130,7 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq, uint32 attempts)
 {
     rtems_interval wait_ticks;
 
@@ -144,6 +148,17 @@ void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
     OS_Lock_Global_Impl(objtype);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word)
+{
+    /* Nothing to do, waiting tasks poll for the change */
+}
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -50,4 +50,13 @@ int32 OS_GetLocalTime_Impl(OS_time_t *time_struct);
  ------------------------------------------------------------------*/
 int32 OS_SetLocalTime_Impl(const OS_time_t *time_struct);
 
+/*----------------------------------------------------------------
+
+    Purpose: Get the time from a monotonic clock, which is not affected
+             by changes to the RTC.  The epoch is unspecified.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct);
+
 #endif /* OS_SHARED_CLOCK_H */
@@ -54,12 +54,13 @@ struct OS_shared_global_vars
     osal_id_t PrintfConsoleId;
 
     /*
-     * PrintfEnabled and GlobalState are marked "volatile"
+     * PrintfEnabled, PrintfMode and GlobalState are marked "volatile"
      * because they are updated and read by different threads
      */
-    volatile bool PrintfEnabled;
-    uint32        MicroSecPerTick;
-    uint32        TicksPerSecond;
+    volatile bool   PrintfEnabled;
+    volatile uint32 PrintfMode;
+    uint32          MicroSecPerTick;
+    uint32          TicksPerSecond;
 
     /*
      * The event handler is an application-defined callback
@@ -34,10 +34,91 @@
 #ifndef OS_SHARED_CONSOLE_H
 #define OS_SHARED_CONSOLE_H
 
+#include <stdatomic.h>
+
+#include "osapi-clock.h"
 #include "osapi-printf.h"
 #include "os-shared-printf.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * Each message in the ring buffer is stored as a record, consisting of a
+ * header word followed by the message text, padded so the next header is
+ * aligned.  Writers reserve space for a whole record by advancing WritePos
+ * atomically, so any number of tasks may copy messages in at the same time.
+ * Setting the header then marks the record complete.
+ *
+ * A record never wraps around the end of the buffer.  If it does not fit,
+ * the remaining space is filled with a skip record and the message is
+ * written at the start of the buffer instead.
+ *
+ * A header of zero marks a record that is not complete yet, where the reader
+ * must stop.  The reader clears records after consuming them, so all free
+ * space in the buffer always reads as zero.
+ */
+#define OS_CONSOLE_REC_COMPLETE 0x80000000U /**< Header flag for a complete message record */
+#define OS_CONSOLE_REC_SKIP     0x40000000U /**< Header flag for padding up to the end of the buffer */
+#define OS_CONSOLE_REC_DEFERRED 0x20000000U /**< Header flag for a message that is not formatted yet */
+#define OS_CONSOLE_REC_LEN_MASK 0x00FFFFFFU /**< Header bits holding the message length */
+
+#define OS_CONSOLE_REC_ALIGN          sizeof(atomic_uint)
+#define OS_CONSOLE_REC_ROUNDUP(len)   (((len) + OS_CONSOLE_REC_ALIGN - 1) & ~(OS_CONSOLE_REC_ALIGN - 1))
+#define OS_CONSOLE_REC_SIZE(len)      (OS_CONSOLE_REC_ALIGN + OS_CONSOLE_REC_ROUNDUP(len))
+#define OS_CONSOLE_REC_HDR(con, pos)  ((atomic_uint *)(void *)&(con)->BufBase[pos])
+#define OS_CONSOLE_REC_DATA(con, pos) (&(con)->BufBase[(pos) + OS_CONSOLE_REC_ALIGN])
+
+/*
+ * Limits on the messages that can be deferred (see OS_printf_SetMode()).
+ * Messages exceeding these are formatted immediately instead.
+ */
+#define OS_CONSOLE_DEFERRED_MAX_WORDS    16 /**< Maximum number of argument words, including '*' widths */
+#define OS_CONSOLE_DEFERRED_MAX_SPEC_LEN 24 /**< Maximum length of a single conversion specification */
+
+/**
+ * A message recorded for deferred formatting
+ *
+ * The data of a deferred record in the ring buffer is this structure up to
+ * the last argument word used, followed by StrSize bytes of string data.
+ * Every argument is stored as a 64-bit word, string arguments are stored
+ * as the offset of a copy of the string within the string data.
+ */
+typedef struct
+{
+    OS_time_t   Timestamp;                            /**< Time when the message was recorded */
+    const char *Format;                               /**< Original format string */
+    uint32      NumWords;                             /**< Number of argument words used */
+    uint32      StrSize;                              /**< Size of the string data */
+    uint64      Words[OS_CONSOLE_DEFERRED_MAX_WORDS]; /**< Argument words */
+    char        Strings[OS_BUFFER_SIZE];              /**< Copies of string arguments */
+} OS_console_deferred_t;
+
+/*
+ * In OS_PRINTF_MODE_BINARY mode, the console outputs each message as a
+ * binary frame, consisting of an OS_console_binary_hdr_t followed by
+ * FormatLen bytes of format string text, NumWords 64-bit argument words,
+ * and StrSize bytes of string data.  Messages formatted by the calling
+ * task have no format string or arguments, only the message text as the
+ * string data.  All values are in the byte order of the target.
+ */
+#define OS_CONSOLE_BINARY_MAGIC    0x474C534FU /**< "OSLG" when stored in little-endian byte order */
+#define OS_CONSOLE_BINARY_TEXT     1           /**< Frame type for a message that is already formatted */
+#define OS_CONSOLE_BINARY_DEFERRED 2           /**< Frame type for a recorded format string and arguments */
+
+/**
+ * The header of a binary console frame
+ */
+typedef struct
+{
+    uint32 Magic;          /**< Always OS_CONSOLE_BINARY_MAGIC, also identifies the byte order */
+    uint32 FrameLen;       /**< Total length of the frame, including this header */
+    uint16 Type;           /**< OS_CONSOLE_BINARY_TEXT or OS_CONSOLE_BINARY_DEFERRED */
+    uint16 FormatLen;      /**< Length of the format string text */
+    uint32 NumWords;       /**< Number of argument words */
+    int64  Timestamp;      /**< Time the message was recorded, in ticks */
+    uint32 StrSize;        /**< Size of the string data */
+    uint32 TicksPerSecond; /**< Resolution of the timestamp */
+} OS_console_binary_hdr_t;
+
 /**
  * The generic console data record
  */
@@ -45,12 +126,12 @@ typedef struct
 {
     char device_name[OS_MAX_API_NAME];
 
-    char *          BufBase;        /**< Start of the buffer memory */
-    size_t          BufSize;        /**< Total size of the buffer */
-    volatile size_t ReadPos;        /**< Offset of next byte to read */
-    volatile size_t WritePos;       /**< Offset of next byte to write */
-    uint32          OverflowEvents; /**< Number of lines dropped due to overflow */
-    bool            IsAsync;        /**< Whether to write data via deferred utility task */
+    char *        BufBase;        /**< Start of the buffer memory, aligned for the record headers */
+    size_t        BufSize;        /**< Total size of the buffer, a multiple of OS_CONSOLE_REC_ALIGN */
+    atomic_size_t ReadPos;        /**< Offset of next record to read */
+    atomic_size_t WritePos;       /**< Offset of next record to reserve */
+    atomic_uint   OverflowEvents; /**< Number of lines dropped due to overflow */
+    bool          IsAsync;        /**< Whether to write data via deferred utility task */
 } OS_console_internal_record_t;
 
 extern OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
@@ -87,4 +168,19 @@ int32 OS_ConsoleCreate_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 void OS_ConsoleWakeup_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Format a deferred message record
+
+   This is used by the implementation to format a record with the
+   OS_CONSOLE_REC_DEFERRED flag when it is output.  The console name
+   is prepended the same as for messages formatted by the caller.
+
+   The output is always null terminated, and truncated to fit.
+
+   returns: The length of the formatted message
+ ------------------------------------------------------------------*/
+size_t OS_Console_FormatDeferred(const OS_console_internal_record_t *console, const char *RecordData,
+                                 char *Buffer, size_t BufferSize);
+
 #endif /* OS_SHARED_CONSOLE_H */
@@ -29,12 +29,43 @@
 #include "osapi-file.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * A memory mapping of part of a file
+ */
+typedef struct
+{
+    void * addr;   /* address of the byte at the requested offset, as given to the application */
+    void * base;   /* start of the mapping as created by the implementation, NULL if unused */
+    size_t size;   /* size of the mapping as created by the implementation */
+    uint32 access; /* OS_FILE_MAP_xxx flags the mapping was created with */
+    bool   busy;   /* slot is claimed by an OS_FileMap/OS_FileUnmap call in progress */
+} OS_file_mapping_t;
+
+/*
+ * An asynchronous read or write to be started on a file
+ */
+typedef enum
+{
+    OS_ASYNC_OP_READ,
+    OS_ASYNC_OP_WRITE
+} OS_async_op_t;
+
 typedef struct
 {
-    char   stream_name[OS_MAX_PATH_LEN];
-    uint8  socket_domain;
-    uint8  socket_type;
-    uint16 stream_state;
+    OS_async_op_t op;
+    void *        buffer; /* destination of a read, or source of a write */
+    size_t        nbytes;
+    osal_offset_t offset;
+    void *        user_arg; /* passed back in the completion */
+} OS_async_request_t;
+
+typedef struct
+{
+    char              stream_name[OS_MAX_PATH_LEN];
+    uint8             socket_domain;
+    uint8             socket_type;
+    uint16            stream_state;
+    OS_file_mapping_t mappings[OS_MAX_FILE_MAPPINGS];
 } OS_stream_internal_record_t;
 
 /*
@@ -96,6 +127,98 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
  ------------------------------------------------------------------*/
 int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, OS_time_t abs_timeout);
 
+/*----------------------------------------------------------------
+
+    Purpose: Read from a file descriptor at the given offset, without
+             using or changing the file position
+
+    Returns: Number of bytes read (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset);
+
+/*----------------------------------------------------------------
+
+    Purpose: Write to a file descriptor at the given offset, without
+             using or changing the file position
+
+    Returns: Number of bytes written (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+                            osal_offset_t offset);
+
+/*----------------------------------------------------------------
+
+    Purpose: Map "len" bytes of a file starting at "offset" into memory,
+             with the access and hints given by the OS_FILE_MAP_xxx flags.
+             Fills in all members of "mapping" on success.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_NOT_IMPLEMENTED if the OS cannot map files
+ ------------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, osal_offset_t offset, size_t len, uint32 access,
+                      OS_file_mapping_t *mapping);
+
+/*----------------------------------------------------------------
+
+    Purpose: Remove a mapping created by OS_FileMap_Impl(), first
+             writing any changes out to the file if it is writable
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, OS_file_mapping_t *mapping);
+
+/*----------------------------------------------------------------
+
+    Purpose: Start a read or write on a file without waiting for it
+
+    Returns: OS_SUCCESS if the operation was started, or relevant error code
+             OS_QUEUE_FULL if OS_MAX_ASYNC_IO operations are already in progress
+             OS_ERR_NOT_IMPLEMENTED if the OS cannot do asynchronous I/O
+ ------------------------------------------------------------------*/
+int32 OS_AsyncSubmit_Impl(const OS_object_token_t *token, const OS_async_request_t *request);
+
+/*----------------------------------------------------------------
+
+    Purpose: Wait for one operation started by OS_AsyncSubmit_Impl()
+             to complete, and output its completion.  A negative msecs
+             value means to wait indefinitely.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_EMPTY if no operations are in progress
+             OS_ERROR_TIMEOUT if none completed in the given time
+ ------------------------------------------------------------------*/
+int32 OS_AsyncWaitCompletion_Impl(const OS_object_token_t *token, OS_async_completion_t *completion, int32 msecs);
+
+/*----------------------------------------------------------------
+
+    Purpose: Wait for all operations in progress on a file which is
+             being closed, and release the resources used for them.
+             Completions which have not been collected are discarded.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_AsyncClose_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Read from a file descriptor into multiple buffers
+             This may be a normal file or a socket/pipe
+
+    Returns: Number of bytes read (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                           OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Write to a file descriptor from multiple buffers
+             This may be a normal file or a socket/pipe
+
+    Returns: Number of bytes written (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                            OS_time_t abs_timeout);
+
 /*----------------------------------------------------------------
 
     Purpose: Close a file descriptor
@@ -105,6 +228,24 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
  ------------------------------------------------------------------*/
 int32 OS_GenericClose_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Copy up to "len" bytes from offset "src_off" of one file to
+             offset "dst_off" of another, without using or changing the
+             file position of either.  The copy stops early at the end of
+             the source file.  If "len" is negative, the copy continues
+             until the end of the source file.
+
+             The number of bytes actually copied is output in "copied",
+             including when an error occurs partway through.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_NOT_IMPLEMENTED if the OS has no way to do this
+ ------------------------------------------------------------------*/
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, osal_offset_t src_off,
+                            const OS_object_token_t *dst_token, osal_offset_t dst_off, osal_offset_t len,
+                            osal_offset_t *copied);
+
 /*----------------------------------------------------------------
 
     Purpose: Opens the file indicated by "local_path" with permission
@@ -26,6 +26,8 @@
 #ifndef OS_SHARED_FILESYS_H
 #define OS_SHARED_FILESYS_H
 
+#include <stdatomic.h>
+
 #include "osapi-filesys.h"
 #include "os-shared-globaldefs.h"
 
@@ -103,6 +105,52 @@ typedef struct
  */
 extern OS_filesys_internal_record_t OS_filesys_table[OS_MAX_FILE_SYSTEMS];
 
+/**
+ * Number of slots in the hash index of the mount point table.  Keeping
+ * this at more than twice the number of entries keeps the probe chains short.
+ */
+#define OS_FILESYS_MOUNT_HASH_SIZE (2 * OS_MAX_FILE_SYSTEMS + 1)
+
+/**
+ * Number of times OS_TranslatePath() attempts a lock-free lookup in the
+ * mount point table before it falls back to searching under the lock.
+ */
+#define OS_FILESYS_MOUNT_LOOKUP_ATTEMPTS 4
+
+/**
+ * A copy of the mount points of one mounted file system, as used by OS_TranslatePath()
+ */
+typedef struct
+{
+    uint32 hash;                                  /**< Hash of the virtual mount point */
+    uint32 virtual_len;                           /**< Length of the virtual mount point */
+    uint32 system_len;                            /**< Length of the system mount point */
+    char   virtual_mountpt[OS_MAX_PATH_LEN];      /**< Virtual mount point, not terminated */
+    char   system_mountpt[OS_MAX_LOCAL_PATH_LEN]; /**< System mount point, not terminated */
+} OS_filesys_mount_entry_t;
+
+/**
+ * Lookup table of the mounted file systems, so that paths can be translated
+ * without taking the file system table lock.
+ *
+ * The table is rebuilt whenever a file system is mounted, unmounted or removed,
+ * with the global file system table lock held.  The generation is odd while the
+ * table is being rebuilt, and a reader only uses what it read from the table if
+ * the generation was even and did not change in the meantime.  If the table can
+ * not be rebuilt, the generation is left odd so all lookups take the lock.
+ *
+ * Entries are found through a hash of the virtual mount point, so a path is
+ * translated by hashing it once and probing the index at each directory separator.
+ */
+typedef struct
+{
+    atomic_uint              generation;
+    uint16                   index[OS_FILESYS_MOUNT_HASH_SIZE]; /**< Entry number plus one, or 0 if unused */
+    OS_filesys_mount_entry_t entries[OS_MAX_FILE_SYSTEMS];
+} OS_filesys_mount_table_t;
+
+extern OS_filesys_mount_table_t OS_filesys_mount_table;
+
 /*
  * File system abstraction layer
  */
@@ -182,5 +230,8 @@ bool  OS_FileSys_FindVirtMountPoint(void *ref, const OS_object_token_t *token, c
 int32 OS_FileSys_Initialize(char *address, const char *fsdevname, const char *fsvolname, size_t blocksize,
                             osal_blockcount_t numblocks, bool should_format);
 bool  OS_FileSysFilterFree(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+void  OS_FileSys_UpdateMountTable(void);
+bool  OS_FileSys_LookupMountTable(const char *VirtualPath, size_t VirtPathLen, char *LocalPath, size_t *VirtPathBegin,
+                                  size_t *SysMountPointLen);
 
 #endif /* OS_SHARED_FILESYS_H */
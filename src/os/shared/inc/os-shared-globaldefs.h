@@ -83,6 +83,17 @@ typedef union
  */
 CompileTimeAssert(sizeof(OS_VoidPtrValueWrapper_t) == sizeof(void *), VoidValueWrapperSize);
 
+/*
+ * Placed on the first member of a structure to start it on a new cache line,
+ * which also pads the structure to a whole number of lines.  This is used for
+ * table entries that are updated on every operation, so that operations on
+ * neighboring entries from different CPUs do not contend for the same line.
+ */
+#define OS_CACHE_ALIGNED _Alignas(OS_CACHE_LINE_SIZE)
+
+CompileTimeAssert((OS_CACHE_LINE_SIZE & (OS_CACHE_LINE_SIZE - 1)) == 0 && OS_CACHE_LINE_SIZE >= sizeof(void *),
+                  CacheLineSizeValid);
+
 /*
  * The "OS_DEBUG" is a no-op unless OSAL_CONFIG_DEBUG_PRINTF is enabled.
  * When enabled, it is a macro that includes function/line number info.
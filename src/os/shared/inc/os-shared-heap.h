@@ -26,9 +26,64 @@
 #ifndef OS_SHARED_HEAP_H
 #define OS_SHARED_HEAP_H
 
+#include <stdatomic.h>
+
 #include "osapi-heap.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * Blocks up to OS_HEAP_MAX_CLASS_SIZE are rounded up to a power of two size
+ * class, starting at OS_HEAP_MIN_CLASS_SIZE, and are cached per task when freed.
+ * Larger blocks go directly to/from the system allocator.
+ */
+#define OS_HEAP_MIN_CLASS_SHIFT 5
+#define OS_HEAP_MIN_CLASS_SIZE  ((size_t)1 << OS_HEAP_MIN_CLASS_SHIFT)
+#define OS_HEAP_NUM_CLASSES     8
+#define OS_HEAP_MAX_CLASS_SIZE  (OS_HEAP_MIN_CLASS_SIZE << (OS_HEAP_NUM_CLASSES - 1))
+
+/* The maximum number of free blocks of each class held in a task cache */
+#define OS_HEAP_CACHE_DEPTH 16
+
+/*
+ * Header prepended to every block handed out by OS_HeapAlloc()
+ *
+ * The union keeps the user data following it suitably aligned for any type.
+ */
+typedef union
+{
+    struct
+    {
+        unsigned long owner;      /**< Integer value of the ID of the allocating task, or 0 */
+        uint32        size_class; /**< Size class index, or OS_HEAP_NUM_CLASSES for a large block */
+        size_t        size;       /**< Size charged to the owner */
+    } info;
+    max_align_t align;
+} OS_heap_block_hdr_t;
+
+/*
+ * Per-task heap state, indexed in parallel with the task table
+ *
+ * The free lists are only ever accessed by the task which currently occupies
+ * the slot, and need no locking.  The counters are atomic so they can be
+ * read by other tasks for OS_HeapGetInfo()/OS_HeapGetTaskUsage().
+ *
+ * The usage word holds the integer value of the ID of the owning task in the
+ * upper half and the bytes it has allocated in the lower half.  A new task
+ * taking over the slot and another task crediting a block to the old owner
+ * are therefore each a single compare-and-swap, and cannot interleave.  The
+ * byte count saturates at OS_HEAP_USAGE_BYTES_MAX.
+ */
+#define OS_HEAP_USAGE_BYTES_MAX 0xFFFFFFFFUL
+
+typedef struct
+{
+    atomic_uint_least64_t usage;
+    void *                free_list[OS_HEAP_NUM_CLASSES];
+    atomic_uint           free_count[OS_HEAP_NUM_CLASSES];
+} OS_heap_task_cache_t;
+
+extern OS_heap_task_cache_t OS_heap_task_cache_table[OS_MAX_TASKS];
+
 /****************************************************************************************
                     MEMORY HEAP API LOW-LEVEL IMPLEMENTATION FUNCTIONS
  ****************************************************************************************/
@@ -39,7 +94,10 @@
 
 /*----------------------------------------------------------------
 
-    Purpose: Return current info on the heap
+    Purpose: Return current info on the system heap
+
+    This covers memory managed by the underlying allocator only.  Blocks
+    held in the OSAL task caches are accounted for by the shared layer.
 
     Returns: OS_SUCCESS on success, or relevant error code
  ------------------------------------------------------------------*/
@@ -29,19 +29,50 @@
 #include "osapi-idmap.h"
 #include "os-shared-globaldefs.h"
 
+#include <stdatomic.h>
+
 #define OS_OBJECT_ID_RESERVED ((osal_id_t) {0xFFFFFFFF})
 
+/*
+ * Bits of the per-record "state_seq" word.  The low bit indicates that at
+ * least one task is waiting for the record to change, and the remaining bits
+ * are a sequence number which is advanced every time the active_id or refcount
+ * changes in a way that a waiting task may be interested in.
+ */
+#define OS_OBJECT_STATE_WAITERS  0x1U
+#define OS_OBJECT_STATE_SEQ_INCR 0x2U
+
+/*
+ * The reference count type.  When lock-free reference counting is enabled
+ * this is an atomic type, so it may be adjusted without holding the global
+ * table lock.  Note that ordinary C operators (++, --, =) on an atomic type
+ * are still valid and are performed as sequentially-consistent atomic ops.
+ */
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+typedef atomic_uint_least16_t OS_refcount_t;
+#else
+typedef uint16 OS_refcount_t;
+#endif
+
 /*
  * This supplies a non-abstract definition of "OS_common_record_t"
+ *
+ * The active_id, refcount, and state_seq are checked and/or updated by every
+ * operation on the object, so each record occupies its own cache line(s) and
+ * these members are placed first.  The name_entry and creator are only used
+ * when creating, deleting, or looking up the object by name.
  */
 struct OS_common_record
 {
-    const char *name_entry;
-    osal_id_t   active_id;
-    osal_id_t   creator;
-    uint16      refcount;
+    OS_CACHE_ALIGNED osal_id_t active_id;
+    OS_refcount_t              refcount;
+    atomic_uint                state_seq;
+    const char *               name_entry;
+    osal_id_t                  creator;
 };
 
+CompileTimeAssert(sizeof(OS_common_record_t) % OS_CACHE_LINE_SIZE == 0, CommonRecordSize);
+
 typedef enum
 {
     OS_TASK_BASE         = 0,
@@ -57,7 +88,9 @@ typedef enum
     OS_FILESYS_BASE      = OS_MODULE_BASE + OS_MAX_MODULES,
     OS_CONSOLE_BASE      = OS_FILESYS_BASE + OS_MAX_FILE_SYSTEMS,
     OS_CONDVAR_BASE      = OS_CONSOLE_BASE + OS_MAX_CONSOLES,
-    OS_MAX_TOTAL_RECORDS = OS_CONDVAR_BASE + OS_MAX_CONDVARS
+    OS_POLLER_BASE       = OS_CONDVAR_BASE + OS_MAX_CONDVARS,
+    OS_MEMPOOL_BASE      = OS_POLLER_BASE + OS_MAX_POLLERS,
+    OS_MAX_TOTAL_RECORDS = OS_MEMPOOL_BASE + OS_MAX_MEMPOOLS
 } OS_ObjectIndex_t;
 
 /*
@@ -155,6 +188,8 @@ extern OS_common_record_t *const OS_global_module_table;
 extern OS_common_record_t *const OS_global_filesys_table;
 extern OS_common_record_t *const OS_global_console_table;
 extern OS_common_record_t *const OS_global_condvar_table;
+extern OS_common_record_t *const OS_global_poller_table;
+extern OS_common_record_t *const OS_global_mempool_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -208,28 +243,45 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype);
 
 /*----------------------------------------------------------------
 
-    Purpose: Waits for a change in the global table identified by "idtype"
+    Purpose: Waits for a change to the record referred to by the token
+
+   The state_seq value must have been read from the record before its state
+   was checked, so that a change made in between is not missed.
 
    NOTE: The table must be already "owned" (via OS_Lock_Global) by the calling
    at the time this function is invoked.  The lock is released and re-acquired
    before returning from this function.
 
+   Returns: OS_SUCCESS if the record changed, or OS_ERROR_TIMEOUT if not
   -----------------------------------------------------------------*/
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts);
+int32 OS_WaitForStateChange(OS_object_token_t *token, uint32 state_seq, uint32 attempts);
+
+/*----------------------------------------------------------------
+
+   Purpose: Block the caller until the state word of a record in the given
+   object type no longer holds the given value, such as when the record
+   changes state i.e. the release of a lock/refcount from another thread.
+
+   The global table lock is released while waiting and re-acquired before
+   returning.  The wait is limited to an amount of time based on the number
+   of attempts made so far.
+
+   It is not guaranteed that the state word has actually changed when this
+   function returns.  This may be implemented as a simple OS_TaskDelay().
+
+ ------------------------------------------------------------------*/
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq, uint32 attempts);
 
 /*----------------------------------------------------------------
 
-   Purpose: Block the caller until some sort of change event
-   has occurred for the given object type, such as a record changing
-   state i.e. the acquisition or release of a lock/refcount from
-   another thread.
+   Purpose: Wake all tasks blocked in OS_WaitForStateChange_Impl() on the
+   given state word
 
-   It is not guaranteed what, if any, state change has actually
-   occurred when this function returns.  This may be implemented as
-   a simple OS_TaskDelay().
+   This is only invoked if a task has indicated that it is waiting.  It may
+   be a no-op if OS_WaitForStateChange_Impl() simply delays.
 
  ------------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts);
+void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word);
 
 /*
    Function prototypes for routines implemented in common layers but private to OSAL
@@ -467,6 +519,20 @@ int32 OS_ObjectIdFinalizeNew(int32 operation_status, OS_object_token_t *token, o
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdFinalizeDelete(int32 operation_status, OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Places the record referenced by the token into the name index
+             under the given name, replacing any previous entry for that record.
+             If name is NULL, the record is only removed from the index.
+
+             This is called internally during create/delete operations, but
+             must also be called if the name of an existing object is changed.
+             The global table for the object type must be locked by the caller.
+
+    Returns: None
+ ------------------------------------------------------------------*/
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token, const char *name);
+
 /*----------------------------------------------------------------
 
     Purpose: Initialize a generic object iterator of the given type.
@@ -531,6 +597,7 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
 bool  OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
 bool  OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
 int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
 int32 OS_ObjectIdFindNextFree(OS_object_token_t *token);
 
 #endif /* OS_SHARED_IDMAP_H */
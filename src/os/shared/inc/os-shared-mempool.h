@@ -0,0 +1,138 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ */
+
+#ifndef OS_SHARED_MEMPOOL_H
+#define OS_SHARED_MEMPOOL_H
+
+#include <stdatomic.h>
+
+#include "osapi-clock.h"
+#include "osapi-mempool.h"
+#include "os-shared-globaldefs.h"
+
+/*
+ * The number of single-block caches in each pool.  A task returning a block
+ * puts it in the cache for the CPU it is running on, if empty, where it is
+ * most likely to be reused by the next task to get a block on that CPU.
+ * This keeps most traffic off the shared free list head.
+ */
+#define OS_MEMPOOL_NUM_CACHES 8
+
+/*
+ * Each cache is on its own cache line, so that tasks on different CPUs
+ * using their own cache do not contend with each other.
+ */
+typedef struct
+{
+    OS_CACHE_ALIGNED atomic_uint block;
+} OS_mempool_cache_t;
+
+typedef struct
+{
+    char   obj_name[OS_MAX_API_NAME];
+    uint8 *storage;    /**< Memory for the blocks, followed by the next_free array */
+    size_t block_size; /**< Size requested by the application */
+    size_t stride;     /**< Distance between blocks, i.e. block_size rounded up for alignment */
+    uint32 num_blocks;
+
+    /*
+     * The free list is a stack of block numbers, linked through next_free.
+     * Block numbers are stored offset by one so that zero means none.  The
+     * upper half of the head is a counter that is incremented on every
+     * change, so a compare-and-swap on the head cannot succeed if another
+     * task has popped and pushed the same block in the meantime (ABA).
+     */
+    atomic_uint *                          next_free;
+    OS_CACHE_ALIGNED atomic_uint_least64_t free_head;
+    OS_mempool_cache_t                     cache[OS_MEMPOOL_NUM_CACHES];
+
+    atomic_uint free_count; /**< Blocks in the free list plus caches, may briefly overstate */
+    atomic_uint min_free_count;
+    atomic_uint failed_gets;
+} OS_mempool_internal_record_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_mempool_internal_record_t OS_mempool_table[OS_MAX_MEMPOOLS];
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_MemPoolAPI_Init
+
+   Purpose: Initialize the OS-independent layer for memory pool objects
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolAPI_Init(void);
+
+/*----------------------------------------------------------------
+
+    Purpose: Prepare/allocate OS resources for a memory pool object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_MemPoolCreate_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Free the OS resources associated with a memory pool object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_MemPoolDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Block the calling task while the free_count of the pool is zero
+
+             The wait ends when woken by OS_MemPoolWake_Impl(), or when the
+             monotonic clock reaches abs_timeout.  If abs_timeout is NULL
+             the wait is indefinite.  Spurious wakeups are allowed, so the
+             caller must always re-check the pool.
+
+    Returns: OS_SUCCESS if woken, OS_ERROR_TIMEOUT if the time expired,
+             or OS_ERR_NOT_IMPLEMENTED if the platform cannot wait
+ ------------------------------------------------------------------*/
+int32 OS_MemPoolWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Wake all tasks blocked in OS_MemPoolWait_Impl()
+
+             Called whenever the free_count of the pool goes from zero to
+             non-zero.  This should be cheap if there are no waiters.
+ ------------------------------------------------------------------*/
+void OS_MemPoolWake_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Get the number of the CPU the calling task is running on
+
+             This is used only to select a cache, so it does not matter if
+             the task migrates.  Platforms that cannot tell return 0.
+ ------------------------------------------------------------------*/
+uint32 OS_MemPoolGetCpu_Impl(void);
+
+#endif /* OS_SHARED_MEMPOOL_H */
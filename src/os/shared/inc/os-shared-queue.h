@@ -31,9 +31,10 @@
 
 typedef struct
 {
-    char              queue_name[OS_MAX_API_NAME];
-    size_t            max_size;
-    osal_blockcount_t max_depth;
+    char                     queue_name[OS_MAX_API_NAME];
+    size_t                   max_size;
+    osal_blockcount_t        max_depth;
+    struct OS_queue_copybuf *copybufs; /**< Temporary buffers of the zero-copy API owned by callers */
 } OS_queue_internal_record_t;
 
 /*
@@ -92,6 +93,111 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
  ------------------------------------------------------------------*/
 int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags);
 
+/*----------------------------------------------------------------
+
+    Purpose: Put a batch of messages into a message queue, in order,
+             stopping if the queue becomes full
+
+    Returns: OS_SUCCESS if all messages were put, or relevant error code
+             OS_QUEUE_FULL must be returned if not all messages could be put,
+             with count_put set to the number that were.
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue has no
+             batch operation, in which case the shared layer calls
+             OS_QueuePut_Impl() for each message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *data, size_t stride, const size_t *sizes,
+                            uint32 count, uint32 *count_put, uint32 flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Receive a batch of messages from a message queue.
+             The calling task will be blocked if no message is immediately
+             available, but will not block for any subsequent messages.
+
+    Returns: OS_SUCCESS if at least one message was received, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue has no
+             batch operation, in which case the shared layer calls
+             OS_QueueGet_Impl() for each message instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t stride, size_t *sizes, uint32 count,
+                            uint32 *count_copied, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Reserve a message slot in the queue storage, to be filled
+             in by the caller and published by OS_QueueCommit_Impl()
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue is full.
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue does not
+             support direct access to its storage, in which case the shared
+             layer uses OS_QueuePut_Impl() with a temporary buffer instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data);
+
+/*----------------------------------------------------------------
+
+    Purpose: Publish a message slot obtained from OS_QueueReserve_Impl()
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_INVALID_ARGUMENT must be returned if the buffer is not a slot of this queue
+             OS_ERR_INCORRECT_OBJ_STATE must be returned if the slot is not reserved
+             OS_ERR_NOT_IMPLEMENTED must be returned if OS_QueueReserve_Impl() is not implemented
+ ------------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data, size_t size);
+
+/*----------------------------------------------------------------
+
+    Purpose: Release a message slot obtained from OS_QueueReserve_Impl()
+             without publishing a message
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_INVALID_ARGUMENT must be returned if the buffer is not a slot of this queue
+             OS_ERR_INCORRECT_OBJ_STATE must be returned if the slot is not reserved
+             OS_ERR_NOT_IMPLEMENTED must be returned if OS_QueueReserve_Impl() is not implemented
+ ------------------------------------------------------------------*/
+int32 OS_QueueCancel_Impl(const OS_object_token_t *token, void *data);
+
+/*----------------------------------------------------------------
+
+    Purpose: Obtain direct access to the next message slot in the queue storage.
+             The calling task will be blocked if no message is immediately available
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+             OS_ERR_NOT_IMPLEMENTED must be returned if the queue does not
+             support direct access to its storage, in which case the shared
+             layer uses OS_QueueGet_Impl() with a temporary buffer instead.
+ ------------------------------------------------------------------*/
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **data, size_t *size, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Release a message slot obtained from OS_QueueBorrow_Impl()
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_INVALID_ARGUMENT must be returned if the buffer is not a slot of this queue
+             OS_ERR_INCORRECT_OBJ_STATE must be returned if the slot is not borrowed
+             OS_ERR_NOT_IMPLEMENTED must be returned if OS_QueueBorrow_Impl() is not implemented
+ ------------------------------------------------------------------*/
+int32 OS_QueueReturn_Impl(const OS_object_token_t *token, const void *data);
+
+/*----------------------------------------------------------------
+
+    Purpose: Mark the queue as being deleted, or no longer being deleted,
+             and wake any tasks blocked getting a message from it
+
+             While the queue is marked, gets must return OS_ERR_INVALID_ID
+             instead of blocking, so that the tasks release their reference
+             to the queue.  OS_QueueDelete() marks the queue before it waits
+             for all references to be released.  Implementations which
+             cannot wake blocked tasks do nothing.
+ ------------------------------------------------------------------*/
+void OS_QueueSetDeleting_Impl(const OS_object_token_t *token, bool deleting);
+
 /*----------------------------------------------------------------
 
     Purpose: Obtain OS-specific information about a message queue
@@ -118,6 +118,37 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
                            const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+
+    Purpose: Receives multiple datagrams from the specified socket (must be of the DATAGRAM type)
+             Will wait until "abs_timeout" for the first datagram to arrive, then
+             collects any additional datagrams that are immediately available,
+             up to "count" in total
+
+    Returns: Number of datagrams received on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count,
+                                  OS_time_t abs_timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Sends multiple datagrams from the specified socket (must be of the DATAGRAM type)
+             Each datagram is sent to the remote address stored in its descriptor
+
+    Returns: Number of datagrams sent on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count);
+
+/*----------------------------------------------------------------
+
+    Purpose: Sends a single datagram gathered from "iovcnt" segments
+             to the remote address specified by "RemoteAddr"
+
+    Returns: Number of bytes sent on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendV_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+                          const OS_SockAddr_t *RemoteAddr);
+
 /*----------------------------------------------------------------
 
     Purpose: Get OS-specific information about a socket
@@ -30,6 +30,7 @@
 
 #include "os-shared-globaldefs.h"
 #include "os-shared-idmap.h"
+#include "os-shared-timebase.h"
 
 #define TIMECB_FLAG_DEDICATED_TIMEBASE 0x1
 
@@ -41,10 +42,15 @@ typedef struct
     osal_id_t         prev_cb;
     osal_id_t         next_cb;
     uint32            backlog_resets;
-    int32             wait_time;
+    uint32            expire_time; /**< next expiry, in units of the timebase freerun_time */
+    uint32            queue_pos;   /**< 1-based position in the timebase expiry queue, 0 if not armed */
     int32             interval_time;
     OS_ArgCallback_t  callback_ptr;
     void *            callback_arg;
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+    OS_timer_stats_record_t stats;
+#endif
 } OS_timecb_internal_record_t;
 
 /*
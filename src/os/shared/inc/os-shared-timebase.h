@@ -26,9 +26,19 @@
 #ifndef OS_SHARED_TIMEBASE_H
 #define OS_SHARED_TIMEBASE_H
 
+#include "osapi-clock.h"
 #include "osapi-timebase.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * Accumulated latency statistics for a time base or timer callback
+ */
+typedef struct
+{
+    OS_timer_stats_t stats;
+    uint64           latency_sum;
+} OS_timer_stats_record_t;
+
 typedef struct
 {
     char           timebase_name[OS_MAX_API_NAME];
@@ -38,6 +48,20 @@ typedef struct
     uint32         freerun_time;
     uint32         nominal_start_time;
     uint32         nominal_interval_time;
+
+    /*
+     * Expiry queue: a binary min-heap of OS_timecb_table indices, ordered by
+     * the absolute expire_time of each armed timer callback.  This allows the
+     * callback thread to only visit the timers that are actually due on a tick.
+     */
+    uint32       expiry_count;
+    osal_index_t expiry_queue[OS_MAX_TIMERS];
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+    OS_timer_stats_record_t stats;
+    OS_time_t               last_tick_time;  /**< monotonic time of the previous tick */
+    bool                    last_tick_valid; /**< cleared when the time base is (re)programmed */
+#endif
 } OS_timebase_internal_record_t;
 
 /*
@@ -128,4 +152,38 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id);
  ------------------------------------------------------------------*/
 int32 OS_Milli2Ticks(uint32 milli_seconds, int *ticks);
 
+/*----------------------------------------------------------------
+
+    Purpose: Arm a timer callback in the expiry queue of the time base,
+             or move it to the correct position if it is already armed.
+
+    Note: The caller must hold the time base lock
+ ------------------------------------------------------------------*/
+void OS_TimeBaseQueueSet(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx, uint32 expire_time);
+
+/*----------------------------------------------------------------
+
+    Purpose: Remove a timer callback from the expiry queue of the time base.
+             Has no effect if the timer callback is not armed.
+
+    Note: The caller must hold the time base lock
+ ------------------------------------------------------------------*/
+void OS_TimeBaseQueueRemove(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx);
+
+/*----------------------------------------------------------------
+
+    Purpose: Add a single event (tick or callback) to the statistics record
+
+    Note: The caller must hold the time base lock
+ ------------------------------------------------------------------*/
+void OS_TimeBaseStatsRecord(OS_timer_stats_record_t *record, uint32 latency, uint32 exec_time, bool overrun);
+
+/*----------------------------------------------------------------
+
+    Purpose: Export the statistics record in the public format
+
+    Note: The caller must hold the time base lock
+ ------------------------------------------------------------------*/
+void OS_TimeBaseStatsGet(const OS_timer_stats_record_t *record, OS_timer_stats_t *stats);
+
 #endif /* OS_SHARED_TIMEBASE_H */
@@ -66,6 +66,20 @@ int32 OS_SetLocalTime(const OS_time_t *time_struct)
     return OS_SetLocalTime_Impl(time_struct);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+    /* Check parameters */
+    OS_CHECK_POINTER(time_struct);
+
+    return OS_GetMonotonicTime_Impl(time_struct);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -41,6 +41,8 @@
 #include "os-shared-binsem.h"
 #include "os-shared-common.h"
 #include "os-shared-condvar.h"
+#include "os-shared-poller.h"
+#include "os-shared-mempool.h"
 #include "os-shared-countsem.h"
 #include "os-shared-dir.h"
 #include "os-shared-file.h"
@@ -188,6 +190,12 @@ int32 OS_API_Init(void)
             case OS_OBJECT_TYPE_OS_CONDVAR:
                 return_code = OS_CondVarAPI_Init();
                 break;
+            case OS_OBJECT_TYPE_OS_POLLER:
+                return_code = OS_PollerAPI_Init();
+                break;
+            case OS_OBJECT_TYPE_OS_MEMPOOL:
+                return_code = OS_MemPoolAPI_Init();
+                break;
             default:
                 break;
         }
@@ -342,6 +350,12 @@ void OS_CleanUpObject(osal_id_t object_id, void *arg)
         case OS_OBJECT_TYPE_OS_CONDVAR:
             OS_CondVarDelete(object_id);
             break;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            OS_PollerDelete(object_id);
+            break;
+        case OS_OBJECT_TYPE_OS_MEMPOOL:
+            OS_MemPoolDelete(object_id);
+            break;
         default:
             break;
     }
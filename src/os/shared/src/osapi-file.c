@@ -69,9 +69,17 @@ OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
  * to match page size for performance so providing a unique
  * define here.  Given a requirement/request could be transitioned
  * to a configuration parameter
+ *
+ * This is only used where the implementation has no way to copy
+ * a file by itself (see OS_FileCopyRange_Impl).
  */
 #define OS_CP_BLOCK_SIZE 512
 
+/*
+ * All the flags that may be passed to OS_FileMap()
+ */
+#define OS_FILE_MAP_ALL_FLAGS (OS_FILE_MAP_READ | OS_FILE_MAP_WRITE | OS_FILE_MAP_SEQUENTIAL | OS_FILE_MAP_WILLNEED)
+
 /*----------------------------------------------------------------
  *
  * Helper function to close a file from an iterator
@@ -152,6 +160,29 @@ int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 acc
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Helper function to remove all the mappings of a file which is
+ * being closed.  The mappings are forgotten even if an error occurs.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_FileUnmapAll(const OS_object_token_t *token)
+{
+    OS_stream_internal_record_t *stream;
+    uint32                       i;
+
+    stream = OS_OBJECT_TABLE_GET(OS_stream_table, *token);
+
+    for (i = 0; i < OS_MAX_FILE_MAPPINGS; ++i)
+    {
+        if (stream->mappings[i].base != NULL)
+        {
+            OS_FileUnmap_Impl(token, &stream->mappings[i]);
+            memset(&stream->mappings[i], 0, sizeof(stream->mappings[i]));
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -167,6 +198,12 @@ int32 OS_close(osal_id_t filedes)
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, filedes, &token);
     if (return_code == OS_SUCCESS)
     {
+        /* Let any asynchronous operations finish before the file goes away */
+        OS_AsyncClose_Impl(&token);
+
+        /* Remove any mappings the application did not */
+        OS_FileUnmapAll(&token);
+
         return_code = OS_GenericClose_Impl(&token);
 
         /* Complete the operation via the common routine */
@@ -271,6 +308,385 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
     return OS_TimedWrite(filedes, buffer, nbytes, OS_PEND);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPread_Impl(&token, buffer, nbytes, offset);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPwrite_Impl(&token, buffer, nbytes, offset);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t len, uint32 access, void **addr)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    OS_file_mapping_t *          mapping;
+    OS_file_mapping_t            local_mapping;
+    int32                        return_code;
+    uint32                       i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+    ARGCHECK(len > 0, OS_ERR_INVALID_SIZE);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+    ARGCHECK((access & (OS_FILE_MAP_READ | OS_FILE_MAP_WRITE)) != 0, OS_ERR_INVALID_ARGUMENT);
+    ARGCHECK((access & ~OS_FILE_MAP_ALL_FLAGS) == 0, OS_ERR_INVALID_ARGUMENT);
+
+    /*
+     * The file is held by reference for the whole call, so it cannot be closed
+     * underneath the mapping.  The global lock is only taken to claim and to
+     * publish the slot; the mapping itself is created without it.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream  = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+        mapping = NULL;
+
+        OS_Lock_Global(&token);
+
+        if (stream->socket_domain != OS_SocketDomain_INVALID)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            for (i = 0; i < OS_MAX_FILE_MAPPINGS; ++i)
+            {
+                if (stream->mappings[i].base == NULL && !stream->mappings[i].busy)
+                {
+                    mapping       = &stream->mappings[i];
+                    mapping->busy = true;
+                    break;
+                }
+            }
+
+            if (mapping == NULL)
+            {
+                return_code = OS_ERR_NO_FREE_IDS;
+            }
+        }
+
+        OS_Unlock_Global(&token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            memset(&local_mapping, 0, sizeof(local_mapping));
+            return_code = OS_FileMap_Impl(&token, offset, len, access, &local_mapping);
+
+            OS_Lock_Global(&token);
+            if (return_code == OS_SUCCESS)
+            {
+                *mapping = local_mapping;
+                *addr    = mapping->addr;
+            }
+            else
+            {
+                memset(mapping, 0, sizeof(*mapping));
+            }
+            OS_Unlock_Global(&token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap(osal_id_t filedes, void *addr)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    OS_file_mapping_t *          mapping;
+    OS_file_mapping_t            local_mapping;
+    int32                        return_code;
+    uint32                       i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+
+    /* As in OS_FileMap(), the global lock is not held while the mapping is removed */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream  = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+        mapping = NULL;
+
+        OS_Lock_Global(&token);
+
+        for (i = 0; i < OS_MAX_FILE_MAPPINGS; ++i)
+        {
+            if (stream->mappings[i].base != NULL && !stream->mappings[i].busy && stream->mappings[i].addr == addr)
+            {
+                mapping       = &stream->mappings[i];
+                mapping->busy = true;
+                local_mapping = *mapping;
+                break;
+            }
+        }
+
+        OS_Unlock_Global(&token);
+
+        if (mapping == NULL)
+        {
+            /* Not one of the mappings of this file */
+            return_code = OS_ERR_INVALID_ARGUMENT;
+        }
+        else
+        {
+            return_code = OS_FileUnmap_Impl(&token, &local_mapping);
+
+            /* The mapping is forgotten even if this fails, as it is no longer usable */
+            OS_Lock_Global(&token);
+            memset(mapping, 0, sizeof(*mapping));
+            OS_Unlock_Global(&token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Helper function to start an asynchronous read or write,
+ * after the arguments of the public API have been checked.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_AsyncSubmit(osal_id_t filedes, const OS_async_request_t *request)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_domain != OS_SocketDomain_INVALID)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_AsyncSubmit_Impl(&token, request);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncReadSubmit(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset, void *user_arg)
+{
+    OS_async_request_t request;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    request.op       = OS_ASYNC_OP_READ;
+    request.buffer   = buffer;
+    request.nbytes   = nbytes;
+    request.offset   = offset;
+    request.user_arg = user_arg;
+
+    return OS_AsyncSubmit(filedes, &request);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWriteSubmit(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset,
+                          void *user_arg)
+{
+    OS_async_request_t request;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    ARGCHECK(offset >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    /* The request type is shared with reads, the buffer is only read from here */
+    request.op       = OS_ASYNC_OP_WRITE;
+    request.buffer   = (void *)buffer;
+    request.nbytes   = nbytes;
+    request.offset   = offset;
+    request.user_arg = user_arg;
+
+    return OS_AsyncSubmit(filedes, &request);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWaitCompletion(osal_id_t filedes, OS_async_completion_t *completion, int32 msecs)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(completion);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_domain != OS_SocketDomain_INVALID)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_AsyncWaitCompletion_Impl(&token, completion, msecs);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    OS_object_token_t token;
+    int32             return_code;
+    uint32            i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(iov);
+    OS_CHECK_SIZE(iovcnt);
+    ARGCHECK(iovcnt <= OS_IOV_MAX, OS_ERR_INVALID_SIZE);
+    for (i = 0; i < iovcnt; ++i)
+    {
+        OS_CHECK_POINTER(iov[i].Buffer);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericReadv_Impl(&token, iov, iovcnt, OS_TimeFromRelativeMilliseconds(OS_PEND));
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    OS_object_token_t token;
+    int32             return_code;
+    uint32            i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(iov);
+    OS_CHECK_SIZE(iovcnt);
+    ARGCHECK(iovcnt <= OS_IOV_MAX, OS_ERR_INVALID_SIZE);
+    for (i = 0; i < iovcnt; ++i)
+    {
+        OS_CHECK_POINTER(iov[i].Buffer);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericWritev_Impl(&token, iov, iovcnt, OS_TimeFromRelativeMilliseconds(OS_PEND));
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -395,6 +811,7 @@ int32 OS_rename(const char *old_filename, const char *new_filename)
             {
                 strncpy(stream->stream_name, new_filename, sizeof(stream->stream_name) - 1);
                 stream->stream_name[sizeof(stream->stream_name) - 1] = 0;
+                OS_ObjectIdNameIndexUpdate(&iter.token, stream->stream_name);
             }
         }
 
@@ -406,32 +823,52 @@ int32 OS_rename(const char *old_filename, const char *new_filename)
 
 /*----------------------------------------------------------------
  *
- *  Purpose: Implemented per public OSAL API
- *           See description in API and header file for detail
+ * Helper function to copy a range between two open files using the
+ * implementation layer, with a single lookup of each file handle.
  *
  *-----------------------------------------------------------------*/
-int32 OS_cp(const char *src, const char *dest)
+static int32 OS_FileCopyRangeById(osal_id_t src_fd, osal_offset_t src_off, osal_id_t dst_fd, osal_offset_t dst_off,
+                                  osal_offset_t len, osal_offset_t *copied)
 {
-    int32     return_code;
-    int32     rd_size;
-    int32     wr_size;
-    int32     wr_total;
-    osal_id_t file1;
-    osal_id_t file2;
-    uint8     copyblock[OS_CP_BLOCK_SIZE];
+    OS_object_token_t src_token;
+    OS_object_token_t dst_token;
+    int32             return_code;
 
-    /* Check Parameters */
-    OS_CHECK_POINTER(src);
-    OS_CHECK_POINTER(dest);
+    *copied = 0;
 
-    file1       = OS_OBJECT_ID_UNDEFINED;
-    file2       = OS_OBJECT_ID_UNDEFINED;
-    return_code = OS_OpenCreate(&file1, src, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, src_fd, &src_token);
     if (return_code == OS_SUCCESS)
     {
-        return_code = OS_OpenCreate(&file2, dest, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, dst_fd, &dst_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_FileCopyRange_Impl(&src_token, src_off, &dst_token, dst_off, len, copied);
+
+            OS_ObjectIdRelease(&dst_token);
+        }
+
+        OS_ObjectIdRelease(&src_token);
     }
 
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Helper function to copy the remainder of one open file to another,
+ * one block at a time through a local buffer.  This is used by OS_cp()
+ * when the implementation cannot copy the file by itself.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_cp_CopyBlocks(osal_id_t file1, osal_id_t file2)
+{
+    int32 return_code;
+    int32 rd_size;
+    int32 wr_size;
+    int32 wr_total;
+    uint8 copyblock[OS_CP_BLOCK_SIZE];
+
+    return_code = OS_SUCCESS;
     while (return_code == OS_SUCCESS)
     {
         rd_size = OS_read(file1, copyblock, sizeof(copyblock));
@@ -457,6 +894,44 @@ int32 OS_cp(const char *src, const char *dest)
         }
     }
 
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_cp(const char *src, const char *dest)
+{
+    int32         return_code;
+    osal_id_t     file1;
+    osal_id_t     file2;
+    osal_offset_t copied;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(src);
+    OS_CHECK_POINTER(dest);
+
+    file1       = OS_OBJECT_ID_UNDEFINED;
+    file2       = OS_OBJECT_ID_UNDEFINED;
+    return_code = OS_OpenCreate(&file1, src, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_OpenCreate(&file2, dest, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    }
+
+    if (return_code == OS_SUCCESS)
+    {
+        /* Let the implementation copy the whole file where possible, then fall back to block copies */
+        return_code = OS_FileCopyRangeById(file1, 0, file2, 0, -1, &copied);
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            return_code = OS_cp_CopyBlocks(file1, file2);
+        }
+    }
+
     if (OS_ObjectIdDefined(file1))
     {
         OS_close(file1);
@@ -469,6 +944,31 @@ int32 OS_cp(const char *src, const char *dest)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_offset_t src_off, osal_id_t dst_fd, osal_offset_t dst_off,
+                       osal_offset_t len)
+{
+    int32         return_code;
+    osal_offset_t copied;
+
+    /* Check Parameters */
+    ARGCHECK(src_off >= 0 && dst_off >= 0 && len >= 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_FileCopyRangeById(src_fd, src_off, dst_fd, dst_off, len, &copied);
+    if (return_code == OS_SUCCESS && copied < len)
+    {
+        /* the source file ended before the whole range was copied */
+        return_code = OS_ERR_INVALID_SIZE;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -53,6 +53,17 @@ enum
  */
 OS_filesys_internal_record_t OS_filesys_table[LOCAL_NUM_OBJECTS];
 
+/*
+ * Lookup table of the mounted file systems, used by OS_TranslatePath()
+ */
+OS_filesys_mount_table_t OS_filesys_mount_table;
+
+/*
+ * FNV-1a parameters for hashing the virtual mount points
+ */
+#define OS_FILESYS_MOUNT_HASH_BASIS 2166136261U
+#define OS_FILESYS_MOUNT_HASH_PRIME 16777619U
+
 /*
  * A string that should be the prefix of RAM disk volume names, which
  * provides a hint that the file system refers to a RAM disk.
@@ -120,6 +131,191 @@ bool OS_FileSys_FindVirtMountPoint(void *ref, const OS_object_token_t *token, co
     return (target[mplen] == '/' || target[mplen] == 0);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Rebuilds the mount point table from the file system table.
+ *           Must be called after any change to the mounted file systems.
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileSys_UpdateMountTable(void)
+{
+    OS_object_iter_t              iter;
+    OS_filesys_internal_record_t *filesys;
+    OS_filesys_mount_entry_t *    entry;
+    uint32                        num_entries;
+    uint32                        slot;
+    size_t                        pos;
+
+    /* The iterator holds the global table lock, so only one task rebuilds the table at a time */
+    if (OS_ObjectIdIterateActive(LOCAL_OBJID_TYPE, &iter) != OS_SUCCESS)
+    {
+        /*
+         * The table may no longer match the file systems, so leave the generation
+         * odd.  Lookups then fall back to searching under the lock until the next
+         * successful rebuild.  If a rebuild is in progress it already includes the
+         * change, as that was made under the lock the rebuild holds.
+         */
+        atomic_fetch_or_explicit(&OS_filesys_mount_table.generation, 1, memory_order_release);
+        return;
+    }
+
+    /*
+     * An odd generation tells readers that the table is changing.  It may
+     * already be odd if an earlier rebuild could not be done.
+     */
+    atomic_fetch_or_explicit(&OS_filesys_mount_table.generation, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    memset(OS_filesys_mount_table.index, 0, sizeof(OS_filesys_mount_table.index));
+    num_entries = 0;
+
+    while (OS_ObjectIdIteratorGetNext(&iter))
+    {
+        filesys = OS_OBJECT_TABLE_GET(OS_filesys_table, iter.token);
+        entry   = &OS_filesys_mount_table.entries[num_entries];
+
+        if ((filesys->flags & (OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL)) !=
+            (OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL))
+        {
+            continue;
+        }
+
+        entry->virtual_len = OS_strnlen(filesys->virtual_mountpt, sizeof(filesys->virtual_mountpt));
+        entry->system_len  = OS_strnlen(filesys->system_mountpt, sizeof(filesys->system_mountpt));
+
+        /*
+         * Entries that can not be copied whole are left out, which
+         * makes OS_TranslatePath() fall back to searching under the lock.
+         */
+        if (entry->virtual_len == 0 || entry->virtual_len >= sizeof(entry->virtual_mountpt) ||
+            entry->system_len >= sizeof(entry->system_mountpt))
+        {
+            continue;
+        }
+
+        memcpy(entry->virtual_mountpt, filesys->virtual_mountpt, entry->virtual_len);
+        memcpy(entry->system_mountpt, filesys->system_mountpt, entry->system_len);
+
+        entry->hash = OS_FILESYS_MOUNT_HASH_BASIS;
+        for (pos = 0; pos < entry->virtual_len; ++pos)
+        {
+            entry->hash = (entry->hash ^ (uint8)entry->virtual_mountpt[pos]) * OS_FILESYS_MOUNT_HASH_PRIME;
+        }
+
+        /*
+         * Linear probing keeps entries in table order along each chain, so if
+         * two file systems share a mount point the first one is found as before
+         */
+        slot = entry->hash % OS_FILESYS_MOUNT_HASH_SIZE;
+        while (OS_filesys_mount_table.index[slot] != 0)
+        {
+            slot = (slot + 1) % OS_FILESYS_MOUNT_HASH_SIZE;
+        }
+
+        ++num_entries;
+        OS_filesys_mount_table.index[slot] = num_entries;
+    }
+
+    atomic_fetch_add_explicit(&OS_filesys_mount_table.generation, 1, memory_order_release);
+
+    OS_ObjectIdIteratorDestroy(&iter);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the longest mount point in the mount point table that
+ *           is a prefix of the path, ending at a directory separator or
+ *           at the end of the path.  This does not take any lock.
+ *
+ *           On success the system mount point is copied to the start of
+ *           LocalPath (not terminated) and the lengths are output.
+ *
+ *  Returns: true if a mount point was found, false if the path
+ *           needs to be looked up under the lock instead
+ *
+ *-----------------------------------------------------------------*/
+bool OS_FileSys_LookupMountTable(const char *VirtualPath, size_t VirtPathLen, char *LocalPath, size_t *VirtPathBegin,
+                                 size_t *SysMountPointLen)
+{
+    const OS_filesys_mount_entry_t *entry;
+    const OS_filesys_mount_entry_t *match;
+    uint32                          generation;
+    uint32                          attempt;
+    uint32                          hash;
+    uint32                          slot;
+    uint32                          probes;
+    uint32                          entry_num;
+    size_t                          pos;
+    bool                            found;
+
+    for (attempt = 0; attempt < OS_FILESYS_MOUNT_LOOKUP_ATTEMPTS; ++attempt)
+    {
+        generation = atomic_load_explicit(&OS_filesys_mount_table.generation, memory_order_acquire);
+        if ((generation & 1) != 0)
+        {
+            /* table is being rebuilt */
+            continue;
+        }
+
+        /*
+         * Hash the path once, probing for a mount point at each directory
+         * separator and at the end, so a later (longer) match replaces an earlier one.
+         *
+         * The table may change while it is read here, so everything read from
+         * it is range checked and only used if the generation is unchanged after.
+         */
+        match = NULL;
+        hash  = OS_FILESYS_MOUNT_HASH_BASIS;
+        for (pos = 1; pos <= VirtPathLen; ++pos)
+        {
+            hash = (hash ^ (uint8)VirtualPath[pos - 1]) * OS_FILESYS_MOUNT_HASH_PRIME;
+            if (pos != VirtPathLen && VirtualPath[pos] != '/')
+            {
+                continue;
+            }
+
+            slot = hash % OS_FILESYS_MOUNT_HASH_SIZE;
+            for (probes = 0; probes < OS_FILESYS_MOUNT_HASH_SIZE; ++probes)
+            {
+                entry_num = OS_filesys_mount_table.index[slot];
+                if (entry_num == 0 || entry_num > OS_MAX_FILE_SYSTEMS)
+                {
+                    break;
+                }
+
+                entry = &OS_filesys_mount_table.entries[entry_num - 1];
+                if (entry->hash == hash && entry->virtual_len == pos &&
+                    strncmp(entry->virtual_mountpt, VirtualPath, pos) == 0)
+                {
+                    match = entry;
+                    break;
+                }
+
+                slot = (slot + 1) % OS_FILESYS_MOUNT_HASH_SIZE;
+            }
+        }
+
+        found = false;
+        if (match != NULL && match->system_len < OS_MAX_LOCAL_PATH_LEN)
+        {
+            *SysMountPointLen = match->system_len;
+            *VirtPathBegin    = match->virtual_len;
+            memcpy(LocalPath, match->system_mountpt, *SysMountPointLen);
+            found = true;
+        }
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&OS_filesys_mount_table.generation, memory_order_relaxed) == generation)
+        {
+            return found;
+        }
+    }
+
+    return false;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -228,6 +424,7 @@ int32 OS_FileSysAPI_Init(void)
     int32 return_code = OS_SUCCESS;
 
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(&OS_filesys_mount_table, 0, sizeof(OS_filesys_mount_table));
 
     return return_code;
 }
@@ -290,6 +487,11 @@ int32 OS_FileSysAddFixedMap(osal_id_t *filesys_id, const char *phys_path, const
 
         /* Check result, finalize record, and unlock global table. */
         return_code = OS_ObjectIdFinalizeNew(return_code, &token, filesys_id);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_UpdateMountTable();
+        }
     }
 
     return return_code;
@@ -351,6 +553,12 @@ int32 OS_rmfs(const char *devname)
 
         /* Free the entry in the master table  */
         return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+
+        /* In case the file system was still mounted */
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_UpdateMountTable();
+        }
     }
     else
     {
@@ -442,6 +650,11 @@ int32 OS_mount(const char *devname, const char *mountpoint)
         }
 
         OS_ObjectIdRelease(&token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_UpdateMountTable();
+        }
     }
 
     if (return_code != OS_SUCCESS)
@@ -500,6 +713,11 @@ int32 OS_unmount(const char *mountpoint)
         }
 
         OS_ObjectIdRelease(&token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_UpdateMountTable();
+        }
     }
 
     if (return_code != OS_SUCCESS)
@@ -702,33 +920,44 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
         return OS_FS_ERR_PATH_INVALID;
     }
 
-    /* Get a reference lock, as a filesystem check could take some time. */
-    return_code = OS_ObjectIdGetBySearch(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, OS_FileSys_FindVirtMountPoint,
-                                         (void *)VirtualPath, &token);
-
-    if (return_code != OS_SUCCESS)
+    /*
+     * Most paths are found in the mount point table without taking any lock.
+     * Otherwise search the file system table, so that the error is reported as before.
+     */
+    if (OS_FileSys_LookupMountTable(VirtualPath, VirtPathLen, LocalPath, &VirtPathBegin, &SysMountPointLen))
     {
-        return_code = OS_FS_ERR_PATH_INVALID;
+        return_code = OS_SUCCESS;
     }
     else
     {
-        filesys = OS_OBJECT_TABLE_GET(OS_filesys_table, token);
+        /* Get a reference lock, as a filesystem check could take some time. */
+        return_code = OS_ObjectIdGetBySearch(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, OS_FileSys_FindVirtMountPoint,
+                                             (void *)VirtualPath, &token);
 
-        if ((filesys->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
+        if (return_code != OS_SUCCESS)
         {
-            SysMountPointLen = OS_strnlen(filesys->system_mountpt, sizeof(filesys->system_mountpt));
-            VirtPathBegin    = OS_strnlen(filesys->virtual_mountpt, sizeof(filesys->virtual_mountpt));
-            if (SysMountPointLen < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(LocalPath, filesys->system_mountpt, SysMountPointLen);
-            }
+            return_code = OS_FS_ERR_PATH_INVALID;
         }
         else
         {
-            return_code = OS_ERR_INCORRECT_OBJ_STATE;
-        }
+            filesys = OS_OBJECT_TABLE_GET(OS_filesys_table, token);
 
-        OS_ObjectIdRelease(&token);
+            if ((filesys->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
+            {
+                SysMountPointLen = OS_strnlen(filesys->system_mountpt, sizeof(filesys->system_mountpt));
+                VirtPathBegin    = OS_strnlen(filesys->virtual_mountpt, sizeof(filesys->virtual_mountpt));
+                if (SysMountPointLen < OS_MAX_LOCAL_PATH_LEN)
+                {
+                    memcpy(LocalPath, filesys->system_mountpt, SysMountPointLen);
+                }
+            }
+            else
+            {
+                return_code = OS_ERR_INCORRECT_OBJ_STATE;
+            }
+
+            OS_ObjectIdRelease(&token);
+        }
     }
 
     if (return_code == OS_SUCCESS)
@@ -37,6 +37,250 @@
  * User defined include files
  */
 #include "os-shared-heap.h"
+#include "os-shared-task.h"
+#include "os-shared-idmap.h"
+
+OS_heap_task_cache_t OS_heap_task_cache_table[OS_MAX_TASKS];
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns the smallest size class that can hold size bytes,
+ *           or OS_HEAP_NUM_CLASSES if the block is too large to cache
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_HeapSizeClass(size_t size)
+{
+    uint32 size_class;
+
+    size_class = 0;
+    while (size_class < OS_HEAP_NUM_CLASSES && size > (OS_HEAP_MIN_CLASS_SIZE << size_class))
+    {
+        ++size_class;
+    }
+
+    return size_class;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns the cache slot for the given task, or NULL if
+ *           the ID does not refer to a task
+ *
+ *-----------------------------------------------------------------*/
+static OS_heap_task_cache_t *OS_HeapGetTaskCache(osal_id_t task_id)
+{
+    osal_index_t index;
+
+    if (!OS_ObjectIdDefined(task_id) ||
+        OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, task_id, &index) != OS_SUCCESS || index >= OS_MAX_TASKS)
+    {
+        return NULL;
+    }
+
+    return &OS_heap_task_cache_table[index];
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Charges (adds) or credits (subtracts) size bytes to the
+ *           given owner.  Charging a slot still owned by a previous
+ *           task takes it over and restarts the count from zero.
+ *           Crediting a slot that has since been taken over does nothing.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_HeapUpdateUsage(OS_heap_task_cache_t *cache, unsigned long owner, size_t size, bool charge)
+{
+    uint_least64_t old_usage;
+    uint_least64_t new_usage;
+    uint_least64_t bytes;
+
+    old_usage = atomic_load(&cache->usage);
+    do
+    {
+        if ((old_usage >> 32) == owner)
+        {
+            bytes = old_usage & OS_HEAP_USAGE_BYTES_MAX;
+        }
+        else if (charge)
+        {
+            bytes = 0;
+        }
+        else
+        {
+            return;
+        }
+
+        if (charge)
+        {
+            bytes = (size < OS_HEAP_USAGE_BYTES_MAX - bytes) ? (bytes + size) : OS_HEAP_USAGE_BYTES_MAX;
+        }
+        else
+        {
+            bytes = (size < bytes) ? (bytes - size) : 0;
+        }
+
+        new_usage = ((uint_least64_t)owner << 32) | bytes;
+    } while (!atomic_compare_exchange_weak(&cache->usage, &old_usage, new_usage));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_HeapAlloc(void **ptr, size_t size)
+{
+    OS_heap_task_cache_t *cache;
+    OS_heap_block_hdr_t * hdr;
+    osal_id_t             task_id;
+    uint32                size_class;
+    size_t                alloc_size;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(ptr);
+    OS_CHECK_SIZE(size);
+
+    size_class = OS_HeapSizeClass(size);
+    if (size_class < OS_HEAP_NUM_CLASSES)
+    {
+        alloc_size = OS_HEAP_MIN_CLASS_SIZE << size_class;
+    }
+    else
+    {
+        alloc_size = size;
+    }
+
+    /* The header is allocated along with the block, after rounding up to the size class */
+    ARGCHECK(alloc_size <= (SIZE_MAX - sizeof(OS_heap_block_hdr_t)), OS_ERR_INVALID_SIZE);
+
+    /*
+     * Memory is only cached and charged for OSAL tasks.  Other threads
+     * (e.g. before OS_API_Init, or not created via OSAL) use the system
+     * allocator directly.
+     */
+    task_id = OS_TaskGetId_Impl();
+    cache   = OS_HeapGetTaskCache(task_id);
+    hdr     = NULL;
+
+    if (cache != NULL && size_class < OS_HEAP_NUM_CLASSES && cache->free_list[size_class] != NULL)
+    {
+        hdr                          = cache->free_list[size_class];
+        cache->free_list[size_class] = *((void **)(hdr + 1));
+        atomic_fetch_sub(&cache->free_count[size_class], 1);
+    }
+
+    if (hdr == NULL)
+    {
+        hdr = malloc(sizeof(*hdr) + alloc_size);
+        if (hdr == NULL)
+        {
+            return OS_ERROR;
+        }
+    }
+
+    hdr->info.size_class = size_class;
+    hdr->info.size       = alloc_size;
+    if (cache != NULL)
+    {
+        /* The first allocation by a new task in the slot restarts the usage counter */
+        hdr->info.owner = OS_ObjectIdToInteger(task_id);
+        OS_HeapUpdateUsage(cache, hdr->info.owner, alloc_size, true);
+    }
+    else
+    {
+        hdr->info.owner = 0;
+    }
+
+    *ptr = hdr + 1;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_HeapFree(void *ptr)
+{
+    OS_heap_task_cache_t *cache;
+    OS_heap_block_hdr_t * hdr;
+    uint32                size_class;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(ptr);
+
+    hdr        = ((OS_heap_block_hdr_t *)ptr) - 1;
+    size_class = hdr->info.size_class;
+
+    /*
+     * Credit the task that allocated the block, unless it has since
+     * been deleted and its slot reused, which resets the counter.
+     */
+    if (hdr->info.owner != 0)
+    {
+        cache = OS_HeapGetTaskCache(OS_ObjectIdFromInteger(hdr->info.owner));
+        if (cache != NULL)
+        {
+            OS_HeapUpdateUsage(cache, hdr->info.owner, hdr->info.size, false);
+        }
+    }
+
+    /* The block goes to the cache of the task freeing it, if there is room */
+    cache = OS_HeapGetTaskCache(OS_TaskGetId_Impl());
+    if (cache != NULL && size_class < OS_HEAP_NUM_CLASSES &&
+        atomic_load(&cache->free_count[size_class]) < OS_HEAP_CACHE_DEPTH)
+    {
+        *((void **)ptr)              = cache->free_list[size_class];
+        cache->free_list[size_class] = hdr;
+        atomic_fetch_add(&cache->free_count[size_class], 1);
+    }
+    else
+    {
+        free(hdr);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_HeapGetTaskUsage(osal_id_t task_id, size_t *bytes)
+{
+    OS_heap_task_cache_t *cache;
+    uint_least64_t        usage;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(bytes);
+
+    cache = OS_HeapGetTaskCache(task_id);
+    if (cache == NULL)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    /* A task that has not allocated anything does not own the slot yet */
+    usage = atomic_load(&cache->usage);
+    if ((usage >> 32) == OS_ObjectIdToInteger(task_id))
+    {
+        *bytes = usage & OS_HEAP_USAGE_BYTES_MAX;
+    }
+    else
+    {
+        *bytes = 0;
+    }
+
+    return OS_SUCCESS;
+}
 
 /*----------------------------------------------------------------
  *
@@ -46,8 +290,42 @@
  *-----------------------------------------------------------------*/
 int32 OS_HeapGetInfo(OS_heap_prop_t *heap_prop)
 {
+    uint32 idx;
+    uint32 size_class;
+    uint32 count;
+    int32  return_code;
+
     /* Check parameters */
     OS_CHECK_POINTER(heap_prop);
 
-    return OS_HeapGetInfo_Impl(heap_prop);
+    return_code = OS_HeapGetInfo_Impl(heap_prop);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    /*
+     * Blocks held in the task caches are also free, as far as the application is concerned.
+     * If the largest free block is unknown, a cached block does not make it known.
+     */
+    for (idx = 0; idx < OS_MAX_TASKS; ++idx)
+    {
+        for (size_class = 0; size_class < OS_HEAP_NUM_CLASSES; ++size_class)
+        {
+            count = atomic_load(&OS_heap_task_cache_table[idx].free_count[size_class]);
+            if (count != 0)
+            {
+                heap_prop->free_bytes += count * (OS_HEAP_MIN_CLASS_SIZE << size_class);
+                heap_prop->free_blocks += count;
+
+                if (heap_prop->largest_free_block != 0 &&
+                    heap_prop->largest_free_block < (OS_HEAP_MIN_CLASS_SIZE << size_class))
+                {
+                    heap_prop->largest_free_block = OS_HEAP_MIN_CLASS_SIZE << size_class;
+                }
+            }
+        }
+    }
+
+    return OS_SUCCESS;
 }
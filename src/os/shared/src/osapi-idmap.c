@@ -46,6 +46,7 @@
 /*
  * User defined include files
  */
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-task.h"
@@ -75,20 +76,63 @@ typedef struct
 /* Tables where the OS object information is stored */
 static OS_common_record_t OS_common_table[OS_MAX_TOTAL_RECORDS];
 
+/*
+ * The state of each object type is updated with every lock of its table,
+ * so each one occupies its own cache line(s).
+ */
 typedef struct
 {
     /* Keep track of the last successfully-issued object ID of each type */
-    osal_id_t last_id_issued;
+    OS_CACHE_ALIGNED osal_id_t last_id_issued;
 
     /* The number of individual transactions (lock/unlock cycles) on this type */
     uint32 transaction_count;
 
     /* The key required to unlock this table */
     osal_key_t owner_key;
+
+#ifdef OSAL_CONFIG_LOCK_STATS
+    /* The number of tasks holding or waiting for the table lock */
+    atomic_uint lock_requests;
+
+    /* The time when, and task by which, the table was last locked */
+    OS_time_t lock_time;
+    osal_id_t lock_task_id;
+
+    /* Accumulated statistics, only updated while holding the lock */
+    OS_lock_stats_t lock_stats;
+#endif
 } OS_objtype_state_t;
 
+CompileTimeAssert(sizeof(OS_objtype_state_t) % OS_CACHE_LINE_SIZE == 0, ObjTypeStateSize);
+
 OS_objtype_state_t OS_objtype_state[OS_OBJECT_TYPE_USER];
 
+/*
+ * Name index entries, one per entry in OS_common_table.
+ *
+ * Each object type uses the same slice of this table as it does in the
+ * common table, and the number of hash buckets for a type is equal to the
+ * number of objects of that type, so the load factor never exceeds 1.
+ *
+ * All index values here are local (per-type) record indices offset by 1,
+ * such that a zero value indicates empty/end of chain.  This permits the
+ * table to be initialized with a simple memset().
+ */
+typedef struct
+{
+    /* First record in the hash chain for the bucket at this position */
+    uint32 bucket_head;
+
+    /* Next record in the same hash chain as this record */
+    uint32 chain_next;
+
+    /* The bucket that this record is currently linked into */
+    uint32 chain_bucket;
+} OS_name_index_entry_t;
+
+static OS_name_index_entry_t OS_name_index[OS_MAX_TOTAL_RECORDS];
+
 OS_common_record_t *const OS_global_task_table      = &OS_common_table[OS_TASK_BASE];
 OS_common_record_t *const OS_global_queue_table     = &OS_common_table[OS_QUEUE_BASE];
 OS_common_record_t *const OS_global_bin_sem_table   = &OS_common_table[OS_BINSEM_BASE];
@@ -102,6 +146,21 @@ OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
+OS_common_record_t *const OS_global_poller_table    = &OS_common_table[OS_POLLER_BASE];
+OS_common_record_t *const OS_global_mempool_table   = &OS_common_table[OS_MEMPOOL_BASE];
+
+/*
+ * When the reference count may be adjusted outside of the global table lock,
+ * a full memory barrier is required between writing one of active_id/refcount
+ * and reading the other.  Both the lock-free acquire path and the EXCLUSIVE
+ * lock path do this, in opposite order, which guarantees that at least one
+ * of them observes the other and backs off.
+ */
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+#define OS_IDMAP_FULL_BARRIER() atomic_thread_fence(memory_order_seq_cst)
+#else
+#define OS_IDMAP_FULL_BARRIER()
+#endif
 
 /*
  *********************************************************************************
@@ -119,6 +178,7 @@ int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+    memset(OS_name_index, 0, sizeof(OS_name_index));
     return OS_SUCCESS;
 }
 
@@ -157,6 +217,10 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_CONSOLES;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_MAX_CONDVARS;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            return OS_MAX_POLLERS;
+        case OS_OBJECT_TYPE_OS_MEMPOOL:
+            return OS_MAX_MEMPOOLS;
         default:
             return 0;
     }
@@ -197,6 +261,10 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_CONSOLE_BASE;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_CONDVAR_BASE;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            return OS_POLLER_BASE;
+        case OS_OBJECT_TYPE_OS_MEMPOOL:
+            return OS_MEMPOOL_BASE;
         default:
             return 0;
     }
@@ -271,6 +339,141 @@ bool OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_comm
     return (obj->name_entry != NULL && strcmp((const char *)ref, obj->name_entry) == 0);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the hash value of an object name for the name index
+ *           (this is the 32-bit FNV-1a algorithm)
+ *
+ *  returns: hash value
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectNameHash(const char *name)
+{
+    uint32 hash = 2166136261U;
+
+    while (*name != 0)
+    {
+        hash ^= (uint8)*name;
+        hash *= 16777619U;
+        ++name;
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Decrements the reference count of the record, if nonzero
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdRefcountDecrement(OS_common_record_t *record)
+{
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+    uint_least16_t count;
+
+    count = atomic_load(&record->refcount);
+    while (count > 0 && !atomic_compare_exchange_weak(&record->refcount, &count, count - 1))
+    {
+        /* count was reloaded by the failed exchange, try again */
+    }
+#else
+    if (record->refcount > 0)
+    {
+        --record->refcount;
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Advances the state sequence of the record after a change,
+ *           and wakes any tasks waiting on that record.
+ *
+ *   Only tasks waiting on this specific record are woken, and the
+ *   impl layer is only invoked if a task has flagged that it is waiting.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdNotifyStateChange(const OS_object_token_t *token, OS_common_record_t *record)
+{
+    if ((atomic_fetch_add(&record->state_seq, OS_OBJECT_STATE_SEQ_INCR) & OS_OBJECT_STATE_WAITERS) != 0)
+    {
+        atomic_fetch_and(&record->state_seq, ~OS_OBJECT_STATE_WAITERS);
+        OS_NotifyStateChange_Impl(token->obj_type, &record->state_seq);
+    }
+}
+
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases a REFCOUNT lock without using the global table lock
+ *
+ *   If an EXCLUSIVE request is pending on the record (i.e. the ID is
+ *   currently RESERVED) then the requester may be waiting for the refcount
+ *   to drop, so it is notified of the change.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdRefcountReleaseFast(OS_object_token_t *token)
+{
+    OS_common_record_t *record;
+
+    record = OS_ObjectIdGlobalFromToken(token);
+
+    OS_ObjectIdRefcountDecrement(record);
+    OS_IDMAP_FULL_BARRIER();
+
+    if (OS_ObjectIdEqual(record->active_id, OS_OBJECT_ID_RESERVED))
+    {
+        OS_ObjectIdNotifyStateChange(token, record);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Attempts to obtain a REFCOUNT lock without using the global table lock
+ *
+ *   The refcount is incremented first and the ID is checked afterward.  If
+ *   the ID does not match then the increment is undone and false is returned,
+ *   in which case the caller should use the normal (locked) path, which also
+ *   takes care of waiting and returning the appropriate error code.
+ *
+ *  returns: true if the token was successfully locked in REFCOUNT mode
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectIdRefcountAcquireFast(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+
+    if (OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, idtype, token) != OS_SUCCESS ||
+        OS_ObjectIdToArrayIndex(idtype, id, &token->obj_idx) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    token->obj_id    = id;
+    token->lock_mode = OS_LOCK_MODE_REFCOUNT;
+    obj              = OS_ObjectIdGlobalFromToken(token);
+
+    atomic_fetch_add(&obj->refcount, 1);
+    OS_IDMAP_FULL_BARRIER();
+
+    if (!OS_ObjectIdEqual(obj->active_id, id))
+    {
+        OS_ObjectIdRefcountReleaseFast(token);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return false;
+    }
+
+    return true;
+}
+
+#endif /* OSAL_CONFIG_LOCKFREE_REFCOUNT */
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -383,6 +586,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
 {
     int32               return_code = OS_ERROR;
     uint32              attempts    = 0;
+    uint32              state_seq;
     OS_common_record_t *obj;
     osal_id_t           expected_id;
 
@@ -413,6 +617,10 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
 
     while (true)
     {
+        /* This must be read before checking the record, so that if the record
+         * changes after the check then OS_WaitForStateChange() does not block */
+        state_seq = atomic_load(&obj->state_seq);
+
         /* Validate the integrity of the ID.  As the "active_id" is a single
          * integer, we can do this check regardless of whether global is locked or not. */
         if (OS_ObjectIdEqual(obj->active_id, expected_id))
@@ -436,6 +644,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
                  */
+                OS_IDMAP_FULL_BARRIER();
                 if (obj->refcount == 0)
                 {
                     return_code = OS_SUCCESS;
@@ -465,18 +674,21 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
          *
          * In this case we will UNLOCK the global object again so that the holder
          * can relinquish it.  We'll try again a few times before giving up hope.
+         *
+         * The holder wakes this task as soon as it changes the record, which
+         * may take several changes (e.g. multiple refcounts being released),
+         * so only waits which time out without any change count as an attempt.
          */
-        ++attempts;
-        if (attempts >= 5)
+        if (attempts >= 4)
         {
             return_code = OS_ERR_OBJECT_IN_USE;
             break;
         }
 
-        /*
-         * Call the impl layer to wait for some sort of change to occur.
-         */
-        OS_WaitForStateChange(token, attempts);
+        if (OS_WaitForStateChange(token, state_seq, attempts + 1) != OS_SUCCESS)
+        {
+            ++attempts;
+        }
     }
 
     /*
@@ -517,6 +729,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * (note it had to match initially before overwrite)
              */
             obj->active_id = OS_ObjectIdFromToken(token);
+            OS_ObjectIdNotifyStateChange(token, obj);
         }
     }
 
@@ -569,6 +782,66 @@ int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_obj
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an existing object with the given name using the name index.
+ *           Matching object ID and index are stored in the token.
+ *
+ *           If several objects share the same name, the one with the lowest
+ *           index is returned, consistent with OS_ObjectIdFindNextMatch().
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+    int32                  return_code;
+    uint32                 obj_count;
+    uint32                 base_id;
+    uint32                 local_id;
+    uint32                 steps;
+    OS_common_record_t *   record;
+    OS_name_index_entry_t *index;
+
+    return_code    = OS_ERR_NAME_NOT_FOUND;
+    base_id        = OS_GetBaseForObjectType(token->obj_type);
+    obj_count      = OS_GetMaxForObjectType(token->obj_type);
+    token->obj_idx = OSAL_INDEX_C(-1);
+    token->obj_id  = OS_OBJECT_ID_UNDEFINED;
+
+    if (obj_count > 0)
+    {
+        index    = &OS_name_index[base_id];
+        local_id = index[OS_ObjectNameHash(name) % obj_count].bucket_head;
+
+        /*
+         * Note the step limit here is not expected to be reached, but it guarantees
+         * termination in case this is called with OS_LOCK_MODE_NONE while another
+         * task is modifying the chain.
+         */
+        for (steps = 0; local_id != 0 && local_id <= obj_count && steps < obj_count; ++steps)
+        {
+            record = &OS_common_table[base_id + local_id - 1];
+
+            if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record) &&
+                (return_code != OS_SUCCESS || (local_id - 1) < token->obj_idx))
+            {
+                return_code    = OS_SUCCESS;
+                token->obj_idx = OSAL_INDEX_C(local_id - 1);
+                token->obj_id  = record->active_id;
+            }
+
+            local_id = index[local_id - 1].chain_next;
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -639,7 +912,14 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
         obj->active_id  = token->obj_id;
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
+#ifndef OSAL_CONFIG_LOCKFREE_REFCOUNT
+        /*
+         * Note when lock-free refcounts are enabled, a task using a stale ID
+         * may have transiently incremented this, and it will decrement it again
+         * momentarily, so it must not be reset here.
+         */
+        obj->refcount = 0;
+#endif
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -663,6 +943,121 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
  *********************************************************************************
  */
 
+/*----------------------------------------------------------------
+
+    Purpose: Places the record in the name index under the given name
+             See description in prototype
+ ------------------------------------------------------------------*/
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token, const char *name)
+{
+    uint32                 obj_count;
+    uint32                 local_id;
+    uint32                 bucket;
+    uint32 *               link;
+    OS_name_index_entry_t *index;
+
+    obj_count = OS_GetMaxForObjectType(token->obj_type);
+    if (token->obj_idx >= obj_count)
+    {
+        return;
+    }
+
+    index    = &OS_name_index[OS_GetBaseForObjectType(token->obj_type)];
+    local_id = token->obj_idx + 1;
+
+    /* First unlink the record from whatever chain it is currently part of */
+    if (index[token->obj_idx].chain_bucket != 0)
+    {
+        link = &index[index[token->obj_idx].chain_bucket - 1].bucket_head;
+        while (*link != 0 && *link != local_id)
+        {
+            link = &index[*link - 1].chain_next;
+        }
+
+        if (*link == local_id)
+        {
+            *link = index[token->obj_idx].chain_next;
+        }
+
+        index[token->obj_idx].chain_next   = 0;
+        index[token->obj_idx].chain_bucket = 0;
+    }
+
+    /* Then link it into the chain for the new name, if there is one */
+    if (name != NULL)
+    {
+        bucket = OS_ObjectNameHash(name) % obj_count;
+
+        index[token->obj_idx].chain_next   = index[bucket].bucket_head;
+        index[token->obj_idx].chain_bucket = bucket + 1;
+        index[bucket].bucket_head          = local_id;
+    }
+}
+
+#ifdef OSAL_CONFIG_LOCK_STATS
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *  Records the acquisition of a table lock in the statistics
+ *
+ *  NOTE: this must be called while the table is _LOCKED_
+ *
+ *-----------------------------------------------------------------*/
+static void OS_LockStatsAcquired(OS_objtype_state_t *objtype, osal_id_t task_id, OS_time_t request_time,
+                                 bool contended)
+{
+    OS_lock_stats_t *stats;
+    OS_time_t        wait_time;
+
+    stats = &objtype->lock_stats;
+
+    OS_GetMonotonicTime_Impl(&objtype->lock_time);
+    objtype->lock_task_id = task_id;
+
+    wait_time = OS_TimeSubtract(objtype->lock_time, request_time);
+
+    ++stats->acquire_count;
+    if (contended)
+    {
+        ++stats->contended_count;
+    }
+
+    stats->total_wait_time = OS_TimeAdd(stats->total_wait_time, wait_time);
+    if (OS_TimeCompare(wait_time, stats->max_wait_time) > 0)
+    {
+        stats->max_wait_time = wait_time;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *  Records the release of a table lock in the statistics
+ *
+ *  NOTE: this must be called while the table is _LOCKED_
+ *
+ *-----------------------------------------------------------------*/
+static void OS_LockStatsReleased(OS_objtype_state_t *objtype)
+{
+    OS_lock_stats_t *stats;
+    OS_time_t        hold_time;
+
+    stats = &objtype->lock_stats;
+
+    OS_GetMonotonicTime_Impl(&hold_time);
+    hold_time = OS_TimeSubtract(hold_time, objtype->lock_time);
+
+    stats->total_hold_time = OS_TimeAdd(stats->total_hold_time, hold_time);
+    if (OS_TimeCompare(hold_time, stats->max_hold_time) > 0)
+    {
+        stats->max_hold_time    = hold_time;
+        stats->max_hold_task_id = objtype->lock_task_id;
+    }
+}
+
+#endif /* OSAL_CONFIG_LOCK_STATS */
+
 /*----------------------------------------------------------------
 
     Purpose: Locks the global table identified by "idtype"
@@ -671,12 +1066,22 @@ void OS_Lock_Global(OS_object_token_t *token)
 {
     osal_id_t           self_task_id;
     OS_objtype_state_t *objtype;
+#ifdef OSAL_CONFIG_LOCK_STATS
+    OS_time_t request_time;
+    bool      contended;
+#endif
 
     if (token->obj_type < OS_OBJECT_TYPE_USER && token->lock_mode != OS_LOCK_MODE_NONE)
     {
         objtype      = &OS_objtype_state[token->obj_type];
         self_task_id = OS_TaskGetId_Impl();
 
+#ifdef OSAL_CONFIG_LOCK_STATS
+        /* If any other task holds or is waiting for the lock, this has to wait */
+        contended = (atomic_fetch_add(&objtype->lock_requests, 1) != 0);
+        OS_GetMonotonicTime_Impl(&request_time);
+#endif
+
         OS_Lock_Global_Impl(token->obj_type);
 
         /*
@@ -719,6 +1124,10 @@ void OS_Lock_Global(OS_object_token_t *token)
         {
             objtype->owner_key = token->lock_key;
         }
+
+#ifdef OSAL_CONFIG_LOCK_STATS
+        OS_LockStatsAcquired(objtype, self_task_id, request_time, contended);
+#endif
     }
     else
     {
@@ -759,6 +1168,11 @@ void OS_Unlock_Global(OS_object_token_t *token)
         objtype->owner_key = OS_LOCK_KEY_INVALID;
         token->lock_key    = OS_LOCK_KEY_INVALID;
 
+#ifdef OSAL_CONFIG_LOCK_STATS
+        OS_LockStatsReleased(objtype);
+        atomic_fetch_sub(&objtype->lock_requests, 1);
+#endif
+
         OS_Unlock_Global_Impl(token->obj_type);
     }
     else
@@ -771,16 +1185,32 @@ void OS_Unlock_Global(OS_object_token_t *token)
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *  Waits for a change in the global table identified by "idtype"
+ *  Waits for a change to the record referred to by the token
  *
  *  NOTE: this must be called while the table is _LOCKED_
  *  The "OS_WaitForStateChange_Impl" function should unlock + relock
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
+int32 OS_WaitForStateChange(OS_object_token_t *token, uint32 state_seq, uint32 attempts)
 {
     osal_key_t          saved_unlock_key;
     OS_objtype_state_t *objtype;
+    OS_common_record_t *record;
+
+    record = OS_ObjectIdGlobalFromToken(token);
+
+    /*
+     * Flag that a task is waiting so the next change wakes it.  If the
+     * record has already changed since state_seq was read then this fails,
+     * and the caller should check the record again rather than waiting.
+     */
+    if ((state_seq & OS_OBJECT_STATE_WAITERS) == 0 &&
+        !atomic_compare_exchange_strong(&record->state_seq, &state_seq, state_seq | OS_OBJECT_STATE_WAITERS))
+    {
+        return OS_SUCCESS;
+    }
+
+    state_seq |= OS_OBJECT_STATE_WAITERS;
 
     /*
      * This needs to release the lock, to allow other
@@ -795,18 +1225,36 @@ void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
     /* temporarily release the table */
     objtype->owner_key = OS_LOCK_KEY_INVALID;
 
+#ifdef OSAL_CONFIG_LOCK_STATS
+    /* Waiting for the state change does not count as holding the lock */
+    OS_LockStatsReleased(objtype);
+    atomic_fetch_sub(&objtype->lock_requests, 1);
+#endif
+
     /*
      * The implementation layer takes care of the actual unlock + wait.
      * This permits use of condition variables where these two actions
      * are done atomically.
      */
-    OS_WaitForStateChange_Impl(token->obj_type, attempts);
+    OS_WaitForStateChange_Impl(token->obj_type, &record->state_seq, state_seq, attempts);
 
     /*
      * After return, this task owns the table again
      */
     /* cppcheck-suppress redundantAssignment */
     objtype->owner_key = saved_unlock_key;
+
+#ifdef OSAL_CONFIG_LOCK_STATS
+    atomic_fetch_add(&objtype->lock_requests, 1);
+    OS_GetMonotonicTime_Impl(&objtype->lock_time);
+#endif
+
+    if (atomic_load(&record->state_seq) == state_seq)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    return OS_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -947,7 +1395,27 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectIdFindNameMatch(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        /*
+         * The "ConvertToken" routine will return with the global lock
+         * in a state appropriate for returning to the caller, as indicated
+         * by the "lock_mode" parameter.
+         */
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -1001,6 +1469,17 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+    /*
+     * The common case of a REFCOUNT lock on an object which is not being
+     * created or deleted does not need the global table lock at all.
+     */
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT && OS_ObjectIdRefcountAcquireFast(idtype, id, token))
+    {
+        return OS_SUCCESS;
+    }
+#endif
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1053,6 +1532,16 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         return;
     }
 
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL)
+    {
+        /* refcount is atomic, so no need to re-acquire global table lock */
+        OS_ObjectIdRefcountReleaseFast(token);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
+#endif
+
     record = OS_ObjectIdGlobalFromToken(token);
 
     /* re-acquire global table lock to adjust refcount */
@@ -1061,10 +1550,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
-    {
-        --record->refcount;
-    }
+    OS_ObjectIdRefcountDecrement(record);
 
     /*
      * at this point the global mutex is always held, either
@@ -1088,9 +1574,31 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         record->active_id = token->obj_id;
     }
 
+    /*
+     * Create, delete, and EXCLUSIVE operations are the only cases where
+     * the name of the record can change, so update the name index here.
+     */
+    if (final_id != NULL || token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
+    {
+        if (OS_ObjectIdDefined(record->active_id))
+        {
+            OS_ObjectIdNameIndexUpdate(token, record->name_entry);
+        }
+        else
+        {
+            OS_ObjectIdNameIndexUpdate(token, NULL);
+        }
+    }
+
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
     OS_Unlock_Global(token);
 
+    /*
+     * Wake any tasks waiting for the refcount or ID of this record to change.
+     * This is done after unlocking so they do not immediately block on the table lock.
+     */
+    OS_ObjectIdNotifyStateChange(token, record);
+
     /*
      * Setting to "NONE" indicates that this token has been
      * released, and should not be released again.
@@ -1167,7 +1675,7 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      */
     if (name != NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ObjectIdFindNameMatch(name, token);
     }
     else
     {
@@ -1193,6 +1701,13 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
     }
     else
     {
+        /*
+         * Index the new record under the requested name right away, so a
+         * concurrent request to create an object with the same name will
+         * see it.  It is re-indexed using the final name when completed.
+         */
+        OS_ObjectIdNameIndexUpdate(token, name);
+
         return_code = OS_NotifyEvent(OS_EVENT_RESOURCE_ALLOCATED, token->obj_id, NULL);
     }
 
@@ -1481,3 +1996,36 @@ int32 OS_ObjectIdToArrayIndex(osal_objtype_t idtype, osal_id_t object_id, osal_i
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectTypeGetLockStats(osal_objtype_t idtype, OS_lock_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_LOCK_STATS
+    int32             return_code;
+    OS_object_token_t token;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    /* Holding the table lock ensures the statistics are not updated while being copied */
+    return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_GLOBAL, idtype, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        *stats = OS_objtype_state[idtype].lock_stats;
+
+        OS_ObjectIdTransactionCancel(&token);
+    }
+
+    return return_code;
+#else
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
@@ -0,0 +1,480 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ * \ingroup  shared
+ *
+ *         Fixed-block memory pools.  The pool logic is entirely contained
+ *         in this layer; the OS-specific implementation only provides a
+ *         way for tasks to wait for a block to become available.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-clock.h"
+#include "os-shared-idmap.h"
+#include "os-shared-mempool.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_MEMPOOLS) || (OS_MAX_MEMPOOLS <= 0)
+#error "osconfig.h must define OS_MAX_MEMPOOLS to a valid value"
+#endif
+
+/* Alignment of every block, suitable for any type */
+#define OS_MEMPOOL_BLOCK_ALIGN _Alignof(max_align_t)
+
+/*
+ * Value of the next_free entry of a block owned by the application.  Blocks
+ * in the free list or a cache never have this value, so this tells whether a
+ * block passed to OS_MemPoolPut() has already been returned.
+ */
+#define OS_MEMPOOL_BLOCK_IN_USE UINT32_MAX
+
+OS_mempool_internal_record_t OS_mempool_table[OS_MAX_MEMPOOLS];
+
+/****************************************************************************************
+                                    LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Push a block number (offset by one) onto the free list
+ *
+ *-----------------------------------------------------------------*/
+static void OS_MemPoolPushFree(OS_mempool_internal_record_t *pool, uint32 block_num)
+{
+    uint_least64_t old_head;
+    uint_least64_t new_head;
+
+    old_head = atomic_load(&pool->free_head);
+    do
+    {
+        atomic_store_explicit(&pool->next_free[block_num - 1], (uint32)old_head, memory_order_relaxed);
+        new_head = (((old_head >> 32) + 1) << 32) | block_num;
+    } while (!atomic_compare_exchange_weak(&pool->free_head, &old_head, new_head));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Pop a block number (offset by one) from the free list,
+ *           returns 0 if the list is empty
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_MemPoolPopFree(OS_mempool_internal_record_t *pool)
+{
+    uint_least64_t old_head;
+    uint_least64_t new_head;
+    uint32         block_num;
+
+    old_head = atomic_load(&pool->free_head);
+    do
+    {
+        block_num = (uint32)old_head;
+        if (block_num == 0)
+        {
+            break;
+        }
+
+        /*
+         * Another task may pop this block and change its link before the
+         * exchange below, but then the counter in the head will have changed
+         * too, and the exchange will fail and try again with the new head.
+         */
+        new_head = (((old_head >> 32) + 1) << 32) |
+                   atomic_load_explicit(&pool->next_free[block_num - 1], memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak(&pool->free_head, &old_head, new_head));
+
+    return block_num;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Take a block number (offset by one) from the pool without
+ *           waiting, returns 0 if none is available
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_MemPoolTryGet(OS_mempool_internal_record_t *pool)
+{
+    uint32 cache_idx;
+    uint32 block_num;
+    uint32 free_count;
+    uint32 min_free_count;
+    uint32 i;
+
+    /* The cache for the current CPU is checked first, then the shared list */
+    cache_idx = OS_MemPoolGetCpu_Impl() % OS_MEMPOOL_NUM_CACHES;
+    block_num = 0;
+    if (atomic_load_explicit(&pool->cache[cache_idx].block, memory_order_relaxed) != 0)
+    {
+        block_num = atomic_exchange(&pool->cache[cache_idx].block, 0);
+    }
+
+    if (block_num == 0)
+    {
+        block_num = OS_MemPoolPopFree(pool);
+    }
+
+    /* The remaining free blocks may all be sitting in the caches of other CPUs */
+    for (i = 1; block_num == 0 && i < OS_MEMPOOL_NUM_CACHES; ++i)
+    {
+        cache_idx = (cache_idx + 1) % OS_MEMPOOL_NUM_CACHES;
+        if (atomic_load_explicit(&pool->cache[cache_idx].block, memory_order_relaxed) != 0)
+        {
+            block_num = atomic_exchange(&pool->cache[cache_idx].block, 0);
+        }
+    }
+
+    if (block_num != 0)
+    {
+        atomic_store_explicit(&pool->next_free[block_num - 1], OS_MEMPOOL_BLOCK_IN_USE, memory_order_relaxed);
+
+        free_count     = atomic_fetch_sub(&pool->free_count, 1) - 1;
+        min_free_count = atomic_load_explicit(&pool->min_free_count, memory_order_relaxed);
+        while (free_count < min_free_count &&
+               !atomic_compare_exchange_weak(&pool->min_free_count, &min_free_count, free_count))
+        {
+            /* retry with the updated min_free_count */
+        }
+    }
+
+    return block_num;
+}
+
+/****************************************************************************************
+                                    MEMORY POOL API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolAPI_Init(void)
+{
+    memset(OS_mempool_table, 0, sizeof(OS_mempool_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolCreate(osal_id_t *pool_id, const char *pool_name, size_t block_size, osal_blockcount_t num_blocks)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_mempool_internal_record_t *pool;
+    size_t                        stride;
+    uint32                        i;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pool_id);
+    OS_CHECK_APINAME(pool_name);
+    OS_CHECK_SIZE(block_size);
+    OS_CHECK_SIZE(num_blocks);
+
+    /* Each block also needs an entry in the next_free array */
+    stride = (block_size + OS_MEMPOOL_BLOCK_ALIGN - 1) & ~(OS_MEMPOOL_BLOCK_ALIGN - 1);
+    ARGCHECK(stride <= ((SIZE_MAX / num_blocks) - sizeof(atomic_uint)), OS_ERR_INVALID_SIZE);
+    ARGCHECK(num_blocks < OS_MEMPOOL_BLOCK_IN_USE, OS_ERR_INVALID_SIZE);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_MEMPOOL, pool_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        pool = OS_OBJECT_TABLE_GET(OS_mempool_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, pool, obj_name, pool_name);
+
+        pool->block_size     = block_size;
+        pool->stride         = stride;
+        pool->num_blocks     = num_blocks;
+        pool->free_count     = num_blocks;
+        pool->min_free_count = num_blocks;
+
+        pool->storage = malloc(num_blocks * (stride + sizeof(atomic_uint)));
+        if (pool->storage == NULL)
+        {
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            pool->next_free = (atomic_uint *)(pool->storage + (num_blocks * stride));
+
+            /* Initially all blocks are on the free list, in order */
+            for (i = 1; i <= num_blocks; ++i)
+            {
+                pool->next_free[i - 1] = (i < num_blocks) ? (i + 1) : 0;
+            }
+            pool->free_head = 1;
+
+            /* Now call the OS-specific implementation.  This reads info from the table. */
+            return_code = OS_MemPoolCreate_Impl(&token);
+            if (return_code != OS_SUCCESS)
+            {
+                free(pool->storage);
+                pool->storage = NULL;
+            }
+        }
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, pool_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolDelete(osal_id_t pool_id)
+{
+    OS_object_token_t             token;
+    OS_mempool_internal_record_t *pool;
+    int32                         return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_MEMPOOL, pool_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        pool = OS_OBJECT_TABLE_GET(OS_mempool_table, token);
+
+        return_code = OS_MemPoolDelete_Impl(&token);
+        if (return_code == OS_SUCCESS)
+        {
+            free(pool->storage);
+            pool->storage = NULL;
+        }
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolGet(osal_id_t pool_id, void **block, int32 timeout)
+{
+    OS_object_token_t             token;
+    OS_mempool_internal_record_t *pool;
+    OS_time_t                     abs_timeout;
+    OS_time_t *                   abs_timeout_ptr;
+    uint32                        block_num;
+    int32                         return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(block);
+
+    /*
+     * The refcount is held for the whole call, so the storage cannot be freed
+     * by OS_MemPoolDelete() while it is in use here, including while waiting.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_MEMPOOL, pool_id, &token);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    pool      = OS_OBJECT_TABLE_GET(OS_mempool_table, token);
+    block_num = OS_MemPoolTryGet(pool);
+
+    if (block_num == 0 && timeout != OS_CHECK)
+    {
+        if (timeout > 0)
+        {
+            OS_GetMonotonicTime_Impl(&abs_timeout);
+            abs_timeout     = OS_TimeAdd(abs_timeout, OS_TimeFromTotalMilliseconds(timeout));
+            abs_timeout_ptr = &abs_timeout;
+        }
+        else
+        {
+            abs_timeout_ptr = NULL;
+        }
+
+        do
+        {
+            return_code = OS_MemPoolWait_Impl(&token, abs_timeout_ptr);
+            block_num   = OS_MemPoolTryGet(pool);
+        } while (block_num == 0 && return_code == OS_SUCCESS);
+    }
+
+    if (block_num != 0)
+    {
+        *block      = pool->storage + ((block_num - 1) * pool->stride);
+        return_code = OS_SUCCESS;
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&pool->failed_gets, 1, memory_order_relaxed);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_ERROR_TIMEOUT;
+        }
+    }
+
+    OS_ObjectIdRelease(&token);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolPut(osal_id_t pool_id, void *block)
+{
+    OS_object_token_t             token;
+    OS_mempool_internal_record_t *pool;
+    size_t                        offset;
+    uint32                        block_num;
+    uint32                        expected;
+    int32                         return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(block);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_MEMPOOL, pool_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        pool = OS_OBJECT_TABLE_GET(OS_mempool_table, token);
+
+        /* Note a block below the start of the storage wraps around to a large offset */
+        offset = (cpuaddr)block - (cpuaddr)pool->storage;
+        if (offset >= (pool->num_blocks * pool->stride) || (offset % pool->stride) != 0)
+        {
+            return_code = OS_ERR_INVALID_ARGUMENT;
+        }
+        else
+        {
+            block_num = (offset / pool->stride) + 1;
+
+            /* Only one caller can take the block back from the application */
+            expected = OS_MEMPOOL_BLOCK_IN_USE;
+            if (!atomic_compare_exchange_strong(&pool->next_free[block_num - 1], &expected, 0))
+            {
+                return_code = OS_ERR_INCORRECT_OBJ_STATE;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            /* Prefer the cache for the current CPU, if it is empty */
+            expected = 0;
+            if (!atomic_compare_exchange_strong(&pool->cache[OS_MemPoolGetCpu_Impl() % OS_MEMPOOL_NUM_CACHES].block,
+                                                &expected, block_num))
+            {
+                OS_MemPoolPushFree(pool, block_num);
+            }
+
+            if (atomic_fetch_add(&pool->free_count, 1) == 0)
+            {
+                OS_MemPoolWake_Impl(&token);
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolGetIdByName(osal_id_t *pool_id, const char *pool_name)
+{
+    int32 return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(pool_id);
+    OS_CHECK_POINTER(pool_name);
+
+    return_code = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_MEMPOOL, pool_name, pool_id);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MemPoolGetInfo(osal_id_t pool_id, OS_mempool_prop_t *pool_prop)
+{
+    OS_common_record_t *          record;
+    OS_mempool_internal_record_t *pool;
+    OS_object_token_t             token;
+    int32                         return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pool_prop);
+
+    memset(pool_prop, 0, sizeof(OS_mempool_prop_t));
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_MEMPOOL, pool_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        record = OS_OBJECT_TABLE_GET(OS_global_mempool_table, token);
+        pool   = OS_OBJECT_TABLE_GET(OS_mempool_table, token);
+
+        strncpy(pool_prop->name, record->name_entry, sizeof(pool_prop->name) - 1);
+        pool_prop->creator         = record->creator;
+        pool_prop->block_size      = pool->block_size;
+        pool_prop->num_blocks      = OSAL_BLOCKCOUNT_C(pool->num_blocks);
+        pool_prop->free_blocks     = OSAL_BLOCKCOUNT_C(atomic_load(&pool->free_count));
+        pool_prop->min_free_blocks = OSAL_BLOCKCOUNT_C(atomic_load(&pool->min_free_count));
+        pool_prop->failed_gets     = atomic_load(&pool->failed_gets);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
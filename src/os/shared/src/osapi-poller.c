@@ -0,0 +1,228 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ *
+ *         This file  contains some of the OS APIs abstraction layer code
+ *         that is shared/common across all OS-specific implementations.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-idmap.h"
+#include "os-shared-poller.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_POLLERS) || (OS_MAX_POLLERS <= 0)
+#error "osconfig.h must define OS_MAX_POLLERS to a valid value"
+#endif
+
+OS_poller_internal_record_t OS_poller_table[OS_MAX_POLLERS];
+
+/****************************************************************************************
+                                      POLLER API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAPI_Init(void)
+{
+    memset(OS_poller_table, 0, sizeof(OS_poller_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options)
+{
+    int32                        return_code;
+    OS_object_token_t            token;
+    OS_poller_internal_record_t *poller;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(poller_id);
+    OS_CHECK_APINAME(poller_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_POLLER, poller_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        poller = OS_OBJECT_TABLE_GET(OS_poller_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, poller, obj_name, poller_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_PollerCreate_Impl(&token, options);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, poller_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerDelete(osal_id_t poller_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollerDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags)
+{
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_PollerAdd_Impl(&token, &stream_token, StateFlags);
+
+            OS_ObjectIdRelease(&stream_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid)
+{
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_PollerRemove_Impl(&token, &stream_token);
+
+            OS_ObjectIdRelease(&stream_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWaitAbs(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                       OS_time_t abs_timeout)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(events);
+    OS_CHECK_POINTER(num_events);
+    OS_CHECK_SIZE(max_events);
+
+    *num_events = 0;
+
+    /*
+     * The refcount is held while waiting, so the poller cannot be deleted
+     * out from under a task blocked in this call.  The file handles in the
+     * set are not locked, as a handle which is closed is simply no longer
+     * reported by the poller.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollerWait_Impl(&token, events, max_events, num_events, abs_timeout);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                    int32 msecs)
+{
+    return OS_PollerWaitAbs(poller_id, events, max_events, num_events, OS_TimeFromRelativeMilliseconds(msecs));
+}
@@ -46,10 +46,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /*
  * User defined include files
  */
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-printf.h"
@@ -64,12 +67,51 @@
 #define OS_CONSOLE_IS_ASYNC false
 #endif
 
-/* reserve buffer memory for the printf console device */
-static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
+/* reserve buffer memory for the printf console device, aligned for the record headers */
+#define OS_PRINTF_BUFFER_MEM_SIZE \
+    (OS_CONSOLE_REC_SIZE(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH)
+static atomic_uint OS_printf_buffer_mem[OS_PRINTF_BUFFER_MEM_SIZE / sizeof(atomic_uint)];
 
 /* The global console state table */
 OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
 
+/*
+ * The type of argument consumed by a printf conversion specification,
+ * for deferred formatting
+ */
+typedef enum
+{
+    OS_CONSOLE_ARG_NONE, /**< No argument, i.e. "%%" */
+    OS_CONSOLE_ARG_INT,
+    OS_CONSOLE_ARG_LONG,
+    OS_CONSOLE_ARG_LLONG,
+    OS_CONSOLE_ARG_SIZE,
+    OS_CONSOLE_ARG_INTMAX,
+    OS_CONSOLE_ARG_PTRDIFF,
+    OS_CONSOLE_ARG_DOUBLE,
+    OS_CONSOLE_ARG_POINTER,
+    OS_CONSOLE_ARG_STRING,
+    OS_CONSOLE_ARG_INVALID /**< Not supported for deferred formatting */
+} OS_console_argtype_t;
+
+/*
+ * A parsed printf conversion specification
+ */
+typedef struct
+{
+    const char *         Flags;
+    size_t               FlagsLen;
+    const char *         Width; /**< Width digits, or "*" */
+    size_t               WidthLen;
+    const char *         Precision; /**< Precision digits, or "*", not including the '.' */
+    size_t               PrecisionLen;
+    bool                 HasPrecision;
+    bool                 IsSigned;
+    char                 Length[3];
+    char                 Conversion;
+    OS_console_argtype_t ArgType;
+} OS_console_spec_t;
+
 /*
  *********************************************************************************
  *          INITIALIZATION
@@ -103,7 +145,7 @@ int32 OS_ConsoleAPI_Init(void)
         /*
          * Initialize the ring buffer pointers
          */
-        console->BufBase = OS_printf_buffer_mem;
+        console->BufBase = (char *)OS_printf_buffer_mem;
         console->BufSize = sizeof(OS_printf_buffer_mem);
         console->IsAsync = OS_CONSOLE_IS_ASYNC;
 
@@ -130,125 +172,656 @@ int32 OS_ConsoleAPI_Init(void)
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *    Write into the console ring buffer
+ *    Reserve space for a record in the console ring buffer
  *
- *    The NextWritePos is an input-output and contains the position
- *    in the ring buffer to start writing into.  This may or may not
- *    be the same as the value in the global.  It is only updated
- *    if the string is written in its entirety.
+ *    On success, RecordPos is set to the offset of the reserved
+ *    record, which the caller owns until it sets the header.
  *
  *    The intent is to avoid truncating a string if it does not fit.
- *    Either the entire string should be written, or none of it.
+ *    Either space for the entire string is reserved, or none of it.
+ *    Note the space check and the update of WritePos must be done as
+ *    a single compare-and-exchange, rather than a fetch-and-add, so
+ *    that nothing is reserved if the record does not fit.
  *
  *-----------------------------------------------------------------*/
-static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Str, size_t *NextWritePos)
+static int32 OS_Console_Reserve(OS_console_internal_record_t *console, size_t DataLen, size_t *RecordPos)
 {
-    const char *pmsg;
-    size_t      WriteOffset;
-    int32       return_code;
-
-    return_code = OS_ERROR;
-    pmsg        = Str;
-    WriteOffset = *NextWritePos;
-    while (true)
+    size_t RecordSize;
+    size_t StartPos;
+    size_t NextPos;
+    size_t PadSize;
+    size_t FreeSize;
+    size_t ReadPos;
+
+    RecordSize = OS_CONSOLE_REC_SIZE(DataLen);
+    StartPos   = atomic_load(&console->WritePos);
+    do
     {
-        if (*pmsg == 0)
+        /*
+         * One alignment unit is always left unused, so that a full
+         * buffer can be distinguished from an empty one.
+         */
+        ReadPos = atomic_load(&console->ReadPos);
+        if (ReadPos > StartPos)
         {
-            /* String is complete */
-            *NextWritePos = WriteOffset;
-            return_code   = OS_SUCCESS;
-            break;
+            FreeSize = ReadPos - StartPos - OS_CONSOLE_REC_ALIGN;
+        }
+        else
+        {
+            FreeSize = console->BufSize - StartPos + ReadPos - OS_CONSOLE_REC_ALIGN;
+        }
+
+        if (RecordSize > (console->BufSize - StartPos))
+        {
+            /* does not fit at the end, so skip to the start of the buffer */
+            PadSize = console->BufSize - StartPos;
+            NextPos = RecordSize;
         }
-        console->BufBase[WriteOffset] = *pmsg;
-        WriteOffset                   = WriteOffset + 1;
-        if (WriteOffset >= console->BufSize)
+        else
         {
-            WriteOffset = 0;
+            PadSize = 0;
+            NextPos = StartPos + RecordSize;
         }
 
-        if (WriteOffset == console->ReadPos)
+        if ((PadSize + RecordSize) > FreeSize)
         {
             /* out of space */
-            return_code = OS_QUEUE_FULL;
-            break;
+            return OS_QUEUE_FULL;
         }
 
-        ++pmsg;
+        if (NextPos >= console->BufSize)
+        {
+            NextPos = 0;
+        }
+    } while (!atomic_compare_exchange_weak(&console->WritePos, &StartPos, NextPos));
+
+    if (PadSize != 0)
+    {
+        atomic_store_explicit(OS_CONSOLE_REC_HDR(console, StartPos), OS_CONSOLE_REC_SKIP, memory_order_release);
+        StartPos = 0;
     }
 
-    return return_code;
+    *RecordPos = StartPos;
+
+    return OS_SUCCESS;
 }
 
-/*
- *********************************************************************************
- *          PUBLIC API (application-callable functions)
- *********************************************************************************
- */
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Parse a printf conversion specification, starting after the '%'
+ *
+ *    Returns a pointer to the character after the specification
+ *
+ *-----------------------------------------------------------------*/
+static const char *OS_Console_ParseSpec(const char *Format, OS_console_spec_t *Spec)
+{
+    const char *p;
+    size_t      LengthLen;
+
+    memset(Spec, 0, sizeof(*Spec));
+
+    p           = Format;
+    Spec->Flags = p;
+    while (*p != 0 && strchr("-+ #0", *p) != NULL)
+    {
+        ++p;
+    }
+    Spec->FlagsLen = p - Spec->Flags;
+
+    Spec->Width = p;
+    if (*p == '*')
+    {
+        ++p;
+    }
+    else
+    {
+        while (*p >= '0' && *p <= '9')
+        {
+            ++p;
+        }
+    }
+    Spec->WidthLen = p - Spec->Width;
+
+    if (*p == '.')
+    {
+        Spec->HasPrecision = true;
+        ++p;
+        Spec->Precision = p;
+        if (*p == '*')
+        {
+            ++p;
+        }
+        else
+        {
+            while (*p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+        }
+        Spec->PrecisionLen = p - Spec->Precision;
+    }
+
+    LengthLen = 0;
+    while (LengthLen < 2 && *p != 0 && strchr("hlzjtL", *p) != NULL)
+    {
+        Spec->Length[LengthLen] = *p;
+        ++LengthLen;
+        ++p;
+    }
+
+    Spec->Conversion = *p;
+    Spec->IsSigned   = (*p == 'd' || *p == 'i');
+    Spec->ArgType    = OS_CONSOLE_ARG_INVALID;
+
+    switch (*p)
+    {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            if (LengthLen == 0 || Spec->Length[0] == 'h')
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_INT;
+            }
+            else if (strcmp(Spec->Length, "l") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_LONG;
+            }
+            else if (strcmp(Spec->Length, "ll") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_LLONG;
+            }
+            else if (strcmp(Spec->Length, "z") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_SIZE;
+            }
+            else if (strcmp(Spec->Length, "j") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_INTMAX;
+            }
+            else if (strcmp(Spec->Length, "t") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_PTRDIFF;
+            }
+            break;
+        case 'c':
+            if (LengthLen == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_INT;
+            }
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (LengthLen == 0 || strcmp(Spec->Length, "l") == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_DOUBLE;
+            }
+            break;
+        case 's':
+            if (LengthLen == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_STRING;
+            }
+            break;
+        case 'p':
+            if (LengthLen == 0)
+            {
+                Spec->ArgType = OS_CONSOLE_ARG_POINTER;
+            }
+            break;
+        case '%':
+            Spec->ArgType = OS_CONSOLE_ARG_NONE;
+            break;
+        default:
+            /* includes %n and a '%' at the end of the string */
+            break;
+    }
+
+    if (*p != 0)
+    {
+        ++p;
+    }
+
+    if ((p - Format) >= OS_CONSOLE_DEFERRED_MAX_SPEC_LEN)
+    {
+        Spec->ArgType = OS_CONSOLE_ARG_INVALID;
+    }
+
+    return p;
+}
 
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *           Write into the console ring buffer
+ *    Record the arguments of a message for deferred formatting
+ *
+ *    Returns OS_ERR_NOT_IMPLEMENTED if the message cannot be deferred,
+ *    in which case it must be formatted immediately instead.
  *
  *-----------------------------------------------------------------*/
-int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
+static int32 OS_Console_PackDeferred(OS_console_deferred_t *Msg, const char *Format, va_list va)
+{
+    OS_console_spec_t Spec;
+    const char *      p;
+    const char *      Str;
+    size_t            StrLen;
+    size_t            MaxStrLen;
+    size_t            i;
+    uint32            NumWords;
+    int               StarValue;
+    int               Value;
+    double            DoubleValue;
+
+    Msg->Format   = Format;
+    Msg->NumWords = 0;
+    Msg->StrSize  = 0;
+
+    p = Format;
+    while (*p != 0)
+    {
+        if (*p != '%')
+        {
+            ++p;
+            continue;
+        }
+
+        p = OS_Console_ParseSpec(p + 1, &Spec);
+        if (Spec.ArgType == OS_CONSOLE_ARG_INVALID)
+        {
+            return OS_ERR_NOT_IMPLEMENTED;
+        }
+        if (Spec.ArgType == OS_CONSOLE_ARG_NONE)
+        {
+            continue;
+        }
+
+        /* Room for the value, and the width and precision if given as arguments */
+        NumWords = 1;
+        if (Spec.WidthLen == 1 && Spec.Width[0] == '*')
+        {
+            ++NumWords;
+        }
+        if (Spec.PrecisionLen == 1 && Spec.Precision[0] == '*')
+        {
+            ++NumWords;
+        }
+        if ((Msg->NumWords + NumWords) > OS_CONSOLE_DEFERRED_MAX_WORDS)
+        {
+            return OS_ERR_NOT_IMPLEMENTED;
+        }
+
+        if (Spec.WidthLen == 1 && Spec.Width[0] == '*')
+        {
+            Msg->Words[Msg->NumWords] = (uint64)(int64)va_arg(va, int);
+            ++Msg->NumWords;
+        }
+
+        /* A negative precision is the same as none */
+        StarValue = -1;
+        if (Spec.PrecisionLen == 1 && Spec.Precision[0] == '*')
+        {
+            StarValue                 = va_arg(va, int);
+            Msg->Words[Msg->NumWords] = (uint64)(int64)StarValue;
+            ++Msg->NumWords;
+        }
+        else if (Spec.HasPrecision)
+        {
+            StarValue = 0;
+            for (i = 0; i < Spec.PrecisionLen; ++i)
+            {
+                StarValue = (StarValue * 10) + (Spec.Precision[i] - '0');
+            }
+        }
+
+        switch (Spec.ArgType)
+        {
+            case OS_CONSOLE_ARG_INT:
+                /* Apply the conversion for "hh" and "h" now, values are always formatted with "ll" */
+                Value = va_arg(va, int);
+                if (strcmp(Spec.Length, "hh") == 0)
+                {
+                    Value = Spec.IsSigned ? (int)(signed char)Value : (int)(unsigned char)Value;
+                }
+                else if (strcmp(Spec.Length, "h") == 0)
+                {
+                    Value = Spec.IsSigned ? (int)(short)Value : (int)(unsigned short)Value;
+                }
+                Msg->Words[Msg->NumWords] =
+                    (Spec.IsSigned || Spec.Conversion == 'c') ? (uint64)(int64)Value : (uint64)(unsigned int)Value;
+                break;
+            case OS_CONSOLE_ARG_LONG:
+                Msg->Words[Msg->NumWords] =
+                    Spec.IsSigned ? (uint64)(int64)va_arg(va, long) : (uint64)va_arg(va, unsigned long);
+                break;
+            case OS_CONSOLE_ARG_LLONG:
+                Msg->Words[Msg->NumWords] =
+                    Spec.IsSigned ? (uint64)(int64)va_arg(va, long long) : (uint64)va_arg(va, unsigned long long);
+                break;
+            case OS_CONSOLE_ARG_SIZE:
+            case OS_CONSOLE_ARG_PTRDIFF:
+                Msg->Words[Msg->NumWords] =
+                    Spec.IsSigned ? (uint64)(int64)va_arg(va, ptrdiff_t) : (uint64)va_arg(va, size_t);
+                break;
+            case OS_CONSOLE_ARG_INTMAX:
+                Msg->Words[Msg->NumWords] =
+                    Spec.IsSigned ? (uint64)(int64)va_arg(va, intmax_t) : (uint64)va_arg(va, uintmax_t);
+                break;
+            case OS_CONSOLE_ARG_DOUBLE:
+                DoubleValue = va_arg(va, double);
+                memcpy(&Msg->Words[Msg->NumWords], &DoubleValue, sizeof(DoubleValue));
+                break;
+            case OS_CONSOLE_ARG_POINTER:
+                Msg->Words[Msg->NumWords] = (cpuaddr)va_arg(va, void *);
+                break;
+            default: /* OS_CONSOLE_ARG_STRING */
+                Str = va_arg(va, const char *);
+                if (Str == NULL || Msg->StrSize >= sizeof(Msg->Strings))
+                {
+                    /* a null string is not portable, let the C library deal with it */
+                    return OS_ERR_NOT_IMPLEMENTED;
+                }
+
+                /* Strings are copied, only up to the precision and as much as fits */
+                MaxStrLen = sizeof(Msg->Strings) - Msg->StrSize - 1;
+                if (StarValue >= 0 && (size_t)StarValue < MaxStrLen)
+                {
+                    MaxStrLen = StarValue;
+                }
+                StrLen = 0;
+                while (StrLen < MaxStrLen && Str[StrLen] != 0)
+                {
+                    ++StrLen;
+                }
+
+                memcpy(&Msg->Strings[Msg->StrSize], Str, StrLen);
+                Msg->Strings[Msg->StrSize + StrLen] = 0;
+                Msg->Words[Msg->NumWords]           = Msg->StrSize;
+                Msg->StrSize += StrLen + 1;
+                break;
+        }
+
+        ++Msg->NumWords;
+    }
+
+    /* The format string length must fit in a binary frame header */
+    if ((p - Format) > UINT16_MAX)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    OS_GetLocalTime_Impl(&Msg->Timestamp);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Write a record to the console ring buffer and notify the
+ *    implementation.  The record data is the concatenation of
+ *    the two given pieces.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Console_WriteRecord(const OS_object_token_t *token, uint32 RecordFlags, const void *Data1,
+                                    size_t Len1, const void *Data2, size_t Len2)
 {
-    int32                         return_code;
-    OS_object_token_t             token;
     OS_console_internal_record_t *console;
-    size_t                        PendingWritePos;
+    size_t                        RecordPos;
+    int32                         return_code;
+
+    console = OS_OBJECT_TABLE_GET(OS_console_table, *token);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    return_code = OS_Console_Reserve(console, Len1 + Len2, &RecordPos);
     if (return_code == OS_SUCCESS)
     {
-        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+        memcpy(OS_CONSOLE_REC_DATA(console, RecordPos), Data1, Len1);
+        memcpy(OS_CONSOLE_REC_DATA(console, RecordPos) + Len1, Data2, Len2);
 
-        /*
-         * The entire string should be put to the ring buffer,
-         * or none of it.  Therefore the WritePos in the table
-         * is not updated until complete success.
-         */
-        PendingWritePos = console->WritePos;
+        /* the entire message was successfully written, mark the record complete */
+        atomic_store_explicit(OS_CONSOLE_REC_HDR(console, RecordPos),
+                              OS_CONSOLE_REC_COMPLETE | RecordFlags | (uint32)(Len1 + Len2), memory_order_release);
+    }
+    else
+    {
+        /* the message did not fit */
+        atomic_fetch_add_explicit(&console->OverflowEvents, 1, memory_order_relaxed);
+    }
+
+    /*
+     * Notify the underlying console implementation of new data.
+     * This will forward the data to the actual console device.
+     *
+     * In synchronous mode several tasks may call the output function
+     * at once, the implementation must serialize reading the buffer.
+     */
+    if (console->IsAsync)
+    {
+        /* post the sem for the utility task to run */
+        OS_ConsoleWakeup_Impl(token);
+    }
+    else
+    {
+        /* output directly */
+        OS_ConsoleOutput_Impl(token);
+    }
 
-        if (console->device_name[0] != 0)
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Write a message recorded for deferred formatting into
+ *    the console ring buffer
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_ConsoleWriteDeferred(osal_id_t console_id, const OS_console_deferred_t *Msg)
+{
+    int32             return_code;
+    OS_object_token_t token;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_Console_WriteRecord(&token, OS_CONSOLE_REC_DEFERRED, Msg,
+                                             offsetof(OS_console_deferred_t, Words) + (Msg->NumWords * sizeof(uint64)),
+                                             Msg->Strings, Msg->StrSize);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t OS_Console_FormatDeferred(const OS_console_internal_record_t *console, const char *RecordData,
+                                 char *Buffer, size_t BufferSize)
+{
+    OS_console_deferred_t Msg;
+    OS_console_spec_t     Spec;
+    const char *          p;
+    char                  SubFormat[OS_CONSOLE_DEFERRED_MAX_SPEC_LEN + 32];
+    size_t                SubLen;
+    size_t                Pos;
+    uint32                WordIdx;
+    int                   Result;
+    double                DoubleValue;
+
+    /* The record may not be aligned in the ring buffer, so copy it out */
+    memcpy(&Msg, RecordData, offsetof(OS_console_deferred_t, Words));
+    if (Msg.NumWords > OS_CONSOLE_DEFERRED_MAX_WORDS || Msg.StrSize > sizeof(Msg.Strings))
+    {
+        Buffer[0] = 0;
+        return 0;
+    }
+    RecordData += offsetof(OS_console_deferred_t, Words);
+    memcpy(Msg.Words, RecordData, Msg.NumWords * sizeof(uint64));
+    memcpy(Msg.Strings, RecordData + (Msg.NumWords * sizeof(uint64)), Msg.StrSize);
+
+    Pos = strlen(console->device_name);
+    if (Pos >= BufferSize)
+    {
+        Pos = BufferSize - 1;
+    }
+    memcpy(Buffer, console->device_name, Pos);
+
+    WordIdx = 0;
+    p       = Msg.Format;
+    while (*p != 0 && Pos < (BufferSize - 1))
+    {
+        if (*p != '%')
         {
-            return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
+            Buffer[Pos] = *p;
+            ++Pos;
+            ++p;
+            continue;
         }
-        if (return_code == OS_SUCCESS)
+
+        p = OS_Console_ParseSpec(p + 1, &Spec);
+        if (Spec.ArgType == OS_CONSOLE_ARG_NONE)
         {
-            return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
+            Buffer[Pos] = '%';
+            ++Pos;
+            continue;
         }
 
-        if (return_code == OS_SUCCESS)
+        /* Rebuild the specification with any '*' values filled in, formatting one argument at a time */
+        SubFormat[0] = '%';
+        SubLen       = 1;
+        memcpy(&SubFormat[SubLen], Spec.Flags, Spec.FlagsLen);
+        SubLen += Spec.FlagsLen;
+        if (Spec.WidthLen == 1 && Spec.Width[0] == '*' && WordIdx < Msg.NumWords)
         {
-            /* the entire message was successfully written */
-            console->WritePos = PendingWritePos;
+            SubLen += snprintf(&SubFormat[SubLen], sizeof(SubFormat) - SubLen, "%d", (int)(int64)Msg.Words[WordIdx]);
+            ++WordIdx;
         }
         else
         {
-            /* the message did not fit */
-            ++console->OverflowEvents;
+            memcpy(&SubFormat[SubLen], Spec.Width, Spec.WidthLen);
+            SubLen += Spec.WidthLen;
+        }
+        if (Spec.PrecisionLen == 1 && Spec.Precision[0] == '*' && WordIdx < Msg.NumWords)
+        {
+            if ((int64)Msg.Words[WordIdx] >= 0)
+            {
+                SubLen += snprintf(&SubFormat[SubLen], sizeof(SubFormat) - SubLen, ".%d",
+                                   (int)(int64)Msg.Words[WordIdx]);
+            }
+            ++WordIdx;
+        }
+        else if (Spec.HasPrecision)
+        {
+            SubFormat[SubLen] = '.';
+            memcpy(&SubFormat[SubLen + 1], Spec.Precision, Spec.PrecisionLen);
+            SubLen += 1 + Spec.PrecisionLen;
+        }
+        if (Spec.ArgType != OS_CONSOLE_ARG_INT || Spec.Conversion != 'c')
+        {
+            if (Spec.ArgType <= OS_CONSOLE_ARG_PTRDIFF)
+            {
+                /* all integers are recorded as 64 bits */
+                memcpy(&SubFormat[SubLen], "ll", 2);
+                SubLen += 2;
+            }
         }
+        SubFormat[SubLen]     = Spec.Conversion;
+        SubFormat[SubLen + 1] = 0;
 
-        /*
-         * Notify the underlying console implementation of new data.
-         * This will forward the data to the actual console device.
-         *
-         * This is done while still locked, so it can support
-         * either a synchronous or asynchronous implementation.
-         */
-        if (console->IsAsync)
+        if (WordIdx >= Msg.NumWords)
         {
-            /* post the sem for the utility task to run */
-            OS_ConsoleWakeup_Impl(&token);
+            /* not expected, as the format string was used to record the arguments */
+            break;
         }
-        else
+
+        switch (Spec.ArgType)
         {
-            /* output directly */
-            OS_ConsoleOutput_Impl(&token);
+            case OS_CONSOLE_ARG_DOUBLE:
+                memcpy(&DoubleValue, &Msg.Words[WordIdx], sizeof(DoubleValue));
+                Result = snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat, DoubleValue);
+                break;
+            case OS_CONSOLE_ARG_POINTER:
+                Result = snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat, (void *)(cpuaddr)Msg.Words[WordIdx]);
+                break;
+            case OS_CONSOLE_ARG_STRING:
+                Result = snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat,
+                                  &Msg.Strings[Msg.Words[WordIdx] % sizeof(Msg.Strings)]);
+                break;
+            default:
+                if (Spec.Conversion == 'c')
+                {
+                    Result = snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat, (int)(int64)Msg.Words[WordIdx]);
+                }
+                else if (Spec.IsSigned)
+                {
+                    Result = snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat, (long long)(int64)Msg.Words[WordIdx]);
+                }
+                else
+                {
+                    Result =
+                        snprintf(&Buffer[Pos], BufferSize - Pos, SubFormat, (unsigned long long)Msg.Words[WordIdx]);
+                }
+                break;
         }
+        ++WordIdx;
+
+        if (Result > 0)
+        {
+            Pos += Result;
+        }
+    }
+
+    if (Pos >= BufferSize)
+    {
+        /* truncated */
+        Pos = BufferSize - 1;
+    }
+    Buffer[Pos] = 0;
+
+    return Pos;
+}
+
+/*
+ *********************************************************************************
+ *          PUBLIC API (application-callable functions)
+ *********************************************************************************
+ */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Write into the console ring buffer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_console_internal_record_t *console;
 
-        OS_ObjectIdRelease(&token);
+    /*
+     * The console table is not locked here, so that tasks writing messages
+     * do not serialize on it.  Concurrent writers are handled by the ring
+     * buffer itself, and the console object is never deleted.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
+
+        return_code =
+            OS_Console_WriteRecord(&token, 0, console->device_name, strlen(console->device_name), Str, strlen(Str));
     }
 
     return return_code;
@@ -262,9 +835,12 @@ int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
  *-----------------------------------------------------------------*/
 void OS_printf(const char *String, ...)
 {
-    va_list va;
-    char    msg_buffer[OS_BUFFER_SIZE];
-    int     actualsz;
+    va_list               va;
+    va_list               va_deferred;
+    OS_console_deferred_t deferred_msg;
+    char                  msg_buffer[OS_BUFFER_SIZE];
+    int                   actualsz;
+    int32                 return_code;
 
     BUGCHECK_VOID(String != NULL)
 
@@ -291,25 +867,43 @@ void OS_printf(const char *String, ...)
     }
     else if (OS_SharedGlobalVars.PrintfEnabled)
     {
-        /* Format and determine the size of string to write */
         va_start(va, String);
-        actualsz = vsnprintf(msg_buffer, sizeof(msg_buffer), String, va);
-        va_end(va);
 
-        if (actualsz < 0)
+        return_code = OS_ERR_NOT_IMPLEMENTED;
+        if (OS_SharedGlobalVars.PrintfMode != OS_PRINTF_MODE_IMMEDIATE)
         {
-            /* unlikely: vsnprintf failed */
-            actualsz = 0;
+            /* Only record the arguments, unless the format uses something that cannot be deferred */
+            va_copy(va_deferred, va);
+            return_code = OS_Console_PackDeferred(&deferred_msg, String, va_deferred);
+            va_end(va_deferred);
         }
-        else if (actualsz >= OS_BUFFER_SIZE)
+
+        if (return_code == OS_SUCCESS)
         {
-            /* truncate */
-            actualsz = OS_BUFFER_SIZE - 1;
+            OS_ConsoleWriteDeferred(OS_SharedGlobalVars.PrintfConsoleId, &deferred_msg);
+        }
+        else
+        {
+            /* Format and determine the size of string to write */
+            actualsz = vsnprintf(msg_buffer, sizeof(msg_buffer), String, va);
+
+            if (actualsz < 0)
+            {
+                /* unlikely: vsnprintf failed */
+                actualsz = 0;
+            }
+            else if (actualsz >= OS_BUFFER_SIZE)
+            {
+                /* truncate */
+                actualsz = OS_BUFFER_SIZE - 1;
+            }
+
+            msg_buffer[actualsz] = 0;
+
+            OS_ConsoleWrite(OS_SharedGlobalVars.PrintfConsoleId, msg_buffer);
         }
 
-        msg_buffer[actualsz] = 0;
-
-        OS_ConsoleWrite(OS_SharedGlobalVars.PrintfConsoleId, msg_buffer);
+        va_end(va);
     }
 }
 
@@ -334,3 +928,18 @@ void OS_printf_enable(void)
 {
     OS_SharedGlobalVars.PrintfEnabled = true;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_printf_SetMode(uint32 mode)
+{
+    ARGCHECK(mode <= OS_PRINTF_MODE_BINARY, OS_ERR_INVALID_ARGUMENT);
+
+    OS_SharedGlobalVars.PrintfMode = mode;
+
+    return OS_SUCCESS;
+}
@@ -57,6 +57,29 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_QUEUE
 };
 
+/*
+ * States of a temporary buffer used by the zero-copy API on queues that
+ * do not provide direct access to their storage.
+ */
+enum
+{
+    OS_QUEUE_COPYBUF_RESERVED = 1,
+    OS_QUEUE_COPYBUF_BORROWED = 2
+};
+
+/*
+ * Header of a temporary buffer used by the zero-copy API.  While owned by a
+ * caller the buffer is on the list of the queue it was obtained from, so
+ * a buffer passed back to the queue is only used if it is found on that list.
+ */
+typedef struct OS_queue_copybuf
+{
+    struct OS_queue_copybuf *next;  /* next buffer on the list of the queue */
+    uint32                   state; /* one of the OS_QUEUE_COPYBUF values */
+    size_t                   size;  /* size of the message in the buffer, if borrowed */
+    uint64                   data[]; /* message data, aligned for any basic type */
+} OS_queue_copybuf_t;
+
 OS_queue_internal_record_t OS_queue_table[LOCAL_NUM_OBJECTS];
 
 /****************************************************************************************
@@ -124,14 +147,46 @@ int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcoun
  *-----------------------------------------------------------------*/
 int32 OS_QueueDelete(osal_id_t queue_id)
 {
-    OS_object_token_t token;
-    int32             return_code;
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_copybuf_t *        copybuf;
+
+    /*
+     * Tasks blocked getting a message hold a reference to the queue, so make
+     * them give up first.  Otherwise the exclusive lock, which waits for all
+     * references to be released, could not be taken.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        OS_QueueSetDeleting_Impl(&token, true);
+        OS_ObjectIdRelease(&token);
+
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, queue_id, &token);
+        if (return_code == OS_ERR_OBJECT_IN_USE &&
+            OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token) == OS_SUCCESS)
+        {
+            /* The queue is not going away after all */
+            OS_QueueSetDeleting_Impl(&token, false);
+            OS_ObjectIdRelease(&token);
+        }
+    }
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
         return_code = OS_QueueDelete_Impl(&token);
 
+        /* Release any temporary buffers that were not passed back */
+        while (return_code == OS_SUCCESS && queue->copybufs != NULL)
+        {
+            copybuf         = queue->copybufs;
+            queue->copybufs = copybuf->next;
+            free(copybuf);
+        }
+
         /* Complete the operation via the common routine */
         return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
     }
@@ -156,7 +211,7 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
     OS_CHECK_POINTER(size_copied);
     OS_CHECK_SIZE(size);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
@@ -173,6 +228,8 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
         {
             return_code = OS_QueueGet_Impl(&token, data, size, size_copied, timeout);
         }
+
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -194,7 +251,7 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
     OS_CHECK_POINTER(data);
     OS_CHECK_SIZE(size);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
@@ -210,6 +267,443 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
         {
             return_code = OS_QueuePut_Impl(&token, data, size, flags);
         }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *data, size_t stride, const size_t *sizes, uint32 count,
+                       uint32 *count_put, uint32 flags)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint32                      i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(sizes);
+    OS_CHECK_POINTER(count_put);
+    OS_CHECK_SIZE(stride);
+    OS_CHECK_SIZE(count);
+
+    *count_put = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        /* Check all messages before putting any, so a bad one cannot leave a partial batch */
+        for (i = 0; i < count; ++i)
+        {
+            if (sizes[i] == 0 || sizes[i] > queue->max_size || sizes[i] > stride)
+            {
+                return_code = OS_QUEUE_INVALID_SIZE;
+                break;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_QueuePutMulti_Impl(&token, data, stride, sizes, count, count_put, flags);
+        }
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /* no batch operation, so put the messages one at a time */
+            return_code = OS_SUCCESS;
+            for (i = 0; return_code == OS_SUCCESS && i < count; ++i)
+            {
+                return_code = OS_QueuePut_Impl(&token, (const uint8 *)data + (i * stride), sizes[i], flags);
+                if (return_code == OS_SUCCESS)
+                {
+                    ++(*count_put);
+                }
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t stride, size_t *sizes, uint32 count,
+                       uint32 *count_copied, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint32                      i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(sizes);
+    OS_CHECK_POINTER(count_copied);
+    OS_CHECK_SIZE(stride);
+    OS_CHECK_SIZE(count);
+
+    *count_copied = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (stride < queue->max_size)
+        {
+            /*
+            ** The buffer that the user is passing in is potentially too small
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueGetMulti_Impl(&token, data, stride, sizes, count, count_copied, timeout);
+        }
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /*
+             * No batch operation, so get the messages one at a time.  Only the first
+             * get may block, the rest only take messages that are already pending.
+             */
+            return_code = OS_QueueGet_Impl(&token, data, stride, &sizes[0], timeout);
+            for (i = 1; return_code == OS_SUCCESS && i < count; ++i)
+            {
+                if (OS_QueueGet_Impl(&token, (uint8 *)data + (i * stride), stride, &sizes[i], OS_CHECK) != OS_SUCCESS)
+                {
+                    break;
+                }
+            }
+
+            if (return_code == OS_SUCCESS)
+            {
+                *count_copied = i;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds a temporary buffer of the zero-copy API to the list
+ *           of the queue.  The caller holds a reference to the queue,
+ *           so this cannot fail.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_QueueCopyBufAdd(OS_object_token_t *token, OS_queue_copybuf_t *copybuf)
+{
+    OS_queue_internal_record_t *queue;
+
+    queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
+
+    OS_Lock_Global(token);
+
+    copybuf->next   = queue->copybufs;
+    queue->copybufs = copybuf;
+
+    OS_Unlock_Global(token);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes a temporary buffer passed back to the zero-copy API
+ *           from the list of the queue.  The buffer is only accessed if
+ *           it is found on the list, so any pointer can be checked.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueCopyBufRemove(OS_object_token_t *token, const void *data, uint32 state,
+                                   OS_queue_copybuf_t **copybuf)
+{
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_copybuf_t **       link;
+
+    queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
+
+    OS_Lock_Global(token);
+
+    link = &queue->copybufs;
+    while (*link != NULL && (const void *)(*link)->data != data)
+    {
+        link = &(*link)->next;
+    }
+
+    if (*link == NULL)
+    {
+        return_code = OS_ERR_INVALID_ARGUMENT;
+    }
+    else if ((*link)->state != state)
+    {
+        return_code = OS_ERR_INCORRECT_OBJ_STATE;
+    }
+    else
+    {
+        *copybuf    = *link;
+        *link       = (*copybuf)->next;
+        return_code = OS_SUCCESS;
+    }
+
+    OS_Unlock_Global(token);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve(osal_id_t queue_id, void **data)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_copybuf_t *        copybuf;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        return_code = OS_QueueReserve_Impl(&token, data);
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /*
+             * The queue storage cannot be accessed directly, so provide a temporary
+             * buffer instead, which is copied into the queue when it is committed.
+             */
+            copybuf = malloc(sizeof(*copybuf) + queue->max_size);
+            if (copybuf == NULL)
+            {
+                return_code = OS_ERROR;
+            }
+            else
+            {
+                copybuf->state = OS_QUEUE_COPYBUF_RESERVED;
+                copybuf->size  = 0;
+
+                OS_QueueCopyBufAdd(&token, copybuf);
+                *data       = copybuf->data;
+                return_code = OS_SUCCESS;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit(osal_id_t queue_id, void *data, size_t size)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_copybuf_t *        copybuf;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_SIZE(size);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size > queue->max_size)
+        {
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueCommit_Impl(&token, data, size);
+        }
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            return_code = OS_QueueCopyBufRemove(&token, data, OS_QUEUE_COPYBUF_RESERVED, &copybuf);
+            if (return_code == OS_SUCCESS)
+            {
+                return_code = OS_QueuePut_Impl(&token, copybuf->data, size, 0);
+                free(copybuf);
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCancel(osal_id_t queue_id, void *data)
+{
+    OS_object_token_t   token;
+    int32               return_code;
+    OS_queue_copybuf_t *copybuf;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueCancel_Impl(&token, data);
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            return_code = OS_QueueCopyBufRemove(&token, data, OS_QUEUE_COPYBUF_RESERVED, &copybuf);
+            if (return_code == OS_SUCCESS)
+            {
+                free(copybuf);
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **data, size_t *size, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    OS_queue_copybuf_t *        copybuf;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(size);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        return_code = OS_QueueBorrow_Impl(&token, data, size, timeout);
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            /*
+             * The queue storage cannot be accessed directly, so get
+             * the message into a temporary buffer instead.
+             */
+            copybuf = malloc(sizeof(*copybuf) + queue->max_size);
+            if (copybuf == NULL)
+            {
+                return_code = OS_ERROR;
+            }
+            else
+            {
+                /*
+                 * The buffer is listed before the message is taken from the queue,
+                 * so nothing can fail once the message is out of the queue.
+                 */
+                copybuf->state = OS_QUEUE_COPYBUF_BORROWED;
+                OS_QueueCopyBufAdd(&token, copybuf);
+
+                return_code = OS_QueueGet_Impl(&token, copybuf->data, queue->max_size, &copybuf->size, timeout);
+                if (return_code == OS_SUCCESS)
+                {
+                    *data = copybuf->data;
+                    *size = copybuf->size;
+                }
+                else if (OS_QueueCopyBufRemove(&token, copybuf->data, OS_QUEUE_COPYBUF_BORROWED, &copybuf) ==
+                         OS_SUCCESS)
+                {
+                    free(copybuf);
+                }
+            }
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            *data = NULL;
+            *size = 0;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReturn(osal_id_t queue_id, const void *data)
+{
+    OS_object_token_t   token;
+    int32               return_code;
+    OS_queue_copybuf_t *copybuf;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueReturn_Impl(&token, data);
+
+        if (return_code == OS_ERR_NOT_IMPLEMENTED)
+        {
+            return_code = OS_QueueCopyBufRemove(&token, data, OS_QUEUE_COPYBUF_BORROWED, &copybuf);
+            if (return_code == OS_SUCCESS)
+            {
+                free(copybuf);
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -292,11 +292,12 @@ int32 OS_TimerCreate(osal_id_t *timer_id, const char *timer_name, uint32 *clock_
  *-----------------------------------------------------------------*/
 int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
 {
-    OS_timecb_internal_record_t *timecb;
-    int32                        return_code;
-    osal_objtype_t               objtype;
-    osal_id_t                    dedicated_timebase_id;
-    OS_object_token_t            token;
+    OS_timecb_internal_record_t *  timecb;
+    OS_timebase_internal_record_t *timebase;
+    int32                          return_code;
+    osal_objtype_t                 objtype;
+    osal_id_t                      dedicated_timebase_id;
+    OS_object_token_t              token;
 
     dedicated_timebase_id = OS_OBJECT_ID_UNDEFINED;
 
@@ -326,8 +327,10 @@ int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
             dedicated_timebase_id = OS_ObjectIdFromToken(&timecb->timebase_token);
         }
 
-        timecb->wait_time     = (int32)start_time;
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timecb->timebase_token);
+
         timecb->interval_time = (int32)interval_time;
+        OS_TimeBaseQueueSet(timebase, OS_ObjectIndexFromToken(&token), timebase->freerun_time + start_time);
 
         OS_TimeBaseUnlock_Impl(&timecb->timebase_token);
 
@@ -404,8 +407,10 @@ int32 OS_TimerDelete(osal_id_t timer_id)
         }
 
         /*
-         * Now we need to remove it from the time base callback ring
+         * Now we need to remove it from the time base expiry queue and callback ring
          */
+        OS_TimeBaseQueueRemove(timebase, OS_ObjectIndexFromToken(&timecb_token));
+
         if (OS_ObjectIdEqual(timebase->first_cb, OS_ObjectIdFromToken(&timecb_token)))
         {
             if (OS_ObjectIdEqual(OS_ObjectIdFromToken(&timecb_token), timecb->next_cb))
@@ -533,3 +538,54 @@ int32 OS_TimerGetInfo(osal_id_t timer_id, OS_timer_prop_t *timer_prop)
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimerGetStats(osal_id_t timer_id, OS_timer_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_TIMER_STATS
+    int32                        return_code;
+    osal_objtype_t               objtype;
+    OS_object_token_t            token;
+    OS_timecb_internal_record_t *timecb;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    /*
+     * Check our context.  Not allowed to use the timer API from a timer callback.
+     * Just interested in the object type returned.
+     */
+    objtype = OS_ObjectIdToType_Impl(OS_TaskGetId_Impl());
+    if (objtype == OS_OBJECT_TYPE_OS_TIMEBASE)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_TIMECB, timer_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        timecb = OS_OBJECT_TABLE_GET(OS_timecb_table, token);
+
+        /* Take the time base lock so the statistics are not updated while being copied */
+        OS_TimeBaseLock_Impl(&timecb->timebase_token);
+        OS_TimeBaseStatsGet(&timecb->stats, stats);
+        OS_TimeBaseUnlock_Impl(&timecb->timebase_token);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+#else
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
@@ -45,6 +45,7 @@
 #include "os-shared-idmap.h"
 #include "os-shared-task.h"
 #include "os-shared-time.h"
+#include "os-shared-clock.h"
 
 /*
  * Sanity checks on the user-supplied configuration
@@ -196,6 +197,11 @@ int32 OS_TimeBaseSet(osal_id_t timebase_id, uint32 start_time, uint32 interval_t
             /* Save the value since we were successful */
             timebase->nominal_start_time    = start_time;
             timebase->nominal_interval_time = interval_time;
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+            /* the time since the previous tick (if any) is not relevant to the new setting */
+            timebase->last_tick_valid = false;
+#endif
         }
 
         OS_TimeBaseUnlock_Impl(&token);
@@ -345,6 +351,272 @@ int32 OS_TimeBaseGetFreeRun(osal_id_t timebase_id, uint32 *freerun_val)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBaseGetStats(osal_id_t timebase_id, OS_timer_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_TIMER_STATS
+    int32                          return_code;
+    osal_objtype_t                 objtype;
+    OS_object_token_t              token;
+    OS_timebase_internal_record_t *timebase;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    /*
+     * Check our context.  Not allowed to use the timer API from a timer callback.
+     * Just interested in the object type returned.
+     */
+    objtype = OS_ObjectIdToType_Impl(OS_TaskGetId_Impl());
+    if (objtype == OS_OBJECT_TYPE_OS_TIMEBASE)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, timebase_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
+
+        /* Take the time base lock so the statistics are not updated while being copied */
+        OS_TimeBaseLock_Impl(&token);
+        OS_TimeBaseStatsGet(&timebase->stats, stats);
+        OS_TimeBaseUnlock_Impl(&token);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+#else
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Stores a timer callback index at the given (1-based) expiry queue position
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_TimeBaseQueuePlace(OS_timebase_internal_record_t *timebase, uint32 pos, osal_index_t cb_idx)
+{
+    timebase->expiry_queue[pos - 1]   = cb_idx;
+    OS_timecb_table[cb_idx].queue_pos = pos;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if the first timer callback expires before the second
+ *
+ *  Note: The expire times are free running counters which may wrap, so
+ *        this uses the signed difference rather than a direct comparison.
+ *
+ *-----------------------------------------------------------------*/
+static inline bool OS_TimeBaseQueueBefore(osal_index_t cb_idx1, osal_index_t cb_idx2)
+{
+    return ((int32)(OS_timecb_table[cb_idx1].expire_time - OS_timecb_table[cb_idx2].expire_time) < 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Moves the entry at the given expiry queue position up or down
+ *           as needed to restore the heap ordering.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseQueueSift(OS_timebase_internal_record_t *timebase, uint32 pos)
+{
+    osal_index_t cb_idx;
+    uint32       next_pos;
+
+    cb_idx = timebase->expiry_queue[pos - 1];
+
+    /* Move toward the root while the entry expires before its parent */
+    while (pos > 1)
+    {
+        next_pos = pos / 2;
+        if (!OS_TimeBaseQueueBefore(cb_idx, timebase->expiry_queue[next_pos - 1]))
+        {
+            break;
+        }
+        OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[next_pos - 1]);
+        pos = next_pos;
+    }
+
+    /* Move toward the leaves while a child expires before the entry */
+    while ((pos * 2) <= timebase->expiry_count)
+    {
+        next_pos = pos * 2;
+        if (next_pos < timebase->expiry_count &&
+            OS_TimeBaseQueueBefore(timebase->expiry_queue[next_pos], timebase->expiry_queue[next_pos - 1]))
+        {
+            ++next_pos;
+        }
+        if (!OS_TimeBaseQueueBefore(timebase->expiry_queue[next_pos - 1], cb_idx))
+        {
+            break;
+        }
+        OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[next_pos - 1]);
+        pos = next_pos;
+    }
+
+    OS_TimeBaseQueuePlace(timebase, pos, cb_idx);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in os-shared-timebase.h
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseQueueSet(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx, uint32 expire_time)
+{
+    OS_timecb_internal_record_t *timecb;
+
+    timecb              = &OS_timecb_table[cb_idx];
+    timecb->expire_time = expire_time;
+
+    if (timecb->queue_pos == 0)
+    {
+        ++timebase->expiry_count;
+        OS_TimeBaseQueuePlace(timebase, timebase->expiry_count, cb_idx);
+    }
+
+    OS_TimeBaseQueueSift(timebase, timecb->queue_pos);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in os-shared-timebase.h
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseQueueRemove(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx)
+{
+    OS_timecb_internal_record_t *timecb;
+    uint32                       pos;
+
+    timecb = &OS_timecb_table[cb_idx];
+    pos    = timecb->queue_pos;
+
+    if (pos != 0)
+    {
+        timecb->queue_pos = 0;
+        --timebase->expiry_count;
+
+        /* Fill the vacated position with the last entry, if it was not the last entry itself */
+        if (pos <= timebase->expiry_count)
+        {
+            OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[timebase->expiry_count]);
+            OS_TimeBaseQueueSift(timebase, pos);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the log2 histogram bin for a value
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBaseStatsBin(uint32 value)
+{
+    uint32 bin;
+
+    bin = 0;
+    while (value != 0 && bin < (OS_TIMER_STATS_HISTOGRAM_BINS - 1))
+    {
+        value >>= 1;
+        ++bin;
+    }
+
+    return bin;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in os-shared-timebase.h
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseStatsRecord(OS_timer_stats_record_t *record, uint32 latency, uint32 exec_time, bool overrun)
+{
+    if (record->stats.event_count == 0 || latency < record->stats.latency_min)
+    {
+        record->stats.latency_min = latency;
+    }
+    if (latency > record->stats.latency_max)
+    {
+        record->stats.latency_max = latency;
+    }
+    if (exec_time > record->stats.exec_time_max)
+    {
+        record->stats.exec_time_max = exec_time;
+    }
+    if (overrun)
+    {
+        ++record->stats.overrun_count;
+    }
+
+    ++record->stats.event_count;
+    record->latency_sum += latency;
+
+    ++record->stats.latency_histogram[OS_TimeBaseStatsBin(latency)];
+    ++record->stats.exec_time_histogram[OS_TimeBaseStatsBin(exec_time)];
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in os-shared-timebase.h
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseStatsGet(const OS_timer_stats_record_t *record, OS_timer_stats_t *stats)
+{
+    *stats = record->stats;
+
+    if (record->stats.event_count != 0)
+    {
+        stats->latency_mean = (uint32)(record->latency_sum / record->stats.event_count);
+    }
+}
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the elapsed time between two monotonic clock samples in microseconds
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBaseStatsElapsed(OS_time_t end_time, OS_time_t start_time)
+{
+    int64 usec;
+
+    usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    if (usec < 0)
+    {
+        usec = 0;
+    }
+    else if (usec > UINT32_MAX)
+    {
+        usec = UINT32_MAX;
+    }
+
+    return (uint32)usec;
+}
+#endif
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -369,10 +641,18 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
     OS_timecb_internal_record_t *  timecb;
     OS_common_record_t *           record;
     OS_object_token_t              token;
-    OS_object_token_t              cb_token;
+    osal_index_t                   cb_idx;
     uint32                         tick_time;
     uint32                         spin_cycles;
+    int32                          wait_time;
     int32                          saved_wait_time;
+#ifdef OSAL_CONFIG_TIMER_STATS
+    OS_time_t wake_time;
+    OS_time_t cb_start_time;
+    OS_time_t cb_end_time;
+    uint32    late_time;
+    uint32    elapsed;
+#endif
 
     /*
      * Register this task as a time base handler.
@@ -405,6 +685,10 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
          */
         tick_time = (*syncfunc)(timebase_id);
 
+#ifdef OSAL_CONFIG_TIMER_STATS
+        OS_GetMonotonicTime_Impl(&wake_time);
+#endif
+
         /*
          * The returned tick_time should be nonzero.  If the sync function
          * returns zero, then it means something went wrong and it is not
@@ -458,52 +742,106 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
         }
 
         timebase->freerun_time += tick_time;
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &cb_token) == 0)
+
+        /*
+         * The expiry queue is ordered by expire_time, so only the timers which are
+         * actually due on this tick need to be visited.  Each one is either re-armed
+         * for its next interval or (for one-shot timers) removed from the queue.
+         */
+        while (timebase->expiry_count > 0)
         {
-            do
+            cb_idx    = timebase->expiry_queue[0];
+            timecb    = &OS_timecb_table[cb_idx];
+            wait_time = (int32)(timecb->expire_time - timebase->freerun_time);
+            if (wait_time > 0)
+            {
+                break;
+            }
+
+            saved_wait_time = wait_time + (int32)tick_time;
+            while (wait_time <= 0)
             {
-                timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, cb_token);
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                while (timecb->wait_time <= 0)
+#ifdef OSAL_CONFIG_TIMER_STATS
+                /* the amount of time this expiry was already past due when the tick occurred */
+                late_time = (uint32)(-wait_time);
+#endif
+                wait_time += timecb->interval_time;
+
+                /*
+                 * Only allow the "wait_time" underflow to go as far negative as one interval time
+                 * This prevents a cb "interval_time" of less than the timebase interval_time from
+                 * accumulating infinitely
+                 */
+                if (wait_time < -timecb->interval_time)
                 {
-                    timecb->wait_time += timecb->interval_time;
-
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
-
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(OS_ObjectIdFromToken(&cb_token), timecb->callback_arg);
-                    }
-
-                    /*
-                     * Do not repeat the loop unless interval_time is configured.
-                     */
-                    if (timecb->interval_time <= 0)
-                    {
-                        break;
-                    }
+                    ++timecb->backlog_resets;
+                    wait_time = -timecb->interval_time;
                 }
 
-            } while (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->next_cb, &cb_token) ==
-                         OS_SUCCESS &&
-                     !OS_ObjectIdEqual(OS_ObjectIdFromToken(&cb_token), timebase->first_cb));
+                /*
+                 * Only give the callback if the wait_time actually transitioned from positive to negative.
+                 * This allows one-shot operation where the API sets the "wait_time" positive but keeps
+                 * the "interval_time" at zero.  With the interval_time at zero the wait time will never
+                 * go positive again unless the API sets it again.
+                 */
+                if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
+                {
+#ifdef OSAL_CONFIG_TIMER_STATS
+                    OS_GetMonotonicTime_Impl(&cb_start_time);
+#endif
+
+                    (*timecb->callback_ptr)(OS_global_timecb_table[cb_idx].active_id, timecb->callback_arg);
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+                    OS_GetMonotonicTime_Impl(&cb_end_time);
+                    OS_TimeBaseStatsRecord(&timecb->stats, late_time + OS_TimeBaseStatsElapsed(cb_start_time, wake_time),
+                                           OS_TimeBaseStatsElapsed(cb_end_time, cb_start_time),
+                                           (timecb->interval_time > 0 && late_time >= (uint32)timecb->interval_time));
+#endif
+                }
+
+                /*
+                 * Do not repeat the loop unless interval_time is configured.
+                 */
+                if (timecb->interval_time <= 0)
+                {
+                    break;
+                }
+            }
+
+            if (timecb->interval_time > 0)
+            {
+                OS_TimeBaseQueueSet(timebase, cb_idx, timebase->freerun_time + (uint32)wait_time);
+            }
+            else
+            {
+                OS_TimeBaseQueueRemove(timebase, cb_idx);
+            }
+        }
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+        /*
+         * The tick latency is measured against the previous tick, as the sync function
+         * only reports the time elapsed since then.  A gap of two or more intervals
+         * between ticks means that at least one tick was late enough to be an overrun.
+         */
+        if (tick_time != 0)
+        {
+            if (timebase->last_tick_valid)
+            {
+                OS_GetMonotonicTime_Impl(&cb_end_time);
+                elapsed = OS_TimeBaseStatsElapsed(wake_time, timebase->last_tick_time);
+
+                OS_TimeBaseStatsRecord(&timebase->stats, (elapsed > tick_time) ? (elapsed - tick_time) : 0,
+                                       OS_TimeBaseStatsElapsed(cb_end_time, wake_time),
+                                       (timebase->nominal_interval_time > 0 &&
+                                        elapsed >= (2 * timebase->nominal_interval_time)));
+            }
+
+            timebase->last_tick_time  = wake_time;
+            timebase->last_tick_valid = true;
         }
+#endif
 
         OS_TimeBaseUnlock_Impl(&token);
     }
@@ -29,6 +29,7 @@
 #include "osconfig.h"
 #include "common_types.h"
 #include <unistd.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <sys/types.h>
 
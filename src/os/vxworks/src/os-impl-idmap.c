@@ -58,6 +58,8 @@ VX_MUTEX_SEMAPHORE(OS_module_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_filesys_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_console_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_condvar_table_mut_mem);
+VX_MUTEX_SEMAPHORE(OS_poller_table_mut_mem);
+VX_MUTEX_SEMAPHORE(OS_mempool_table_mut_mem);
 
 static OS_impl_objtype_lock_t OS_task_table_lock      = {.mem = OS_task_table_mut_mem};
 static OS_impl_objtype_lock_t OS_queue_table_lock     = {.mem = OS_queue_table_mut_mem};
@@ -72,6 +74,8 @@ static OS_impl_objtype_lock_t OS_module_table_lock    = {.mem = OS_module_table_
 static OS_impl_objtype_lock_t OS_filesys_table_lock   = {.mem = OS_filesys_table_mut_mem};
 static OS_impl_objtype_lock_t OS_console_table_lock   = {.mem = OS_console_table_mut_mem};
 static OS_impl_objtype_lock_t OS_condvar_table_lock   = {.mem = OS_condvar_table_mut_mem};
+static OS_impl_objtype_lock_t OS_poller_table_lock    = {.mem = OS_poller_table_mut_mem};
+static OS_impl_objtype_lock_t OS_mempool_table_lock   = {.mem = OS_mempool_table_mut_mem};
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -87,7 +91,9 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_MODULE]   = &OS_module_table_lock,
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
     [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_table_lock,
-    [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_table_lock};
+    [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_table_lock,
+    [OS_OBJECT_TYPE_OS_POLLER]   = &OS_poller_table_lock,
+    [OS_OBJECT_TYPE_OS_MEMPOOL]  = &OS_mempool_table_lock};
 
 /*----------------------------------------------------------------
  *
@@ -137,7 +143,7 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq, uint32 attempts)
 {
     int wait_ticks;
 
@@ -155,6 +161,17 @@ void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
     OS_Lock_Global_Impl(objtype);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word)
+{
+    /* Nothing to do, waiting tasks poll for the change */
+}
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
 ****************************************************************************************/
@@ -109,6 +109,17 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_QueueSetDeleting_Impl(const OS_object_token_t *token, bool deleting)
+{
+    /* A task blocked in msgQReceive() cannot be woken without deleting the queue */
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -316,15 +316,16 @@ void TestChmod(void)
 ---------------------------------------------------------------------------------------*/
 void TestReadWriteLseek(void)
 {
-    char      filename[OS_MAX_PATH_LEN];
-    char      buffer[30];
-    char      copyofbuffer[30];
-    char      seekbuffer[30];
-    char      newbuffer[30];
-    size_t    offset;
-    size_t    size;
-    int32     status;
-    osal_id_t fd = OS_OBJECT_ID_UNDEFINED;
+    char       filename[OS_MAX_PATH_LEN];
+    char       buffer[30];
+    char       copyofbuffer[30];
+    char       seekbuffer[30];
+    char       newbuffer[30];
+    OS_iovec_t iov[2];
+    size_t     offset;
+    size_t     size;
+    int32      status;
+    osal_id_t  fd = OS_OBJECT_ID_UNDEFINED;
 
     memset(newbuffer, 0, sizeof(newbuffer));
 
@@ -429,6 +430,38 @@ void TestReadWriteLseek(void)
     status = OS_close(fd);
     UtAssert_True(status == OS_SUCCESS, "status after close = %d", (int)status);
 
+    /* Open In R/W mode again, to test the scatter/gather APIs */
+    status = OS_OpenCreate(&fd, filename, OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status >= OS_SUCCESS, "status after reopen = %d", (int)status);
+
+    /* write the string in two segments, split at the offset */
+    iov[0].Buffer = copyofbuffer;
+    iov[0].Length = offset;
+    iov[1].Buffer = seekbuffer;
+    iov[1].Length = size - offset;
+    UtAssert_INT32_EQ(OS_writev(fd, iov, 2), size);
+
+    /* read it back into two segments, split in a different place */
+    memset(buffer, 0, sizeof(buffer));
+    memset(newbuffer, 0, sizeof(newbuffer));
+    iov[0].Buffer = buffer;
+    iov[0].Length = 4;
+    iov[1].Buffer = newbuffer;
+    iov[1].Length = size - 4;
+    UtAssert_INT32_EQ(OS_lseek(fd, 0, OS_SEEK_SET), 0);
+    UtAssert_INT32_EQ(OS_readv(fd, iov, 2), size);
+    UtAssert_True(strncmp(buffer, copyofbuffer, 4) == 0 && strcmp(newbuffer, &copyofbuffer[4]) == 0,
+                  "Read: %.4s%s, Written: %s", buffer, newbuffer, copyofbuffer);
+
+    /* bad arguments */
+    UtAssert_INT32_EQ(OS_readv(fd, NULL, 2), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_writev(fd, iov, 0), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_writev(fd, iov, OS_IOV_MAX + 1), OS_ERR_INVALID_SIZE);
+
+    /* close the file */
+    status = OS_close(fd);
+    UtAssert_True(status == OS_SUCCESS, "status after close = %d", (int)status);
+
     /* try removing the file from the drive */
     status = OS_remove(filename);
     UtAssert_True(status == OS_SUCCESS, "status after remove = %d", (int)status);
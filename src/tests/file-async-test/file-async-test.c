@@ -0,0 +1,354 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Asynchronous File I/O Test
+**
+** Fills the asynchronous operation slots of a file with writes, checks
+** that each completion is reported once, and reads the data back the
+** same way.  Then streams a larger file from one task while keeping
+** every slot in use, as a recorder would, and compares the rate with
+** writing the same data using OS_pwrite().  Finally the file is closed
+** while operations are still in progress.
+**
+** Higher numbers indicate better performance.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* The size of each operation, and the number of them in the streaming test */
+#define FILE_ASYNC_BLOCK_SIZE  4096
+#define FILE_ASYNC_NUM_BLOCKS  2048
+#define FILE_ASYNC_WAIT_MSECS  5000
+#define FILE_ASYNC_TOTAL_KIB   ((FILE_ASYNC_NUM_BLOCKS * FILE_ASYNC_BLOCK_SIZE) / 1024)
+
+/* The RAM disk holds the streamed file, plus some spare */
+#define FILE_ASYNC_SECTOR_SIZE 512
+#define FILE_ASYNC_NUM_SECTORS (((FILE_ASYNC_NUM_BLOCKS * FILE_ASYNC_BLOCK_SIZE) / FILE_ASYNC_SECTOR_SIZE) + 1024)
+
+#define FILE_ASYNC_FILE "/drive0/async.dat"
+
+/* Define setup and test functions for UT assert */
+void FileAsyncSetup(void);
+void FileAsyncBasicTest(void);
+void FileAsyncStreamTest(void);
+void FileAsyncCloseTest(void);
+void FileAsyncTeardown(void);
+
+uint8 FileAsyncBuffer[OS_MAX_ASYNC_IO][FILE_ASYNC_BLOCK_SIZE];
+uint8 FileAsyncCheckBuffer[FILE_ASYNC_BLOCK_SIZE];
+
+/*
+ * Fills a buffer with the content of the given block of the test file
+ */
+void FileAsyncFillBlock(uint8 *buffer, uint32 block)
+{
+    memset(buffer, (int)(block % 251) + 1, FILE_ASYNC_BLOCK_SIZE);
+}
+
+/*
+ * Collects the completions of all operations in progress on the file, checking
+ * that each is successful and that each slot (the user_arg) is reported once.
+ */
+bool FileAsyncCollectAll(osal_id_t fd, uint32 num_ops)
+{
+    OS_async_completion_t completion;
+    bool                  seen[OS_MAX_ASYNC_IO];
+    uint32                slot;
+    uint32                i;
+
+    memset(seen, 0, sizeof(seen));
+
+    for (i = 0; i < num_ops; ++i)
+    {
+        if (!UtAssert_INT32_EQ(OS_AsyncWaitCompletion(fd, &completion, FILE_ASYNC_WAIT_MSECS), OS_SUCCESS))
+        {
+            return false;
+        }
+
+        slot = (uint32)(cpuaddr)completion.user_arg;
+        UtAssert_INT32_EQ(completion.result, FILE_ASYNC_BLOCK_SIZE);
+        if (!UtAssert_True(slot < num_ops && !seen[slot], "Completion of slot %u reported once", (unsigned int)slot))
+        {
+            return false;
+        }
+
+        seen[slot] = true;
+    }
+
+    return true;
+}
+
+void FileAsyncSetup(void)
+{
+    UtAssert_INT32_EQ(OS_mkfs(NULL, "/ramdev0", "RAM", OSAL_SIZE_C(FILE_ASYNC_SECTOR_SIZE),
+                              OSAL_BLOCKCOUNT_C(FILE_ASYNC_NUM_SECTORS)),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_mount("/ramdev0", "/drive0"), OS_SUCCESS);
+}
+
+void FileAsyncTeardown(void)
+{
+    OS_remove(FILE_ASYNC_FILE);
+    UtAssert_INT32_EQ(OS_unmount("/drive0"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_rmfs("/ramdev0"), OS_SUCCESS);
+}
+
+void FileAsyncBasicTest(void)
+{
+    OS_async_completion_t completion;
+    osal_id_t             fd;
+    int32                 status;
+    uint32                i;
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, FILE_ASYNC_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    /* Nothing is in progress yet */
+    UtAssert_INT32_EQ(OS_AsyncWaitCompletion(fd, &completion, OS_CHECK), OS_QUEUE_EMPTY);
+
+    for (i = 0; i < OS_MAX_ASYNC_IO; ++i)
+    {
+        FileAsyncFillBlock(FileAsyncBuffer[i], i);
+    }
+
+    status = OS_AsyncWriteSubmit(fd, FileAsyncBuffer[0], FILE_ASYNC_BLOCK_SIZE,
+                                 (osal_offset_t)(OS_MAX_ASYNC_IO - 1) * FILE_ASYNC_BLOCK_SIZE, (void *)0);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Asynchronous file I/O not implemented");
+        OS_close(fd);
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    /* Use every slot, with the blocks written in reverse order */
+    for (i = 1; i < OS_MAX_ASYNC_IO; ++i)
+    {
+        UtAssert_INT32_EQ(OS_AsyncWriteSubmit(fd, FileAsyncBuffer[i], FILE_ASYNC_BLOCK_SIZE,
+                                              (osal_offset_t)(OS_MAX_ASYNC_IO - 1 - i) * FILE_ASYNC_BLOCK_SIZE,
+                                              (void *)(cpuaddr)i),
+                          OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_AsyncWriteSubmit(fd, FileAsyncBuffer[0], FILE_ASYNC_BLOCK_SIZE, 0, NULL), OS_QUEUE_FULL);
+
+    FileAsyncCollectAll(fd, OS_MAX_ASYNC_IO);
+    UtAssert_INT32_EQ(OS_AsyncWaitCompletion(fd, &completion, 10), OS_QUEUE_EMPTY);
+
+    /* The read/write pointer of the file was not used */
+    UtAssert_INT32_EQ(OS_lseek(fd, 0, OS_SEEK_CUR), 0);
+
+    /* Read every block back the same way, into the slot it was written from */
+    memset(FileAsyncBuffer, 0, sizeof(FileAsyncBuffer));
+    UtAssert_INT32_EQ(OS_AsyncReadSubmit(fd, FileAsyncBuffer[0], FILE_ASYNC_BLOCK_SIZE,
+                                         (osal_offset_t)(OS_MAX_ASYNC_IO - 1) * FILE_ASYNC_BLOCK_SIZE, (void *)0),
+                      OS_SUCCESS);
+    for (i = 1; i < OS_MAX_ASYNC_IO; ++i)
+    {
+        UtAssert_INT32_EQ(OS_AsyncReadSubmit(fd, FileAsyncBuffer[i], FILE_ASYNC_BLOCK_SIZE,
+                                             (osal_offset_t)(OS_MAX_ASYNC_IO - 1 - i) * FILE_ASYNC_BLOCK_SIZE,
+                                             (void *)(cpuaddr)i),
+                          OS_SUCCESS);
+    }
+
+    if (FileAsyncCollectAll(fd, OS_MAX_ASYNC_IO))
+    {
+        for (i = 0; i < OS_MAX_ASYNC_IO; ++i)
+        {
+            FileAsyncFillBlock(FileAsyncCheckBuffer, i);
+            UtAssert_True(memcmp(FileAsyncBuffer[i], FileAsyncCheckBuffer, FILE_ASYNC_BLOCK_SIZE) == 0,
+                          "Block %u read back", (unsigned int)i);
+        }
+    }
+
+    /* A read at the end of file completes with zero bytes */
+    UtAssert_INT32_EQ(OS_AsyncReadSubmit(fd, FileAsyncBuffer[0], FILE_ASYNC_BLOCK_SIZE,
+                                         (osal_offset_t)OS_MAX_ASYNC_IO * FILE_ASYNC_BLOCK_SIZE, NULL),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_AsyncWaitCompletion(fd, &completion, FILE_ASYNC_WAIT_MSECS), OS_SUCCESS);
+    UtAssert_INT32_EQ(completion.result, 0);
+
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+}
+
+void FileAsyncStreamTest(void)
+{
+    OS_async_completion_t completion;
+    OS_time_t             start_time;
+    OS_time_t             end_time;
+    osal_id_t             fd;
+    int64                 async_usec;
+    int64                 sync_usec;
+    int32                 status;
+    uint32                block;
+    uint32                slot;
+    uint32                in_flight;
+    uint32                errors;
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, FILE_ASYNC_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    for (slot = 0; slot < OS_MAX_ASYNC_IO; ++slot)
+    {
+        FileAsyncFillBlock(FileAsyncBuffer[slot], slot);
+    }
+
+    /*
+     * Keep every slot in use: each time a write completes, its buffer is
+     * used for the next block.
+     */
+    in_flight = 0;
+    errors    = 0;
+    block     = 0;
+    status    = OS_SUCCESS;
+
+    OS_GetMonotonicTime(&start_time);
+    while (block < FILE_ASYNC_NUM_BLOCKS || in_flight > 0)
+    {
+        if (block < FILE_ASYNC_NUM_BLOCKS && in_flight < OS_MAX_ASYNC_IO)
+        {
+            slot   = block % OS_MAX_ASYNC_IO;
+            status = OS_AsyncWriteSubmit(fd, FileAsyncBuffer[slot], FILE_ASYNC_BLOCK_SIZE,
+                                         (osal_offset_t)block * FILE_ASYNC_BLOCK_SIZE, NULL);
+            if (status != OS_SUCCESS)
+            {
+                break;
+            }
+            ++block;
+            ++in_flight;
+        }
+        else
+        {
+            status = OS_AsyncWaitCompletion(fd, &completion, FILE_ASYNC_WAIT_MSECS);
+            if (status != OS_SUCCESS)
+            {
+                break;
+            }
+            if (completion.result != FILE_ASYNC_BLOCK_SIZE)
+            {
+                ++errors;
+            }
+            --in_flight;
+        }
+    }
+    OS_GetMonotonicTime(&end_time);
+
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Asynchronous file I/O not implemented");
+        OS_close(fd);
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_UINT32_EQ(block, FILE_ASYNC_NUM_BLOCKS);
+    UtAssert_UINT32_EQ(errors, 0);
+    async_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+
+    /* The same writes, one at a time */
+    OS_GetMonotonicTime(&start_time);
+    for (block = 0; block < FILE_ASYNC_NUM_BLOCKS; ++block)
+    {
+        if (OS_pwrite(fd, FileAsyncBuffer[block % OS_MAX_ASYNC_IO], FILE_ASYNC_BLOCK_SIZE,
+                      (osal_offset_t)block * FILE_ASYNC_BLOCK_SIZE) != FILE_ASYNC_BLOCK_SIZE)
+        {
+            ++errors;
+        }
+    }
+    OS_GetMonotonicTime(&end_time);
+    UtAssert_UINT32_EQ(errors, 0);
+    sync_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+
+    UtAssert_MIR("%u KiB with %u writes in flight: %lu KiB/sec", (unsigned int)FILE_ASYNC_TOTAL_KIB,
+                 (unsigned int)OS_MAX_ASYNC_IO,
+                 (unsigned long)((FILE_ASYNC_TOTAL_KIB * 1000000.0) / (async_usec + 1)));
+    UtAssert_MIR("%u KiB with OS_pwrite(): %lu KiB/sec", (unsigned int)FILE_ASYNC_TOTAL_KIB,
+                 (unsigned long)((FILE_ASYNC_TOTAL_KIB * 1000000.0) / (sync_usec + 1)));
+
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+}
+
+void FileAsyncCloseTest(void)
+{
+    OS_async_completion_t completion;
+    osal_id_t             fd;
+    int32                 status;
+    uint32                i;
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, FILE_ASYNC_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    status = OS_SUCCESS;
+    for (i = 0; i < OS_MAX_ASYNC_IO && status == OS_SUCCESS; ++i)
+    {
+        FileAsyncFillBlock(FileAsyncBuffer[i], i);
+        status = OS_AsyncWriteSubmit(fd, FileAsyncBuffer[i], FILE_ASYNC_BLOCK_SIZE,
+                                     (osal_offset_t)i * FILE_ASYNC_BLOCK_SIZE, NULL);
+    }
+
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Asynchronous file I/O not implemented");
+        OS_close(fd);
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    /* The writes in progress are finished before the file is closed */
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_AsyncWaitCompletion(fd, &completion, OS_CHECK), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, FILE_ASYNC_FILE, OS_FILE_FLAG_NONE, OS_READ_ONLY), OS_SUCCESS);
+    for (i = 0; i < OS_MAX_ASYNC_IO; ++i)
+    {
+        memset(FileAsyncCheckBuffer, 0, sizeof(FileAsyncCheckBuffer));
+        UtAssert_INT32_EQ(OS_pread(fd, FileAsyncCheckBuffer, FILE_ASYNC_BLOCK_SIZE,
+                                   (osal_offset_t)i * FILE_ASYNC_BLOCK_SIZE),
+                          FILE_ASYNC_BLOCK_SIZE);
+        UtAssert_True(memcmp(FileAsyncBuffer[i], FileAsyncCheckBuffer, FILE_ASYNC_BLOCK_SIZE) == 0,
+                      "Block %u written before close", (unsigned int)i);
+    }
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(FileAsyncBasicTest, FileAsyncSetup, FileAsyncTeardown, "FileAsyncBasicTest");
+    UtTest_Add(FileAsyncStreamTest, FileAsyncSetup, FileAsyncTeardown, "FileAsyncStreamTest");
+    UtTest_Add(FileAsyncCloseTest, FileAsyncSetup, FileAsyncTeardown, "FileAsyncCloseTest");
+}
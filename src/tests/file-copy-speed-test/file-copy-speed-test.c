@@ -0,0 +1,352 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File Copy Speed Test
+**
+** This is a simple way to gauge the throughput of OS_cp() over a
+** range of file sizes, compared to copying the same file a block at
+** a time with OS_read() and OS_write() as an application would.
+**
+** The sizes start at 4 KiB and grow by a factor of 4 up to
+** FILE_COPY_SPEED_MAX_SIZE.  This defaults to 64 MiB so the test runs
+** in reasonable time and space, and may be raised to 4 GiB on the
+** compiler command line (e.g. -DFILE_COPY_SPEED_MAX_SIZE=4294967296)
+** for a full run on a suitable file system.
+**
+** Each copy is checked against the original, and the copy rate of
+** each method is indicated.  Higher numbers indicate better performance.
+**
+** OS_FileCopyRange() is also checked by copying part of a file into
+** the middle of another.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* The range of file sizes copied */
+#define FILE_COPY_SPEED_MIN_SIZE 4096
+#ifndef FILE_COPY_SPEED_MAX_SIZE
+#define FILE_COPY_SPEED_MAX_SIZE ((osal_offset_t)64 * 1024 * 1024)
+#endif
+
+/* The block size used by the block-at-a-time copy, as OS_cp() used to */
+#define FILE_COPY_SPEED_BLOCK_SIZE 512
+
+/* The size of the buffer used to create and check files */
+#define FILE_COPY_SPEED_BUFFER_SIZE 65536
+
+/* The RAM disk holds the original and one copy of the largest file, plus some spare */
+#define FILE_COPY_SPEED_SECTOR_SIZE 512
+#define FILE_COPY_SPEED_NUM_SECTORS \
+    (((((osal_offset_t)FILE_COPY_SPEED_MAX_SIZE) * 2) / FILE_COPY_SPEED_SECTOR_SIZE) + 1024)
+
+#define FILE_COPY_SPEED_SRC_FILE  "/drive0/copysrc.dat"
+#define FILE_COPY_SPEED_DEST_FILE "/drive0/copydst.dat"
+
+/* Define setup and test functions for UT assert */
+void FileCopySetup(void);
+void FileCopySpeedTest(void);
+void FileCopyRangeTest(void);
+void FileCopyTeardown(void);
+
+uint8 FileCopyBuffer[FILE_COPY_SPEED_BUFFER_SIZE];
+
+/*
+ * The content of the test files at each offset.  This does not repeat
+ * on any power of two, so data copied to the wrong place is detected.
+ */
+uint8 FileCopyPattern(osal_offset_t offset)
+{
+    return (uint8)(offset % 251);
+}
+
+/*
+ * Creates a file of the given size, filled with the test pattern
+ */
+bool FileCopyMakeFile(const char *path, osal_offset_t size)
+{
+    osal_id_t     fd;
+    osal_offset_t offset;
+    size_t        chunk;
+    size_t        i;
+    bool          result;
+
+    if (OS_OpenCreate(&fd, path, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    result = true;
+    for (offset = 0; result && offset < size; offset += chunk)
+    {
+        chunk = sizeof(FileCopyBuffer);
+        if ((size - offset) < (osal_offset_t)chunk)
+        {
+            chunk = size - offset;
+        }
+
+        for (i = 0; i < chunk; ++i)
+        {
+            FileCopyBuffer[i] = FileCopyPattern(offset + i);
+        }
+
+        result = (OS_write(fd, FileCopyBuffer, chunk) == (int32)chunk);
+    }
+
+    OS_close(fd);
+
+    return result;
+}
+
+/*
+ * Checks that a file is the given size, and that it holds the test pattern
+ */
+bool FileCopyCheckFile(const char *path, osal_offset_t size)
+{
+    osal_id_t     fd;
+    osal_offset_t offset;
+    int32         rd_size;
+    int32         i;
+    bool          result;
+
+    if (OS_OpenCreate(&fd, path, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    result = true;
+    offset = 0;
+    while (result)
+    {
+        rd_size = OS_read(fd, FileCopyBuffer, sizeof(FileCopyBuffer));
+        if (rd_size <= 0)
+        {
+            result = (rd_size == 0);
+            break;
+        }
+
+        for (i = 0; result && i < rd_size; ++i)
+        {
+            result = (FileCopyBuffer[i] == FileCopyPattern(offset + i));
+        }
+
+        offset += rd_size;
+    }
+
+    OS_close(fd);
+
+    return (result && offset == size);
+}
+
+/*
+ * Copies a file a block at a time, the same way OS_cp() did before it
+ * could hand the copy to the implementation
+ */
+int32 FileCopyBlocks(const char *src, const char *dest)
+{
+    uint8     block[FILE_COPY_SPEED_BLOCK_SIZE];
+    osal_id_t src_fd;
+    osal_id_t dest_fd;
+    int32     rd_size;
+    int32     status;
+
+    status = OS_OpenCreate(&src_fd, src, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = OS_OpenCreate(&dest_fd, dest, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (status == OS_SUCCESS)
+    {
+        while (true)
+        {
+            rd_size = OS_read(src_fd, block, sizeof(block));
+            if (rd_size <= 0)
+            {
+                status = rd_size;
+                break;
+            }
+            if (OS_write(dest_fd, block, rd_size) != rd_size)
+            {
+                status = OS_ERROR;
+                break;
+            }
+        }
+
+        OS_close(dest_fd);
+    }
+
+    OS_close(src_fd);
+
+    return status;
+}
+
+/*
+ * Returns the copy rate in MiB/s for the given size and elapsed time
+ */
+unsigned long FileCopyRate(osal_offset_t size, OS_time_t start_time, OS_time_t end_time)
+{
+    int64 usec;
+
+    usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    if (usec <= 0)
+    {
+        usec = 1;
+    }
+
+    return (unsigned long)((size * 1000000.0) / (usec * 1048576.0));
+}
+
+void FileCopySetup(void)
+{
+    UtAssert_INT32_EQ(OS_mkfs(NULL, "/ramdev0", "RAM", OSAL_SIZE_C(FILE_COPY_SPEED_SECTOR_SIZE),
+                              OSAL_BLOCKCOUNT_C(FILE_COPY_SPEED_NUM_SECTORS)),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_mount("/ramdev0", "/drive0"), OS_SUCCESS);
+}
+
+void FileCopyTeardown(void)
+{
+    UtAssert_INT32_EQ(OS_unmount("/drive0"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_rmfs("/ramdev0"), OS_SUCCESS);
+}
+
+void FileCopySpeedTest(void)
+{
+    OS_time_t     start_time;
+    OS_time_t     end_time;
+    osal_offset_t size;
+    unsigned long cp_rate;
+    unsigned long block_rate;
+
+    for (size = FILE_COPY_SPEED_MIN_SIZE; size <= FILE_COPY_SPEED_MAX_SIZE; size *= 4)
+    {
+        if (!UtAssert_True(FileCopyMakeFile(FILE_COPY_SPEED_SRC_FILE, size), "Create %lu KiB file",
+                           (unsigned long)(size / 1024)))
+        {
+            break;
+        }
+
+        OS_GetMonotonicTime(&start_time);
+        UtAssert_INT32_EQ(OS_cp(FILE_COPY_SPEED_SRC_FILE, FILE_COPY_SPEED_DEST_FILE), OS_SUCCESS);
+        OS_GetMonotonicTime(&end_time);
+        cp_rate = FileCopyRate(size, start_time, end_time);
+
+        UtAssert_True(FileCopyCheckFile(FILE_COPY_SPEED_DEST_FILE, size), "OS_cp() copy of %lu KiB file intact",
+                      (unsigned long)(size / 1024));
+        UtAssert_INT32_EQ(OS_remove(FILE_COPY_SPEED_DEST_FILE), OS_SUCCESS);
+
+        OS_GetMonotonicTime(&start_time);
+        UtAssert_INT32_EQ(FileCopyBlocks(FILE_COPY_SPEED_SRC_FILE, FILE_COPY_SPEED_DEST_FILE), OS_SUCCESS);
+        OS_GetMonotonicTime(&end_time);
+        block_rate = FileCopyRate(size, start_time, end_time);
+
+        UtAssert_True(FileCopyCheckFile(FILE_COPY_SPEED_DEST_FILE, size), "Block copy of %lu KiB file intact",
+                      (unsigned long)(size / 1024));
+        UtAssert_INT32_EQ(OS_remove(FILE_COPY_SPEED_DEST_FILE), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_remove(FILE_COPY_SPEED_SRC_FILE), OS_SUCCESS);
+
+        UtAssert_MIR("%lu KiB: OS_cp() %lu MiB/s, %u byte blocks %lu MiB/s", (unsigned long)(size / 1024), cp_rate,
+                     (unsigned int)FILE_COPY_SPEED_BLOCK_SIZE, block_rate);
+    }
+}
+
+void FileCopyRangeTest(void)
+{
+    osal_id_t src_fd;
+    osal_id_t dest_fd;
+    int32     status;
+    int32     i;
+    bool      result;
+
+    UtAssert_True(FileCopyMakeFile(FILE_COPY_SPEED_SRC_FILE, FILE_COPY_SPEED_BUFFER_SIZE), "Create source file");
+    UtAssert_INT32_EQ(OS_OpenCreate(&src_fd, FILE_COPY_SPEED_SRC_FILE, OS_FILE_FLAG_NONE, OS_READ_ONLY), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_OpenCreate(&dest_fd, FILE_COPY_SPEED_DEST_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                    OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    /* Copy 20000 bytes from offset 1000 in the source to offset 5000 in the new file */
+    status = OS_FileCopyRange(src_fd, 1000, dest_fd, 5000, 20000);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("OS_FileCopyRange() not implemented");
+    }
+    else
+    {
+        UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+        /* Neither file position is used or changed */
+        UtAssert_INT32_EQ(OS_lseek(src_fd, 0, OS_SEEK_CUR), 0);
+        UtAssert_INT32_EQ(OS_lseek(dest_fd, 0, OS_SEEK_CUR), 0);
+
+        /* The start of the new file is empty, followed by the copied range */
+        UtAssert_INT32_EQ(OS_read(dest_fd, FileCopyBuffer, sizeof(FileCopyBuffer)), 25000);
+        result = true;
+        for (i = 0; result && i < 25000; ++i)
+        {
+            result = (FileCopyBuffer[i] == ((i < 5000) ? 0 : FileCopyPattern(i - 4000)));
+        }
+        UtAssert_True(result, "Copied range intact");
+
+        /* Copying past the end of the source copies what is there */
+        UtAssert_INT32_EQ(OS_FileCopyRange(src_fd, FILE_COPY_SPEED_BUFFER_SIZE - 100, dest_fd, 0, 1000),
+                          OS_ERR_INVALID_SIZE);
+        UtAssert_INT32_EQ(OS_lseek(dest_fd, 0, OS_SEEK_SET), 0);
+        UtAssert_INT32_EQ(OS_read(dest_fd, FileCopyBuffer, 100), 100);
+        result = true;
+        for (i = 0; result && i < 100; ++i)
+        {
+            result = (FileCopyBuffer[i] == FileCopyPattern(FILE_COPY_SPEED_BUFFER_SIZE - 100 + i));
+        }
+        UtAssert_True(result, "Copied end of file intact");
+
+        UtAssert_INT32_EQ(OS_FileCopyRange(src_fd, 0, dest_fd, 0, 0), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_FileCopyRange(src_fd, -1, dest_fd, 0, 10), OS_ERR_INVALID_ARGUMENT);
+    }
+
+    UtAssert_INT32_EQ(OS_FileCopyRange(OS_OBJECT_ID_UNDEFINED, 0, dest_fd, 0, 10), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_close(dest_fd), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_close(src_fd), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_remove(FILE_COPY_SPEED_DEST_FILE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_remove(FILE_COPY_SPEED_SRC_FILE), OS_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(FileCopySpeedTest, FileCopySetup, FileCopyTeardown, "FileCopySpeedTest");
+    UtTest_Add(FileCopyRangeTest, FileCopySetup, FileCopyTeardown, "FileCopyRangeTest");
+}
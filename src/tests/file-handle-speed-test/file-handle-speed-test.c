@@ -0,0 +1,238 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File Handle Speed Test
+**
+** This is a simple way to gauge how the cost of looking up an
+** object by ID scales with the number of tasks doing so.
+**
+** Each worker task owns a separate file handle, and continuously
+** seeks to the start of its file, writes a word, seeks back and
+** reads it again.  OS_lseek(), OS_write() and OS_read() all look
+** up the handle in OS_LOCK_MODE_REFCOUNT, and no two tasks share
+** a handle, so any loss of scaling as tasks are added is due to
+** contention on shared state (e.g. the OSAL object table) rather
+** than the files themselves.
+**
+** The test is repeated for 1, 2, 4, 8, 16 and 32 tasks, each
+** running for 1 second.  The total number of seek/write/seek/read
+** cycles completed for each step is reported.  Higher numbers
+** indicate better performance.
+**
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the FileHandleRun()
+ * function may never get CPU time to stop the test.
+ */
+#define FILEHANDLETEST_TASK_PRIORITY 150
+
+/* The maximum number of worker tasks/files */
+#define FILEHANDLETEST_MAX_TASKS 32
+
+/* The duration of each step of the test, in milliseconds */
+#define FILEHANDLETEST_RUN_TIME 1000
+
+/*
+ * A limit for the maximum amount of iterations that
+ * each task will perform.  This prevents the test
+ * from running infinitely in case the stop flag does
+ * not work correctly.  See note above about priority.
+ */
+#define FILEHANDLETEST_WORK_LIMIT 100000000
+
+/* Define setup, test and teardown functions for UT assert */
+void FileHandleSetup(void);
+void FileHandleRun(void);
+void FileHandleTeardown(void);
+
+typedef struct
+{
+    osal_id_t task_id;
+    osal_id_t file_id;
+    uint32    work;
+} FileHandleTestWorker_t;
+
+FileHandleTestWorker_t FileHandleTestWorkers[FILEHANDLETEST_MAX_TASKS];
+volatile bool          FileHandleTestStop;
+
+void FileHandleTestWorkerTask(void)
+{
+    FileHandleTestWorker_t *worker;
+    OS_task_prop_t          task_prop;
+    uint32                  i;
+    uint32                  data;
+    int32                   status;
+
+    /*
+     * The worker number is obtained from the task name, as the
+     * task may start running before OS_TaskCreate() has returned
+     * the task ID to the parent.
+     */
+    status = OS_TaskGetInfo(OS_TaskGetId(), &task_prop);
+    if (status != OS_SUCCESS)
+    {
+        OS_printf("Worker: Error calling OS_TaskGetInfo: %d\n", (int)status);
+        return;
+    }
+
+    i = strtoul(&task_prop.name[1], NULL, 10);
+    if (i >= FILEHANDLETEST_MAX_TASKS)
+    {
+        OS_printf("Worker: Invalid task name %s\n", task_prop.name);
+        return;
+    }
+
+    worker = &FileHandleTestWorkers[i];
+
+    data = 0;
+    while (!FileHandleTestStop && worker->work < FILEHANDLETEST_WORK_LIMIT)
+    {
+        status = OS_lseek(worker->file_id, 0, OS_SEEK_SET);
+        if (status == OS_SUCCESS)
+        {
+            status = OS_write(worker->file_id, &data, sizeof(data));
+        }
+        if (status == (int32)sizeof(data))
+        {
+            status = OS_lseek(worker->file_id, 0, OS_SEEK_SET);
+        }
+        if (status == OS_SUCCESS)
+        {
+            status = OS_read(worker->file_id, &data, sizeof(data));
+        }
+        if (status != (int32)sizeof(data))
+        {
+            OS_printf("Worker %u: Error in file I/O: %d\n", (unsigned int)i, (int)status);
+            break;
+        }
+
+        ++data;
+        ++worker->work;
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(FileHandleRun, FileHandleSetup, FileHandleTeardown, "FileHandleSpeedTest");
+}
+
+void FileHandleSetup(void)
+{
+    uint32 i;
+    char   name[OS_MAX_PATH_LEN];
+
+    memset(FileHandleTestWorkers, 0, sizeof(FileHandleTestWorkers));
+
+    UtAssert_INT32_EQ(OS_mkfs(NULL, "/ramdev0", "RAM", OSAL_SIZE_C(512), OSAL_BLOCKCOUNT_C(200)), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_mount("/ramdev0", "/drive0"), OS_SUCCESS);
+
+    for (i = 0; i < FILEHANDLETEST_MAX_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "/drive0/f%u.dat", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_OpenCreate(&FileHandleTestWorkers[i].file_id, name,
+                                        OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE),
+                          OS_SUCCESS);
+    }
+}
+
+void FileHandleRun(void)
+{
+    uint32 num_tasks;
+    uint32 i;
+    uint32 total_work;
+    char   name[OS_MAX_API_NAME];
+
+    for (num_tasks = 1; num_tasks <= FILEHANDLETEST_MAX_TASKS; num_tasks *= 2)
+    {
+        FileHandleTestStop = false;
+
+        for (i = 0; i < num_tasks; ++i)
+        {
+            FileHandleTestWorkers[i].work = 0;
+            snprintf(name, sizeof(name), "W%u", (unsigned int)i);
+            UtAssert_INT32_EQ(OS_TaskCreate(&FileHandleTestWorkers[i].task_id, name, FileHandleTestWorkerTask,
+                                            OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                                            OSAL_PRIORITY_C(FILEHANDLETEST_TASK_PRIORITY), 0),
+                              OS_SUCCESS);
+        }
+
+        /* Time Limited Execution */
+        OS_TaskDelay(FILEHANDLETEST_RUN_TIME);
+        FileHandleTestStop = true;
+
+        /* Allow the tasks to see the stop flag and exit on their own */
+        OS_TaskDelay(100);
+
+        total_work = 0;
+        for (i = 0; i < num_tasks; ++i)
+        {
+            /*
+             * NOTE: the task should have exited by itself, in which
+             * case its ID is no longer valid and this is a no-op.
+             */
+            OS_TaskDelete(FileHandleTestWorkers[i].task_id);
+            total_work += FileHandleTestWorkers[i].work;
+        }
+
+        /*
+         * NOTE: Not every worker is guaranteed to get CPU time within the run
+         * time when there are more workers than CPUs, so only the total is checked.
+         */
+        UtAssert_True(total_work != 0, "%u tasks total work counter = %u", (unsigned int)num_tasks,
+                      (unsigned int)total_work);
+
+        UtPrintf("%2u tasks: %10u I/O cycles in %u ms (%u per task)", (unsigned int)num_tasks,
+                 (unsigned int)total_work, (unsigned int)FILEHANDLETEST_RUN_TIME,
+                 (unsigned int)(total_work / num_tasks));
+    }
+}
+
+void FileHandleTeardown(void)
+{
+    uint32 i;
+
+    for (i = 0; i < FILEHANDLETEST_MAX_TASKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_close(FileHandleTestWorkers[i].file_id), OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_unmount("/drive0"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_rmfs("/ramdev0"), OS_SUCCESS);
+}
@@ -0,0 +1,203 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Object Table Lock Statistics Test
+**
+** Several tasks concurrently create, look up, use and delete
+** objects, which all require the object table locks.  The lock
+** statistics of every object type are then reported, to show
+** which tables are contended.
+**
+** The statistics are only available if OSAL_CONFIG_LOCK_STATS
+** is enabled, otherwise the test is not applicable.
+**
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* The number of worker tasks and number of create/delete cycles for each */
+#define LOCK_STATS_TEST_TASKS 4
+#define LOCK_STATS_TEST_LOOPS 1000
+
+#define LOCK_STATS_TEST_TASK_PRIORITY 150
+
+/* Define setup and test functions for UT assert */
+void LockStatsRun(void);
+
+osal_id_t       LockStatsTaskId[LOCK_STATS_TEST_TASKS];
+volatile uint32 LockStatsTaskDone;
+volatile uint32 LockStatsTaskErrors;
+
+/*
+ * Repeatedly creates a queue and a semaphore, uses them, and deletes them again
+ */
+void LockStatsWorkerTask(void)
+{
+    OS_task_prop_t  task_prop;
+    OS_queue_prop_t queue_prop;
+    osal_id_t       queue_id;
+    osal_id_t       sem_id;
+    osal_id_t       found_id;
+    char            queue_name[OS_MAX_API_NAME];
+    char            sem_name[OS_MAX_API_NAME];
+    uint32          i;
+
+    OS_TaskGetInfo(OS_TaskGetId(), &task_prop);
+
+    /* Leave room for the prefix so the names still fit an object name */
+    snprintf(queue_name, sizeof(queue_name), "Q%.*s", (int)(sizeof(queue_name) - 2), task_prop.name);
+    snprintf(sem_name, sizeof(sem_name), "S%.*s", (int)(sizeof(sem_name) - 2), task_prop.name);
+
+    for (i = 0; i < LOCK_STATS_TEST_LOOPS; ++i)
+    {
+        if (OS_QueueCreate(&queue_id, queue_name, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(sizeof(uint32)), 0) != OS_SUCCESS)
+        {
+            ++LockStatsTaskErrors;
+            break;
+        }
+
+        if (OS_BinSemCreate(&sem_id, sem_name, 1, 0) == OS_SUCCESS)
+        {
+            OS_BinSemTake(sem_id);
+            OS_BinSemGive(sem_id);
+            OS_BinSemDelete(sem_id);
+        }
+
+        if (OS_QueueGetIdByName(&found_id, queue_name) != OS_SUCCESS || !OS_ObjectIdEqual(found_id, queue_id) ||
+            OS_QueueGetInfo(queue_id, &queue_prop) != OS_SUCCESS)
+        {
+            ++LockStatsTaskErrors;
+        }
+
+        if (OS_QueueDelete(queue_id) != OS_SUCCESS)
+        {
+            ++LockStatsTaskErrors;
+        }
+    }
+
+    ++LockStatsTaskDone;
+}
+
+/*
+ * Reports the lock statistics of one object type
+ */
+void LockStatsReport(osal_objtype_t idtype, const char *TypeName)
+{
+    OS_lock_stats_t stats;
+    int32           status;
+
+    status = OS_ObjectTypeGetLockStats(idtype, &stats);
+    if (status == OS_ERR_INVALID_ID)
+    {
+        /* No objects of this type are configured */
+        UtAssert_NA("%s: no table", TypeName);
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_True(stats.contended_count <= stats.acquire_count, "%s: contended (%lu) <= acquired (%lu)", TypeName,
+                  (unsigned long)stats.contended_count, (unsigned long)stats.acquire_count);
+
+    UtAssert_MIR("%-8s acquired=%lu contended=%lu wait total/max=%lld/%lld ns hold total/max=%lld/%lld ns "
+                 "max holder=%lx",
+                 TypeName, (unsigned long)stats.acquire_count, (unsigned long)stats.contended_count,
+                 (long long)OS_TimeGetTotalNanoseconds(stats.total_wait_time),
+                 (long long)OS_TimeGetTotalNanoseconds(stats.max_wait_time),
+                 (long long)OS_TimeGetTotalNanoseconds(stats.total_hold_time),
+                 (long long)OS_TimeGetTotalNanoseconds(stats.max_hold_time),
+                 OS_ObjectIdToInteger(stats.max_hold_task_id));
+}
+
+void LockStatsRun(void)
+{
+    OS_lock_stats_t stats;
+    char            name[OS_MAX_API_NAME];
+    uint32          i;
+
+    if (OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_TASK, &stats) == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Object table lock statistics not enabled");
+        return;
+    }
+
+    UtAssert_INT32_EQ(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_TASK, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_UNDEFINED, &stats), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_USER, &stats), OS_ERR_INVALID_ID);
+
+    LockStatsTaskDone   = 0;
+    LockStatsTaskErrors = 0;
+
+    for (i = 0; i < LOCK_STATS_TEST_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "W%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_TaskCreate(&LockStatsTaskId[i], name, LockStatsWorkerTask, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(16384), OSAL_PRIORITY_C(LOCK_STATS_TEST_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+    }
+
+    for (i = 0; i < 1000 && LockStatsTaskDone < LOCK_STATS_TEST_TASKS; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+
+    UtAssert_UINT32_EQ(LockStatsTaskDone, LOCK_STATS_TEST_TASKS);
+    UtAssert_UINT32_EQ(LockStatsTaskErrors, 0);
+
+    /* Every worker task used the queue table at least twice per loop */
+    UtAssert_INT32_EQ(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_QUEUE, &stats), OS_SUCCESS);
+    UtAssert_True(stats.acquire_count >= (LOCK_STATS_TEST_TASKS * LOCK_STATS_TEST_LOOPS * 2),
+                  "Queue table acquired (%lu) >= %lu", (unsigned long)stats.acquire_count,
+                  (unsigned long)(LOCK_STATS_TEST_TASKS * LOCK_STATS_TEST_LOOPS * 2));
+
+    LockStatsReport(OS_OBJECT_TYPE_OS_TASK, "Task");
+    LockStatsReport(OS_OBJECT_TYPE_OS_QUEUE, "Queue");
+    LockStatsReport(OS_OBJECT_TYPE_OS_COUNTSEM, "CountSem");
+    LockStatsReport(OS_OBJECT_TYPE_OS_BINSEM, "BinSem");
+    LockStatsReport(OS_OBJECT_TYPE_OS_MUTEX, "Mutex");
+    LockStatsReport(OS_OBJECT_TYPE_OS_STREAM, "Stream");
+    LockStatsReport(OS_OBJECT_TYPE_OS_DIR, "Dir");
+    LockStatsReport(OS_OBJECT_TYPE_OS_TIMEBASE, "TimeBase");
+    LockStatsReport(OS_OBJECT_TYPE_OS_TIMECB, "Timer");
+    LockStatsReport(OS_OBJECT_TYPE_OS_MODULE, "Module");
+    LockStatsReport(OS_OBJECT_TYPE_OS_FILESYS, "FileSys");
+    LockStatsReport(OS_OBJECT_TYPE_OS_CONSOLE, "Console");
+    LockStatsReport(OS_OBJECT_TYPE_OS_CONDVAR, "CondVar");
+    LockStatsReport(OS_OBJECT_TYPE_OS_POLLER, "Poller");
+    LockStatsReport(OS_OBJECT_TYPE_OS_MEMPOOL, "MemPool");
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(LockStatsRun, NULL, NULL, "LockStatsTest");
+}
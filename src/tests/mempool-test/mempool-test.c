@@ -0,0 +1,279 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Memory Pool Test
+**
+** Checks the basic get/put operations and statistics of a memory
+** pool, then has several tasks concurrently take and return blocks
+** from the same pool, each checking that no other task was handed
+** the same block while it held it.
+**
+** Finally a task blocks on an empty pool until the main task returns
+** a block, if the implementation supports waiting.
+**
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+/* The number of blocks in the pool, and size of each */
+#define MEMPOOL_TEST_BLOCKS     8
+#define MEMPOOL_TEST_BLOCK_SIZE 100
+
+/* The number of worker tasks and number of get/put cycles for each */
+#define MEMPOOL_TEST_TASKS 4
+#define MEMPOOL_TEST_LOOPS 10000
+
+#define MEMPOOL_TEST_TASK_PRIORITY 150
+
+/* Define setup and test functions for UT assert */
+void MemPoolSetup(void);
+void MemPoolBasicTest(void);
+void MemPoolConcurrentTest(void);
+void MemPoolWaitTest(void);
+void MemPoolTeardown(void);
+
+osal_id_t       MemPoolId;
+osal_id_t       MemPoolTaskId[MEMPOOL_TEST_TASKS];
+volatile uint32 MemPoolTaskDone;
+volatile uint32 MemPoolTaskErrors;
+volatile int32  MemPoolWaitStatus;
+void *volatile MemPoolWaitBlock;
+
+/*
+ * Repeatedly takes a block, stamps it with the task number, and checks
+ * that the stamp is still intact before returning it to the pool.
+ */
+void MemPoolWorkerTask(void)
+{
+    OS_task_prop_t   task_prop;
+    volatile uint32 *block;
+    uint32           id;
+    uint32           i;
+    int32            status;
+
+    OS_TaskGetInfo(OS_TaskGetId(), &task_prop);
+    id = strtoul(&task_prop.name[1], NULL, 10);
+
+    for (i = 0; i < MEMPOOL_TEST_LOOPS; ++i)
+    {
+        /* There are more blocks than tasks, so the pool should never be empty */
+        status = OS_MemPoolGet(MemPoolId, (void **)&block, OS_CHECK);
+        if (status != OS_SUCCESS)
+        {
+            ++MemPoolTaskErrors;
+            break;
+        }
+
+        block[0] = id;
+        OS_TaskDelay(0);
+        if (block[0] != id)
+        {
+            ++MemPoolTaskErrors;
+        }
+
+        if (OS_MemPoolPut(MemPoolId, (void *)block) != OS_SUCCESS)
+        {
+            ++MemPoolTaskErrors;
+        }
+    }
+
+    ++MemPoolTaskDone;
+}
+
+/*
+ * Waits for a block to become available in an empty pool
+ */
+void MemPoolWaitTask(void)
+{
+    void *block;
+
+    MemPoolWaitStatus = OS_MemPoolGet(MemPoolId, &block, 5000);
+    if (MemPoolWaitStatus == OS_SUCCESS)
+    {
+        MemPoolWaitBlock = block;
+    }
+}
+
+void MemPoolSetup(void)
+{
+    UtAssert_INT32_EQ(OS_MemPoolCreate(&MemPoolId, "Pool", MEMPOOL_TEST_BLOCK_SIZE,
+                                       OSAL_BLOCKCOUNT_C(MEMPOOL_TEST_BLOCKS)),
+                      OS_SUCCESS);
+}
+
+void MemPoolTeardown(void)
+{
+    UtAssert_INT32_EQ(OS_MemPoolDelete(MemPoolId), OS_SUCCESS);
+}
+
+void MemPoolBasicTest(void)
+{
+    OS_mempool_prop_t prop;
+    osal_id_t         id;
+    void *            blocks[MEMPOOL_TEST_BLOCKS];
+    void *            extra;
+    uint32            i;
+    uint32            j;
+
+    UtAssert_INT32_EQ(OS_MemPoolGetIdByName(&id, "Pool"), OS_SUCCESS);
+    UtAssert_True(OS_ObjectIdEqual(id, MemPoolId), "OS_MemPoolGetIdByName() found the pool");
+
+    /* Every block must be distinct, aligned, and usable up to the block size */
+    for (i = 0; i < MEMPOOL_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_MemPoolGet(MemPoolId, &blocks[i], OS_CHECK), OS_SUCCESS);
+        UtAssert_True(((cpuaddr)blocks[i] % sizeof(double)) == 0, "Block %u aligned", (unsigned int)i);
+        memset(blocks[i], i, MEMPOOL_TEST_BLOCK_SIZE);
+        for (j = 0; j < i; ++j)
+        {
+            UtAssert_True(blocks[i] != blocks[j], "Block %u != Block %u", (unsigned int)i, (unsigned int)j);
+        }
+    }
+
+    /* The pool is now empty */
+    UtAssert_INT32_EQ(OS_MemPoolGet(MemPoolId, &extra, OS_CHECK), OS_ERROR_TIMEOUT);
+    UtAssert_INT32_EQ(OS_MemPoolGet(MemPoolId, &extra, 10), OS_ERROR_TIMEOUT);
+
+    UtAssert_INT32_EQ(OS_MemPoolGetInfo(MemPoolId, &prop), OS_SUCCESS);
+    UtAssert_StrCmp(prop.name, "Pool", "Pool name (%s) == Pool", prop.name);
+    UtAssert_UINT32_EQ(prop.block_size, MEMPOOL_TEST_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(prop.num_blocks, MEMPOOL_TEST_BLOCKS);
+    UtAssert_UINT32_EQ(prop.free_blocks, 0);
+    UtAssert_UINT32_EQ(prop.min_free_blocks, 0);
+    UtAssert_UINT32_EQ(prop.failed_gets, 2);
+
+    /* Blocks from elsewhere are rejected */
+    UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, &prop), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, (uint8 *)blocks[0] + 1), OS_ERR_INVALID_ARGUMENT);
+
+    for (i = 0; i < MEMPOOL_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, blocks[i]), OS_SUCCESS);
+    }
+
+    /* Blocks cannot be returned twice */
+    UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, blocks[0]), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, blocks[MEMPOOL_TEST_BLOCKS - 1]), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UtAssert_INT32_EQ(OS_MemPoolGetInfo(MemPoolId, &prop), OS_SUCCESS);
+    UtAssert_UINT32_EQ(prop.free_blocks, MEMPOOL_TEST_BLOCKS);
+    UtAssert_UINT32_EQ(prop.min_free_blocks, 0);
+}
+
+void MemPoolConcurrentTest(void)
+{
+    OS_mempool_prop_t prop;
+    char              name[OS_MAX_API_NAME];
+    uint32            i;
+
+    MemPoolTaskDone   = 0;
+    MemPoolTaskErrors = 0;
+
+    for (i = 0; i < MEMPOOL_TEST_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "W%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_TaskCreate(&MemPoolTaskId[i], name, MemPoolWorkerTask, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(16384), OSAL_PRIORITY_C(MEMPOOL_TEST_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+    }
+
+    for (i = 0; i < 1000 && MemPoolTaskDone < MEMPOOL_TEST_TASKS; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+
+    UtAssert_UINT32_EQ(MemPoolTaskDone, MEMPOOL_TEST_TASKS);
+    UtAssert_UINT32_EQ(MemPoolTaskErrors, 0);
+
+    /* All blocks must have been returned */
+    UtAssert_INT32_EQ(OS_MemPoolGetInfo(MemPoolId, &prop), OS_SUCCESS);
+    UtAssert_UINT32_EQ(prop.free_blocks, MEMPOOL_TEST_BLOCKS);
+    UtAssert_UINT32_EQ(prop.failed_gets, 0);
+}
+
+void MemPoolWaitTest(void)
+{
+    osal_id_t task_id;
+    void *    blocks[MEMPOOL_TEST_BLOCKS];
+    uint32    i;
+
+    for (i = 0; i < MEMPOOL_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_MemPoolGet(MemPoolId, &blocks[i], OS_CHECK), OS_SUCCESS);
+    }
+
+    MemPoolWaitStatus = 1;
+    MemPoolWaitBlock  = NULL;
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "Waiter", MemPoolWaitTask, OSAL_TASK_STACK_ALLOCATE,
+                                    OSAL_SIZE_C(16384), OSAL_PRIORITY_C(MEMPOOL_TEST_TASK_PRIORITY), 0),
+                      OS_SUCCESS);
+
+    /* Give the task time to block, it should not get a block yet */
+    OS_TaskDelay(100);
+
+    if (MemPoolWaitStatus == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Waiting for a memory pool block not implemented");
+    }
+    else
+    {
+        UtAssert_INT32_EQ(MemPoolWaitStatus, 1);
+
+        UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, blocks[3]), OS_SUCCESS);
+
+        for (i = 0; i < 100 && MemPoolWaitStatus == 1; ++i)
+        {
+            OS_TaskDelay(10);
+        }
+
+        UtAssert_INT32_EQ(MemPoolWaitStatus, OS_SUCCESS);
+        UtAssert_ADDRESS_EQ(MemPoolWaitBlock, blocks[3]);
+    }
+
+    OS_TaskDelete(task_id);
+
+    for (i = 0; i < MEMPOOL_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_MemPoolPut(MemPoolId, blocks[i]), OS_SUCCESS);
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(MemPoolBasicTest, MemPoolSetup, MemPoolTeardown, "MemPoolBasicTest");
+    UtTest_Add(MemPoolConcurrentTest, MemPoolSetup, MemPoolTeardown, "MemPoolConcurrentTest");
+    UtTest_Add(MemPoolWaitTest, MemPoolSetup, MemPoolTeardown, "MemPoolWaitTest");
+}
@@ -42,6 +42,11 @@
  */
 #define UT_TIMEOUT 4000
 
+/*
+ * Number of datagrams for the batched send/receive test
+ */
+#define UT_MULTI_MSG_COUNT 40
+
 /*
  * Variations of client->server connections to create.
  * This tests that the server socket can accept multiple connections,
@@ -340,6 +345,100 @@ void TestDatagramNetworkApi(void)
     UtAssert_True(OS_ObjectIdEqual(objid, p1_socket_id), "objid (%lu) == p1_socket_id", OS_ObjectIdToInteger(objid));
 }
 
+/*****************************************************************************
+ *
+ * Batched/Vectored Datagram Network Functional Test
+ *
+ *****************************************************************************/
+void TestDatagramMultiNetworkApi(void)
+{
+    uint32       TxBuf[UT_MULTI_MSG_COUNT];
+    uint32       RxBuf[UT_MULTI_MSG_COUNT];
+    OS_SockMsg_t TxMsgs[UT_MULTI_MSG_COUNT];
+    OS_SockMsg_t RxMsgs[UT_MULTI_MSG_COUNT];
+    OS_iovec_t   Iov[2];
+    uint32       Hdr     = 0x11223344;
+    uint32       Payload = 0x55667788;
+    uint32       Combined[2];
+    uint32       i;
+    uint32       total;
+    int32        actual;
+    uint16       PortNum;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    memset(TxMsgs, 0, sizeof(TxMsgs));
+    memset(RxMsgs, 0, sizeof(RxMsgs));
+    memset(RxBuf, 0, sizeof(RxBuf));
+    for (i = 0; i < UT_MULTI_MSG_COUNT; ++i)
+    {
+        TxBuf[i]         = 1000 + i;
+        TxMsgs[i].Buffer = &TxBuf[i];
+        TxMsgs[i].BufLen = sizeof(TxBuf[i]);
+        TxMsgs[i].Addr   = p2_addr;
+        RxMsgs[i].Buffer = &RxBuf[i];
+        RxMsgs[i].BufLen = sizeof(RxBuf[i]);
+    }
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, NULL, UT_MULTI_MSG_COUNT), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, TxMsgs, 0), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(regular_file_id, TxMsgs, UT_MULTI_MSG_COUNT), OS_ERR_INCORRECT_OBJ_TYPE);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, NULL, UT_MULTI_MSG_COUNT, UT_TIMEOUT), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, RxMsgs, 0, UT_TIMEOUT), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(regular_file_id, RxMsgs, UT_MULTI_MSG_COUNT, UT_TIMEOUT),
+                      OS_ERR_INCORRECT_OBJ_TYPE);
+
+    /* Nothing pending, so a poll should time out */
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, RxMsgs, UT_MULTI_MSG_COUNT, OS_CHECK), OS_ERROR_TIMEOUT);
+
+    /* Send a batch from peer1 to peer2 */
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, TxMsgs, UT_MULTI_MSG_COUNT), UT_MULTI_MSG_COUNT);
+    UtAssert_UINT32_EQ(TxMsgs[UT_MULTI_MSG_COUNT - 1].MsgLen, sizeof(TxBuf[0]));
+
+    /* Receive the batch, which may be delivered in more than one call */
+    total = 0;
+    while (total < UT_MULTI_MSG_COUNT)
+    {
+        actual = OS_SocketRecvFromMulti(p2_socket_id, &RxMsgs[total], UT_MULTI_MSG_COUNT - total, UT_TIMEOUT);
+        if (actual <= 0)
+        {
+            UtAssert_Failed("OS_SocketRecvFromMulti() returned %d after %u messages", (int)actual,
+                            (unsigned int)total);
+            break;
+        }
+        total += actual;
+    }
+
+    UtAssert_UINT32_EQ(total, UT_MULTI_MSG_COUNT);
+    for (i = 0; i < total; ++i)
+    {
+        UtAssert_UINT32_EQ(RxMsgs[i].MsgLen, sizeof(RxBuf[i]));
+        UtAssert_UINT32_EQ(RxBuf[i], TxBuf[i]);
+    }
+    UtAssert_INT32_EQ(OS_SocketAddrGetPort(&PortNum, &RxMsgs[0].Addr), OS_SUCCESS);
+    UtAssert_UINT32_EQ(PortNum, 9999);
+
+    /* Send a datagram gathered from separate header and payload buffers */
+    Iov[0].Buffer = &Hdr;
+    Iov[0].Length = sizeof(Hdr);
+    Iov[1].Buffer = &Payload;
+    Iov[1].Length = sizeof(Payload);
+    UtAssert_INT32_EQ(OS_SocketSendV(p1_socket_id, Iov, 0, &p2_addr), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendV(p1_socket_id, Iov, 2, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendV(p1_socket_id, Iov, 2, &p2_addr), sizeof(Hdr) + sizeof(Payload));
+
+    memset(Combined, 0, sizeof(Combined));
+    UtAssert_INT32_EQ(OS_SocketRecvFrom(p2_socket_id, Combined, sizeof(Combined), NULL, UT_TIMEOUT),
+                      sizeof(Combined));
+    UtAssert_UINT32_EQ(Combined[0], Hdr);
+    UtAssert_UINT32_EQ(Combined[1], Payload);
+}
+
 /*****************************************************************************
  *
  * Datagram Network Teardown
@@ -756,7 +855,7 @@ void UtTest_Setup(void)
      */
     UtTest_Add(TestNetworkApiBadArgs, NULL, NULL, "NetworkApiBadArgs");
     UtTest_Add(TestNetworkApiInet6, NULL, NULL, "TestNetworkApiInet6");
-    UtTest_Add(TestDatagramNetworkApi, TestDatagramNetworkApi_Setup, TestDatagramNetworkApi_Teardown,
-               "TestDatagramNetworkApi");
+    UtTest_Add(TestDatagramNetworkApi, TestDatagramNetworkApi_Setup, NULL, "TestDatagramNetworkApi");
+    UtTest_Add(TestDatagramMultiNetworkApi, NULL, TestDatagramNetworkApi_Teardown, "TestDatagramMultiNetworkApi");
     UtTest_Add(TestStreamNetworkApi, NULL, TestStreamNetworkApi_Teardown, "TestStreamNetworkApi");
 }
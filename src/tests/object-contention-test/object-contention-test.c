@@ -0,0 +1,235 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Object Contention Test
+**
+** This is a simple way to gauge how much tasks operating on different
+** objects slow each other down.  Each task repeatedly gives and takes
+** its own counting semaphore, so the tasks never wait on each other,
+** but the semaphores are created one after another and therefore use
+** neighboring entries in the object tables.
+**
+** The work is first done by one task alone, and then by several tasks
+** at once.  On a multi-core machine, if the table entries of neighboring
+** objects share a cache line, the tasks contend for that line and each
+** one does much less work than the task running alone.  Comparing builds
+** with a different OSAL_CONFIG_CACHE_LINE_SIZE shows the effect of the
+** table layout.
+**
+** At the end of each test the number of give/take cycles per second is
+** indicated.  Higher numbers indicate better performance.
+**
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* The number of tasks (and semaphores) used in the concurrent test */
+#define CONTENTION_NUM_TASKS 4
+
+/* The amount of time each test runs for, in milliseconds */
+#define CONTENTION_RUN_TIME 1000
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the test may
+ * never get CPU time to stop the workers.
+ */
+#define CONTENTION_TASK_PRIORITY 150
+
+/* Define setup and test functions for UT assert */
+void ContentionSetup(void);
+void ContentionSingleTest(void);
+void ContentionMultiTest(void);
+void ContentionTeardown(void);
+
+osal_id_t     ContentionSemId[CONTENTION_NUM_TASKS];
+osal_id_t     ContentionTaskId[CONTENTION_NUM_TASKS];
+uint32        ContentionWork[CONTENTION_NUM_TASKS];
+volatile bool ContentionStop;
+volatile bool ContentionTaskDone[CONTENTION_NUM_TASKS];
+volatile bool ContentionTaskFailed[CONTENTION_NUM_TASKS];
+double        ContentionSingleRate;
+
+/*
+ * Repeatedly gives and takes the semaphore for this task until told to stop
+ */
+void ContentionWorkerTask(void)
+{
+    OS_task_prop_t task_prop;
+    uint32         id;
+    uint32         work;
+
+    OS_TaskGetInfo(OS_TaskGetId(), &task_prop);
+    id   = task_prop.name[1] - '0';
+    work = 0;
+
+    while (!ContentionStop)
+    {
+        if (OS_CountSemGive(ContentionSemId[id]) != OS_SUCCESS || OS_CountSemTake(ContentionSemId[id]) != OS_SUCCESS)
+        {
+            ContentionTaskFailed[id] = true;
+            break;
+        }
+
+        ++work;
+    }
+
+    ContentionWork[id]     = work;
+    ContentionTaskDone[id] = true;
+}
+
+/*
+ * Runs the given number of worker tasks, and returns the overall cycles per second
+ */
+double ContentionRun(uint32 num_tasks)
+{
+    char      name[OS_MAX_API_NAME];
+    osal_id_t task_id;
+    uint32    total_work;
+    uint32    tasks_done;
+    uint32    i;
+    uint32    j;
+
+    ContentionStop = false;
+
+    for (i = 0; i < num_tasks; ++i)
+    {
+        ContentionWork[i]       = 0;
+        ContentionTaskDone[i]   = false;
+        ContentionTaskFailed[i] = false;
+        snprintf(name, sizeof(name), "W%u", (unsigned int)i);
+
+        /* A task of the same name from the previous run may still be exiting */
+        for (j = 0; j < 100 && OS_TaskGetIdByName(&task_id, name) == OS_SUCCESS; ++j)
+        {
+            OS_TaskDelay(10);
+        }
+
+        UtAssert_INT32_EQ(OS_TaskCreate(&ContentionTaskId[i], name, ContentionWorkerTask, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(16384), OSAL_PRIORITY_C(CONTENTION_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+    }
+
+    OS_TaskDelay(CONTENTION_RUN_TIME);
+    ContentionStop = true;
+
+    for (j = 0; j < 100; ++j)
+    {
+        tasks_done = 0;
+        for (i = 0; i < num_tasks; ++i)
+        {
+            if (ContentionTaskDone[i])
+            {
+                ++tasks_done;
+            }
+        }
+
+        if (tasks_done == num_tasks)
+        {
+            break;
+        }
+
+        OS_TaskDelay(10);
+    }
+
+    UtAssert_UINT32_EQ(tasks_done, num_tasks);
+
+    total_work = 0;
+    for (i = 0; i < num_tasks; ++i)
+    {
+        UtAssert_True(!ContentionTaskFailed[i], "Task %u: no errors", (unsigned int)i);
+        UtAssert_MIR("Task %u: %lu cycles/sec", (unsigned int)i,
+                     (unsigned long)((ContentionWork[i] * 1000.0) / CONTENTION_RUN_TIME));
+        total_work += ContentionWork[i];
+    }
+
+    return (total_work * 1000.0) / CONTENTION_RUN_TIME;
+}
+
+void ContentionSetup(void)
+{
+    char   name[OS_MAX_API_NAME];
+    uint32 i;
+
+    for (i = 0; i < CONTENTION_NUM_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "Sem%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_CountSemCreate(&ContentionSemId[i], name, 0, 0), OS_SUCCESS);
+    }
+}
+
+void ContentionTeardown(void)
+{
+    uint32 i;
+
+    for (i = 0; i < CONTENTION_NUM_TASKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_CountSemDelete(ContentionSemId[i]), OS_SUCCESS);
+    }
+}
+
+void ContentionSingleTest(void)
+{
+    ContentionSingleRate = ContentionRun(1);
+
+    UtAssert_True(ContentionSingleRate > 0, "Single task: %lu cycles/sec", (unsigned long)ContentionSingleRate);
+}
+
+void ContentionMultiTest(void)
+{
+    double rate;
+
+    rate = ContentionRun(CONTENTION_NUM_TASKS);
+
+    UtAssert_True(rate > 0, "%u tasks: %lu cycles/sec total", (unsigned int)CONTENTION_NUM_TASKS,
+                  (unsigned long)rate);
+
+    if (ContentionSingleRate > 0)
+    {
+        /*
+         * With as many CPUs as tasks and no contention, each task would do about
+         * as much work as the single task did.  This is informational only, as the
+         * number of CPUs actually available is not known.
+         */
+        UtAssert_MIR("Work per task relative to single task: %u%% (cache line size %u)",
+                     (unsigned int)((100.0 * rate) / (ContentionSingleRate * CONTENTION_NUM_TASKS)),
+                     (unsigned int)OS_CACHE_LINE_SIZE);
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(ContentionSingleTest, ContentionSetup, ContentionTeardown, "ContentionSingleTest");
+    UtTest_Add(ContentionMultiTest, ContentionSetup, ContentionTeardown, "ContentionMultiTest");
+}
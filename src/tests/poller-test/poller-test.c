@@ -0,0 +1,236 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Poller Test
+**
+** Checks that a poller reports exactly the handles which are ready,
+** using a set of UDP sockets on the loopback interface.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* Number of receive sockets in the poller */
+#define POLLERTEST_NUM_SOCKETS 8
+
+/* First port number, each socket is bound to a consecutive port after this */
+#define POLLERTEST_BASE_PORT 9720
+
+#define UT_TIMEOUT 1000
+
+osal_id_t PollerId;
+osal_id_t SenderId;
+osal_id_t RecvIds[POLLERTEST_NUM_SOCKETS];
+bool      PollerImplemented = true;
+
+void Send_Datagram(uint32 idx)
+{
+    OS_SockAddr_t addr;
+    uint32        data;
+
+    data = idx;
+    UtAssert_INT32_EQ(OS_SocketAddrInit(&addr, OS_SocketDomain_INET), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrFromString(&addr, "127.0.0.1"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrSetPort(&addr, POLLERTEST_BASE_PORT + idx), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketSendTo(SenderId, &data, sizeof(data), &addr), sizeof(data));
+}
+
+void Recv_Datagram(uint32 idx)
+{
+    OS_SockAddr_t addr;
+    uint32        data;
+
+    UtAssert_INT32_EQ(OS_SocketRecvFrom(RecvIds[idx], &data, sizeof(data), &addr, 0), sizeof(data));
+    UtAssert_UINT32_EQ(data, idx);
+}
+
+void TestPollerSetup(void)
+{
+    OS_SockAddr_t addr;
+    int32         status;
+    uint32        i;
+
+    status = OS_PollerCreate(&PollerId, "Poller", 0);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        PollerImplemented = false;
+        return;
+    }
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    status = OS_SocketOpen(&SenderId, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        PollerImplemented = false;
+        return;
+    }
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    for (i = 0; i < POLLERTEST_NUM_SOCKETS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_SocketOpen(&RecvIds[i], OS_SocketDomain_INET, OS_SocketType_DATAGRAM), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrInit(&addr, OS_SocketDomain_INET), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrFromString(&addr, "127.0.0.1"), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrSetPort(&addr, POLLERTEST_BASE_PORT + i), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketBind(RecvIds[i], &addr), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_PollerAdd(PollerId, RecvIds[i], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    }
+}
+
+void TestPollerReady(void)
+{
+    OS_poller_event_t events[POLLERTEST_NUM_SOCKETS];
+    uint32            num_events;
+    uint32            seen;
+    uint32            i;
+    uint32            j;
+
+    if (!PollerImplemented)
+    {
+        UtAssert_NA("Poller API not implemented");
+        return;
+    }
+
+    /* Nothing has been sent, so nothing is ready */
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, 0), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    Send_Datagram(2);
+    Send_Datagram(5);
+
+    /* Only the two sockets which were sent to should be reported */
+    seen = 0;
+    for (i = 0; i < 2 && seen != ((1 << 2) | (1 << 5)); ++i)
+    {
+        UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, UT_TIMEOUT),
+                          OS_SUCCESS);
+        for (j = 0; j < num_events; ++j)
+        {
+            UtAssert_UINT32_EQ(events[j].StateFlags, OS_STREAM_STATE_READABLE);
+            if (OS_ObjectIdEqual(events[j].objid, RecvIds[2]))
+            {
+                seen |= 1 << 2;
+            }
+            else if (OS_ObjectIdEqual(events[j].objid, RecvIds[5]))
+            {
+                seen |= 1 << 5;
+            }
+            else
+            {
+                UtAssert_Failed("Unexpected ID %lu reported ready", OS_ObjectIdToInteger(events[j].objid));
+            }
+        }
+    }
+    UtAssert_UINT32_EQ(seen, (1 << 2) | (1 << 5));
+
+    /* Limiting the output buffer still reports one ready handle */
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, 1, &num_events, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 1);
+
+    /* Once the data is consumed the sockets are no longer ready */
+    Recv_Datagram(2);
+    Recv_Datagram(5);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, 0), OS_ERROR_TIMEOUT);
+}
+
+void TestPollerModify(void)
+{
+    OS_poller_event_t events[POLLERTEST_NUM_SOCKETS];
+    uint32            num_events;
+
+    if (!PollerImplemented)
+    {
+        UtAssert_NA("Poller API not implemented");
+        return;
+    }
+
+    /* A removed socket is no longer reported */
+    UtAssert_INT32_EQ(OS_PollerRemove(PollerId, RecvIds[3]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerRemove(PollerId, RecvIds[3]), OS_ERROR);
+    Send_Datagram(3);
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, 0), OS_ERROR_TIMEOUT);
+
+    /* Adding it back reports the pending data */
+    UtAssert_INT32_EQ(OS_PollerAdd(PollerId, RecvIds[3], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 1);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, RecvIds[3]), "events[0].objid == RecvIds[3]");
+    Recv_Datagram(3);
+
+    /* Adding again changes the states of interest, an idle datagram socket is always writable */
+    UtAssert_INT32_EQ(OS_PollerAdd(PollerId, RecvIds[3], OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 1);
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_WRITABLE);
+    UtAssert_INT32_EQ(OS_PollerAdd(PollerId, RecvIds[3], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    /* A closed socket is removed from the set automatically */
+    Send_Datagram(4);
+    UtAssert_INT32_EQ(OS_close(RecvIds[4]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, POLLERTEST_NUM_SOCKETS, &num_events, 0), OS_ERROR_TIMEOUT);
+
+    /* Error cases */
+    UtAssert_INT32_EQ(OS_PollerAdd(PollerId, RecvIds[4], OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollerAdd(SenderId, RecvIds[0], OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, NULL, 1, &num_events, 0), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollerWait(PollerId, events, 0, &num_events, 0), OS_ERR_INVALID_SIZE);
+}
+
+void TestPollerTeardown(void)
+{
+    uint32 i;
+
+    if (!PollerImplemented)
+    {
+        return;
+    }
+
+    UtAssert_INT32_EQ(OS_PollerDelete(PollerId), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerDelete(PollerId), OS_ERR_INVALID_ID);
+
+    OS_close(SenderId);
+    for (i = 0; i < POLLERTEST_NUM_SOCKETS; ++i)
+    {
+        OS_close(RecvIds[i]);
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_AddSetup(TestPollerSetup, "TestPollerSetup");
+    UtTest_Add(TestPollerReady, NULL, NULL, "TestPollerReady");
+    UtTest_Add(TestPollerModify, NULL, NULL, "TestPollerModify");
+    UtTest_Add(TestPollerTeardown, NULL, NULL, "TestPollerDelete");
+}
@@ -0,0 +1,120 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** OS_printf Speed Test
+**
+** This is a simple way to gauge the cost of OS_printf() to the
+** calling task, in each of the modes that format the message
+** either immediately or later when it is output.
+**
+** The messages are written in small batches, with a delay between
+** batches so the console has time to output them.  Only the time
+** spent in the OS_printf() calls is measured.
+**
+** At the end of each test the average time per call is indicated.
+** Lower numbers indicate better performance.
+**
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* The number of messages written in each batch, and the number of batches */
+#define PRINTF_SPEED_BATCH_SIZE  10
+#define PRINTF_SPEED_NUM_BATCHES 10
+
+/* The delay between batches, to allow the console to output them */
+#define PRINTF_SPEED_BATCH_DELAY 50
+
+/* Define setup and test functions for UT assert */
+void PrintfSpeedImmediate(void);
+void PrintfSpeedDeferred(void);
+void PrintfSpeedTeardown(void);
+
+/*
+ * Writes the messages in the current mode, and reports the average time per call
+ */
+void PrintfSpeedRun(const char *ModeName)
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    OS_time_t total_time;
+    uint32    batch;
+    uint32    i;
+
+    total_time = OS_TimeAssembleFromNanoseconds(0, 0);
+
+    for (batch = 0; batch < PRINTF_SPEED_NUM_BATCHES; ++batch)
+    {
+        OS_GetMonotonicTime(&start_time);
+        for (i = 0; i < PRINTF_SPEED_BATCH_SIZE; ++i)
+        {
+            OS_printf("%s: batch %u message %u, value=%d time=%.3f\n", ModeName, (unsigned int)batch,
+                      (unsigned int)i, -(int)i, (double)OS_TimeGetTotalMilliseconds(start_time) / 1000.0);
+        }
+        OS_GetMonotonicTime(&end_time);
+
+        total_time = OS_TimeAdd(total_time, OS_TimeSubtract(end_time, start_time));
+
+        OS_TaskDelay(PRINTF_SPEED_BATCH_DELAY);
+    }
+
+    UtAssert_MIR("%s mode: %lu ns per OS_printf() call", ModeName,
+                 (unsigned long)(OS_TimeGetTotalNanoseconds(total_time) /
+                                 (PRINTF_SPEED_NUM_BATCHES * PRINTF_SPEED_BATCH_SIZE)));
+}
+
+void PrintfSpeedImmediate(void)
+{
+    UtAssert_INT32_EQ(OS_printf_SetMode(OS_PRINTF_MODE_IMMEDIATE), OS_SUCCESS);
+    PrintfSpeedRun("Immediate");
+}
+
+void PrintfSpeedDeferred(void)
+{
+    UtAssert_INT32_EQ(OS_printf_SetMode(OS_PRINTF_MODE_DEFERRED), OS_SUCCESS);
+    PrintfSpeedRun("Deferred");
+}
+
+void PrintfSpeedTeardown(void)
+{
+    /* Allow the last messages to be output before changing the mode */
+    OS_TaskDelay(PRINTF_SPEED_BATCH_DELAY);
+    UtAssert_INT32_EQ(OS_printf_SetMode(OS_PRINTF_MODE_IMMEDIATE), OS_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(PrintfSpeedImmediate, NULL, PrintfSpeedTeardown, "PrintfSpeedImmediate");
+    UtTest_Add(PrintfSpeedDeferred, NULL, PrintfSpeedTeardown, "PrintfSpeedDeferred");
+}
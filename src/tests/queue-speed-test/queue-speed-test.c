@@ -0,0 +1,217 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Queue Speed Test
+**
+** This is a simple way to gauge how the throughput of the
+** OSAL queue API scales with the number of tasks using it.
+**
+** Each worker task owns a separate queue, and continuously
+** puts a message into it and gets it back out again.  Because
+** no two tasks share a queue, any loss of scaling as tasks are
+** added is due to contention on shared state (e.g. the OSAL
+** object table) rather than the queues themselves.
+**
+** The test is repeated for 1, 2, 4, 8, 16 and 32 tasks, each
+** running for 1 second.  The total number of put/get cycles
+** completed for each step is reported.  Higher numbers
+** indicate better performance.
+**
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the QueueRun()
+ * function may never get CPU time to stop the test.
+ */
+#define QUEUETEST_TASK_PRIORITY 150
+
+/* The maximum number of worker tasks/queues */
+#define QUEUETEST_MAX_TASKS 32
+
+/* The duration of each step of the test, in milliseconds */
+#define QUEUETEST_RUN_TIME 1000
+
+/*
+ * A limit for the maximum amount of iterations that
+ * each task will perform.  This prevents the test
+ * from running infinitely in case the stop flag does
+ * not work correctly.  See note above about priority.
+ */
+#define QUEUETEST_WORK_LIMIT 100000000
+
+/* Define setup and test functions for UT assert */
+void QueueSetup(void);
+void QueueRun(void);
+
+typedef struct
+{
+    osal_id_t task_id;
+    osal_id_t queue_id;
+    uint32    work;
+} QueueTestWorker_t;
+
+QueueTestWorker_t QueueTestWorkers[QUEUETEST_MAX_TASKS];
+volatile bool     QueueTestStop;
+
+void QueueTestWorkerTask(void)
+{
+    QueueTestWorker_t *worker;
+    OS_task_prop_t     task_prop;
+    uint32             i;
+    uint32             data;
+    size_t             size_copied;
+    int32              status;
+
+    /*
+     * The worker number is obtained from the task name, as the
+     * task may start running before OS_TaskCreate() has returned
+     * the task ID to the parent.
+     */
+    status = OS_TaskGetInfo(OS_TaskGetId(), &task_prop);
+    if (status != OS_SUCCESS)
+    {
+        OS_printf("Worker: Error calling OS_TaskGetInfo: %d\n", (int)status);
+        return;
+    }
+
+    i = strtoul(&task_prop.name[1], NULL, 10);
+    if (i >= QUEUETEST_MAX_TASKS)
+    {
+        OS_printf("Worker: Invalid task name %s\n", task_prop.name);
+        return;
+    }
+
+    worker = &QueueTestWorkers[i];
+
+    data = 0;
+    while (!QueueTestStop && worker->work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueuePut(worker->queue_id, &data, sizeof(data), 0);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("Worker %u: Error calling OS_QueuePut: %d\n", (unsigned int)i, (int)status);
+            break;
+        }
+
+        status = OS_QueueGet(worker->queue_id, &data, sizeof(data), &size_copied, OS_PEND);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("Worker %u: Error calling OS_QueueGet: %d\n", (unsigned int)i, (int)status);
+            break;
+        }
+
+        ++data;
+        ++worker->work;
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(QueueRun, QueueSetup, NULL, "QueueSpeedTest");
+}
+
+void QueueSetup(void)
+{
+    uint32 i;
+    char   name[OS_MAX_API_NAME];
+
+    memset(QueueTestWorkers, 0, sizeof(QueueTestWorkers));
+
+    for (i = 0; i < QUEUETEST_MAX_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "Q%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_QueueCreate(&QueueTestWorkers[i].queue_id, name, 4, sizeof(uint32), 0), OS_SUCCESS);
+    }
+}
+
+void QueueRun(void)
+{
+    uint32 num_tasks;
+    uint32 i;
+    uint32 total_work;
+    char   name[OS_MAX_API_NAME];
+
+    for (num_tasks = 1; num_tasks <= QUEUETEST_MAX_TASKS; num_tasks *= 2)
+    {
+        QueueTestStop = false;
+
+        for (i = 0; i < num_tasks; ++i)
+        {
+            QueueTestWorkers[i].work = 0;
+            snprintf(name, sizeof(name), "W%u", (unsigned int)i);
+            UtAssert_INT32_EQ(OS_TaskCreate(&QueueTestWorkers[i].task_id, name, QueueTestWorkerTask,
+                                            OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                                            OSAL_PRIORITY_C(QUEUETEST_TASK_PRIORITY), 0),
+                              OS_SUCCESS);
+        }
+
+        /* Time Limited Execution */
+        OS_TaskDelay(QUEUETEST_RUN_TIME);
+        QueueTestStop = true;
+
+        /* Allow the tasks to see the stop flag and exit on their own */
+        OS_TaskDelay(100);
+
+        total_work = 0;
+        for (i = 0; i < num_tasks; ++i)
+        {
+            /*
+             * NOTE: the task should have exited by itself, in which
+             * case its ID is no longer valid and this is a no-op.
+             */
+            OS_TaskDelete(QueueTestWorkers[i].task_id);
+            total_work += QueueTestWorkers[i].work;
+        }
+
+        /*
+         * NOTE: Not every worker is guaranteed to get CPU time within the run
+         * time when there are more workers than CPUs, so only the total is checked.
+         */
+        UtAssert_True(total_work != 0, "%u tasks total work counter = %u", (unsigned int)num_tasks,
+                      (unsigned int)total_work);
+
+        UtPrintf("%2u tasks: %10u put/get cycles in %u ms (%u per task)", (unsigned int)num_tasks,
+                 (unsigned int)total_work, (unsigned int)QUEUETEST_RUN_TIME, (unsigned int)(total_work / num_tasks));
+    }
+
+    for (i = 0; i < QUEUETEST_MAX_TASKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_QueueDelete(QueueTestWorkers[i].queue_id), OS_SUCCESS);
+    }
+}
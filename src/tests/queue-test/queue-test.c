@@ -29,6 +29,8 @@
 /* Define setup and check functions for UT assert */
 void QueueTimeoutSetup(void);
 void QueueTimeoutCheck(void);
+void QueueDeleteWhilePendingSetup(void);
+void QueueDeleteWhilePendingCheck(void);
 
 #define MSGQ_DEPTH 50
 #define MSGQ_SIZE  sizeof(uint32)
@@ -48,6 +50,8 @@ uint32    task_1_timeouts;
 uint32    task_1_messages;
 uint32    task_2_stack[TASK_2_STACK_SIZE];
 osal_id_t task_2_id;
+int32     task_2_status;
+bool      task_2_done;
 osal_id_t msgq_id;
 
 uint32    timer_counter;
@@ -100,6 +104,19 @@ void task_1(void)
     }
 }
 
+void task_2(void)
+{
+    int32  status;
+    uint32 data_received;
+    size_t data_size;
+
+    /* Pend forever, only deleting the queue will end this */
+    status = OS_QueueGet(msgq_id, (void *)&data_received, OSAL_SIZE_C(MSGQ_SIZE), &data_size, OS_PEND);
+
+    task_2_status = status;
+    task_2_done   = true;
+}
+
 void QueueTimeoutCheck(void)
 {
     int32  status;
@@ -237,6 +254,59 @@ void QueueMessageSetup(void)
     }
 }
 
+void QueueDeleteWhilePendingCheck(void)
+{
+    int32  status;
+    uint32 Data;
+    uint32 i;
+
+    status = OS_QueueDelete(msgq_id);
+    if (status == OS_ERR_OBJECT_IN_USE)
+    {
+        /* The queue is not a user-space queue here, so the pending task could not be woken */
+        UtAssert_MIR("Queue delete while a task is pending is not supported Rc=%d", (int)status);
+
+        Data   = 0;
+        status = OS_QueuePut(msgq_id, (void *)&Data, sizeof(Data), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS Queue Put Rc=%d", (int)status);
+        for (i = 0; i < 100 && !task_2_done; i++)
+        {
+            OS_TaskDelay(10);
+        }
+        status = OS_QueueDelete(msgq_id);
+        UtAssert_True(status == OS_SUCCESS, "Queue delete Rc=%d", (int)status);
+        return;
+    }
+
+    UtAssert_True(status == OS_SUCCESS, "Queue delete while pending Rc=%d", (int)status);
+
+    for (i = 0; i < 100 && !task_2_done; i++)
+    {
+        OS_TaskDelay(10);
+    }
+    UtAssert_True(task_2_done, "Task 2 returned from OS_QueueGet()");
+    UtAssert_True(task_2_status == OS_ERR_INVALID_ID, "Task 2 get Rc=%d", (int)task_2_status);
+}
+
+void QueueDeleteWhilePendingSetup(void)
+{
+    int32 status;
+
+    task_2_done   = false;
+    task_2_status = OS_SUCCESS;
+
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE),
+                            OS_QUEUE_FLAG_USERSPACE);
+    UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
+
+    status = OS_TaskCreate(&task_2_id, "Task 2", task_2, OSAL_STACKPTR_C(task_2_stack), sizeof(task_2_stack),
+                           OSAL_PRIORITY_C(TASK_2_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+
+    /* Give task 2 time to block on the empty queue */
+    OS_TaskDelay(500);
+}
+
 void UtTest_Setup(void)
 {
     if (OS_API_Init() != OS_SUCCESS)
@@ -252,4 +322,5 @@ void UtTest_Setup(void)
      */
     UtTest_Add(QueueTimeoutCheck, QueueTimeoutSetup, NULL, "QueueTimeoutTest");
     UtTest_Add(QueueMessageCheck, QueueMessageSetup, NULL, "QueueMessageCheck");
+    UtTest_Add(QueueDeleteWhilePendingCheck, QueueDeleteWhilePendingSetup, NULL, "QueueDeleteWhilePending");
 }
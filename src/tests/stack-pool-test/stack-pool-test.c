@@ -0,0 +1,197 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Stack Pool Test
+**
+** Checks that OSAL-allocated task stacks report a peak stack usage
+** via OS_TaskGetInfo(), and that stacks are recycled when tasks
+** are repeatedly created and deleted, or exit by themselves.
+**
+** The size of the stack pool is set by OSAL_CONFIG_TASK_STACK_POOL_KB.
+** If the pool is not used, stack usage is not tracked and the checks
+** on it are reported as not applicable.  The standalone CI build runs
+** this test with the pool enabled as well.
+**
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+/* The stack size passed to OS_TaskCreate() */
+#define STACKPOOL_TEST_STACK_SIZE 32768
+
+/* The amount of stack that the worker task uses on purpose */
+#define STACKPOOL_TEST_STACK_USAGE 16384
+
+/* Number of times the worker task is restarted */
+#define STACKPOOL_TEST_RESTARTS 100
+
+#define STACKPOOL_TEST_TASK_PRIORITY 150
+
+/* Define setup and test functions for UT assert */
+void StackPoolHighWaterTest(void);
+void StackPoolRecycleTest(void);
+
+osal_id_t       StackPoolTaskId;
+osal_id_t       StackPoolSemId;
+volatile uint32 StackPoolTaskCount;
+volatile uint8 *StackPoolTaskBuffer;
+
+/*
+ * Uses a large part of the stack, then pends on a semaphore
+ * so the parent can query the task while it is still running.
+ */
+void StackPoolWorkerTask(void)
+{
+    volatile uint8 buffer[STACKPOOL_TEST_STACK_USAGE];
+
+    memset((void *)buffer, 0, sizeof(buffer));
+    StackPoolTaskBuffer = buffer;
+    ++StackPoolTaskCount;
+
+    OS_BinSemTake(StackPoolSemId);
+}
+
+/*
+ * Exits immediately, so its stack is released via the self-exit path
+ */
+void StackPoolExitTask(void)
+{
+    ++StackPoolTaskCount;
+}
+
+void StackPoolHighWaterTest(void)
+{
+    OS_task_prop_t task_prop;
+    uint32         i;
+
+    StackPoolTaskCount = 0;
+    UtAssert_INT32_EQ(OS_TaskCreate(&StackPoolTaskId, "Worker", StackPoolWorkerTask, OSAL_TASK_STACK_ALLOCATE,
+                                    OSAL_SIZE_C(STACKPOOL_TEST_STACK_SIZE),
+                                    OSAL_PRIORITY_C(STACKPOOL_TEST_TASK_PRIORITY), 0),
+                      OS_SUCCESS);
+
+    for (i = 0; i < 100 && StackPoolTaskCount == 0; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+    UtAssert_UINT32_EQ(StackPoolTaskCount, 1);
+
+    UtAssert_INT32_EQ(OS_TaskGetInfo(StackPoolTaskId, &task_prop), OS_SUCCESS);
+    if (task_prop.stack_high_water == 0)
+    {
+        UtAssert_NA("Stack usage not tracked by this implementation");
+    }
+    else
+    {
+        UtAssert_True(task_prop.stack_high_water >= STACKPOOL_TEST_STACK_USAGE,
+                      "Stack high water mark (%lu) >= %lu", (unsigned long)task_prop.stack_high_water,
+                      (unsigned long)STACKPOOL_TEST_STACK_USAGE);
+        UtPrintf("Stack high water mark: %lu bytes", (unsigned long)task_prop.stack_high_water);
+    }
+
+    UtAssert_INT32_EQ(OS_TaskDelete(StackPoolTaskId), OS_SUCCESS);
+}
+
+void StackPoolRecycleTest(void)
+{
+    OS_task_prop_t task_prop;
+    uint32         i;
+    uint32         j;
+    uint32         tracked;
+
+    /*
+     * Alternate between tasks that are deleted and tasks that exit by themselves.
+     * The number of restarts is much more than the number of stacks that fit in
+     * the pool, so unless stacks are recycled the later tasks would not get a
+     * stack from the pool, and would not report their stack usage.
+     */
+    tracked = 0;
+    for (i = 0; i < STACKPOOL_TEST_RESTARTS; ++i)
+    {
+        StackPoolTaskCount = 0;
+        UtAssert_INT32_EQ(OS_TaskCreate(&StackPoolTaskId, "Worker", StackPoolWorkerTask, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(STACKPOOL_TEST_STACK_SIZE),
+                                        OSAL_PRIORITY_C(STACKPOOL_TEST_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+
+        for (j = 0; j < 100 && StackPoolTaskCount == 0; ++j)
+        {
+            OS_TaskDelay(1);
+        }
+
+        UtAssert_INT32_EQ(OS_TaskGetInfo(StackPoolTaskId, &task_prop), OS_SUCCESS);
+        if (task_prop.stack_high_water >= STACKPOOL_TEST_STACK_USAGE)
+        {
+            ++tracked;
+        }
+
+        UtAssert_INT32_EQ(OS_TaskDelete(StackPoolTaskId), OS_SUCCESS);
+
+        UtAssert_INT32_EQ(OS_TaskCreate(&StackPoolTaskId, "Exit", StackPoolExitTask, OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(STACKPOOL_TEST_STACK_SIZE),
+                                        OSAL_PRIORITY_C(STACKPOOL_TEST_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+
+        for (j = 0; j < 100 && StackPoolTaskCount < 2; ++j)
+        {
+            OS_TaskDelay(1);
+        }
+        UtAssert_UINT32_EQ(StackPoolTaskCount, 2);
+
+        /* allow the task to finish exiting */
+        OS_TaskDelay(1);
+    }
+
+    if (tracked == 0)
+    {
+        UtAssert_NA("Stack usage not tracked by this implementation");
+    }
+    else
+    {
+        UtAssert_UINT32_EQ(tracked, STACKPOOL_TEST_RESTARTS);
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    if (OS_BinSemCreate(&StackPoolSemId, "Sem", 0, 0) != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_BinSemCreate() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(StackPoolHighWaterTest, NULL, NULL, "StackPoolHighWaterTest");
+    UtTest_Add(StackPoolRecycleTest, NULL, NULL, "StackPoolRecycleTest");
+}
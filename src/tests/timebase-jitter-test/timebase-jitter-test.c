@@ -0,0 +1,221 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Time Base Jitter Test
+**
+** This is a simple way to gauge the timing quality of the simulated
+** time base tick provided by the OSAL implementation (i.e. a time base
+** created without an external sync function).
+**
+** A timer callback is attached to a time base running at a fixed
+** interval, and the local time is sampled at each callback.  The
+** spacing between consecutive callbacks is compared against the
+** nominal interval, and the minimum, maximum and mean spacing as
+** well as the mean absolute deviation are reported.  Lower deviation
+** indicates better performance.
+**
+** The free run counter of the time base is also compared against the
+** elapsed time, which shows whether ticks that were delayed past the
+** next interval were accounted for or lost.
+**
+** On POSIX, the tick is generated by either a timerfd or a POSIX timer
+** delivering an RT signal, depending on OSAL_CONFIG_TIMEBASE_TIMERFD.
+** Running this test in both configurations compares the two methods.
+**
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+/* The nominal interval of the time base, in microseconds */
+#define JITTERTEST_INTERVAL 1000
+
+/* The number of callback time samples to collect */
+#define JITTERTEST_SAMPLES 2000
+
+/* Define setup and test functions for UT assert */
+void JitterSetup(void);
+void JitterRun(void);
+
+osal_id_t       JitterTimeBaseId;
+osal_id_t       JitterTimerId;
+OS_time_t       JitterSamples[JITTERTEST_SAMPLES];
+volatile uint32 JitterSampleCount;
+
+void JitterTimerCallback(osal_id_t object_id, void *arg)
+{
+    if (JitterSampleCount < JITTERTEST_SAMPLES)
+    {
+        OS_GetLocalTime(&JitterSamples[JitterSampleCount]);
+        ++JitterSampleCount;
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(JitterRun, JitterSetup, NULL, "TimeBaseJitterTest");
+}
+
+void JitterSetup(void)
+{
+    JitterSampleCount = 0;
+    memset(JitterSamples, 0, sizeof(JitterSamples));
+
+    UtAssert_INT32_EQ(OS_TimeBaseCreate(&JitterTimeBaseId, "JitterTB", NULL), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimerAdd(&JitterTimerId, "JitterTimer", JitterTimeBaseId, JitterTimerCallback, NULL),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimerSet(JitterTimerId, JITTERTEST_INTERVAL, JITTERTEST_INTERVAL), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeBaseSet(JitterTimeBaseId, JITTERTEST_INTERVAL, JITTERTEST_INTERVAL), OS_SUCCESS);
+}
+
+void JitterRun(void)
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    uint32    start_freerun;
+    uint32    end_freerun;
+    uint32    i;
+    uint32    count;
+    int64     delta;
+    int64     delta_min;
+    int64     delta_max;
+    int64     delta_sum;
+    int64     deviation_sum;
+    int64     elapsed_ticks;
+    int32     status;
+
+    OS_timer_stats_t timer_stats;
+    OS_timer_stats_t timebase_stats;
+
+    /*
+     * Time base ticks are counted from the first sample, as the first
+     * interval after OS_TimerSet() includes the setup latency.
+     */
+    for (i = 0; i < 100 && JitterSampleCount == 0; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+
+    UtAssert_INT32_EQ(OS_TimeBaseGetFreeRun(JitterTimeBaseId, &start_freerun), OS_SUCCESS);
+    OS_GetLocalTime(&start_time);
+
+    /* Time Limited Execution, with some margin for scheduling delays */
+    for (i = 0; i < 10 && JitterSampleCount < JITTERTEST_SAMPLES; ++i)
+    {
+        OS_TaskDelay(((JITTERTEST_SAMPLES * JITTERTEST_INTERVAL) / 1000) / 4);
+    }
+
+    UtAssert_INT32_EQ(OS_TimeBaseGetFreeRun(JitterTimeBaseId, &end_freerun), OS_SUCCESS);
+    OS_GetLocalTime(&end_time);
+
+    /* The latency statistics are optional, depending on OSAL_CONFIG_TIMER_STATS */
+    status = OS_TimerGetStats(JitterTimerId, &timer_stats);
+    if (status != OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_INT32_EQ(status, OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_TimeBaseGetStats(JitterTimeBaseId, &timebase_stats), OS_SUCCESS);
+        UtAssert_True(timer_stats.event_count >= JitterSampleCount, "Timer event count %u >= %u samples",
+                      (unsigned int)timer_stats.event_count, (unsigned int)JitterSampleCount);
+    }
+
+    UtAssert_INT32_EQ(OS_TimerDelete(JitterTimerId), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeBaseDelete(JitterTimeBaseId), OS_SUCCESS);
+
+    count = JitterSampleCount;
+    UtAssert_True(count > 1, "Collected %u samples", (unsigned int)count);
+    if (count < 2)
+    {
+        return;
+    }
+
+    delta_min     = INT64_MAX;
+    delta_max     = INT64_MIN;
+    delta_sum     = 0;
+    deviation_sum = 0;
+    for (i = 1; i < count; ++i)
+    {
+        delta = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(JitterSamples[i], JitterSamples[i - 1]));
+        if (delta < delta_min)
+        {
+            delta_min = delta;
+        }
+        if (delta > delta_max)
+        {
+            delta_max = delta;
+        }
+        delta_sum += delta;
+        if (delta > JITTERTEST_INTERVAL)
+        {
+            deviation_sum += delta - JITTERTEST_INTERVAL;
+        }
+        else
+        {
+            deviation_sum += JITTERTEST_INTERVAL - delta;
+        }
+    }
+
+    UtPrintf("%u callbacks at %u usec interval:", (unsigned int)count, (unsigned int)JITTERTEST_INTERVAL);
+    UtPrintf("  spacing min/mean/max = %ld/%ld/%ld usec", (long)delta_min, (long)(delta_sum / (count - 1)),
+             (long)delta_max);
+    UtPrintf("  mean absolute deviation = %ld usec", (long)(deviation_sum / (count - 1)));
+
+    /*
+     * If the implementation reports every tick that occurred, the free run
+     * counter advances at the same rate as the clock.  Ticks which were
+     * dropped (e.g. coalesced signals) show up as a difference here.
+     */
+    elapsed_ticks = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time)) / JITTERTEST_INTERVAL;
+    UtPrintf("  free run advanced %lu ticks in %ld ticks of elapsed time",
+             (unsigned long)((end_freerun - start_freerun) / JITTERTEST_INTERVAL), (long)elapsed_ticks);
+
+    if (status == OS_SUCCESS)
+    {
+        UtPrintf("  timer latency min/mean/max = %u/%u/%u usec, %u overruns", (unsigned int)timer_stats.latency_min,
+                 (unsigned int)timer_stats.latency_mean, (unsigned int)timer_stats.latency_max,
+                 (unsigned int)timer_stats.overrun_count);
+        UtPrintf("  time base latency min/mean/max = %u/%u/%u usec, %u overruns, max exec time %u usec",
+                 (unsigned int)timebase_stats.latency_min, (unsigned int)timebase_stats.latency_mean,
+                 (unsigned int)timebase_stats.latency_max, (unsigned int)timebase_stats.overrun_count,
+                 (unsigned int)timebase_stats.exec_time_max);
+        for (i = 0; i < OS_TIMER_STATS_HISTOGRAM_BINS; ++i)
+        {
+            if (timer_stats.latency_histogram[i] != 0)
+            {
+                UtPrintf("    latency < %8lu usec: %u", (unsigned long)1 << i,
+                         (unsigned int)timer_stats.latency_histogram[i]);
+            }
+        }
+    }
+}
@@ -41,6 +41,9 @@
 /* Buffer size */
 #define UT_BUFFER_SIZE 16
 
+/* Number of messages for batch tests, larger than a single OS batch */
+#define UT_MSG_COUNT 20
+
 /* OS_SelectSingle_Impl hook to set SelectFlags per input */
 static int32 UT_Hook_OS_SelectSingle_Impl(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                           const UT_StubContext_t *Context)
@@ -353,6 +356,136 @@ void Test_OS_SocketSendTo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo_Impl, (&token, buffer, sizeof(buffer), &addr), OS_SUCCESS);
 }
 
+void Test_OS_SocketRecvFromMulti_Impl(void)
+{
+    OS_object_token_t token = {0};
+    uint8             buffer[UT_MSG_COUNT];
+    OS_SockMsg_t      msgs[UT_MSG_COUNT];
+    int32             selectflags;
+    uint32            i;
+
+    /* Set up token */
+    token.obj_idx = UT_INDEX_0;
+
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < UT_MSG_COUNT; ++i)
+    {
+        msgs[i].Buffer = &buffer[i];
+        msgs[i].BufLen = 1;
+    }
+
+    /* Selectable, fail OS_SelectSingle_Impl */
+    OS_impl_filehandle_table[0].selectable = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, UT_ERR_UNIQUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), UT_ERR_UNIQUE);
+
+    /* Timeout by clearing select flags with hook */
+    selectflags = 0;
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, &selectflags);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), OS_ERROR_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+
+    /* Not selectable, 0 timeout, EAGAIN error on the first datagram */
+    OS_impl_filehandle_table[0].selectable = false;
+    OCS_errno                              = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), OS_QUEUE_EMPTY);
+
+    /* With timeout, EWOULDBLOCK error on the first datagram */
+    OCS_errno = OCS_EWOULDBLOCK;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_TimeToRelativeMilliseconds), 1, OS_PEND);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MAX), OS_QUEUE_EMPTY);
+
+    /* Other error on the first datagram */
+    OCS_errno = 0;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), OS_ERROR);
+
+    /* Error after the first datagram returns the partial count */
+    OCS_errno = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 2, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), 1);
+
+    /* Success, all datagrams across multiple batches */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_recvfrom), 1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, UT_MSG_COUNT, OS_TIME_MIN), UT_MSG_COUNT);
+    UtAssert_UINT32_EQ(msgs[UT_MSG_COUNT - 1].MsgLen, 1);
+}
+
+void Test_OS_SocketSendToMulti_Impl(void)
+{
+    OS_object_token_t    token = {0};
+    uint8                buffer[UT_MSG_COUNT];
+    OS_SockMsg_t         msgs[UT_MSG_COUNT];
+    struct OCS_sockaddr *sa;
+    uint32               i;
+
+    /* Set up token */
+    token.obj_idx = UT_INDEX_0;
+
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < UT_MSG_COUNT; ++i)
+    {
+        sa                        = (struct OCS_sockaddr *)&msgs[i].Addr.AddrData;
+        sa->sa_family             = OCS_AF_INET;
+        msgs[i].Buffer            = &buffer[i];
+        msgs[i].BufLen            = 1;
+        msgs[i].Addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    }
+
+    /* Bad address length on one entry, nothing sent */
+    msgs[1].Addr.ActualLength = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, UT_MSG_COUNT), OS_ERR_BAD_ADDRESS);
+    UtAssert_STUB_COUNT(OCS_sendto, 0);
+    msgs[1].Addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+
+    /* Failed sendto on the first datagram */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, UT_MSG_COUNT), OS_ERROR);
+
+    /* Failed sendto after the first datagram returns the partial count */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 2, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, UT_MSG_COUNT), 1);
+
+    /* Success, all datagrams across multiple batches */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_sendto), 1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, UT_MSG_COUNT), UT_MSG_COUNT);
+    UtAssert_UINT32_EQ(msgs[UT_MSG_COUNT - 1].MsgLen, 1);
+}
+
+void Test_OS_SocketSendV_Impl(void)
+{
+    OS_object_token_t    token      = {0};
+    uint8                hdr[4]     = {0};
+    uint8                payload[8] = {0};
+    OS_iovec_t           iov[2];
+    OS_SockAddr_t        addr = {0};
+    struct OCS_sockaddr *sa   = (struct OCS_sockaddr *)&addr.AddrData;
+
+    /* Set up token */
+    token.obj_idx = UT_INDEX_0;
+
+    iov[0].Buffer = hdr;
+    iov[0].Length = sizeof(hdr);
+    iov[1].Buffer = payload;
+    iov[1].Length = sizeof(payload);
+
+    /* Bad address length */
+    sa->sa_family     = -1;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendV_Impl, (&token, iov, 2, &addr), OS_ERR_BAD_ADDRESS);
+
+    /* AF_INET, failed sendmsg */
+    sa->sa_family = OCS_AF_INET;
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendmsg), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendV_Impl, (&token, iov, 2, &addr), OS_ERROR);
+
+    /* Success */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendmsg), 1, sizeof(hdr) + sizeof(payload));
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendV_Impl, (&token, iov, 2, &addr), sizeof(hdr) + sizeof(payload));
+}
+
 void Test_OS_SocketGetInfo_Impl(void)
 {
     OSAPI_TEST_FUNCTION_RC(OS_SocketGetInfo_Impl, (NULL, NULL), OS_SUCCESS);
@@ -504,6 +637,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketAccept_Impl);
     ADD_TEST(OS_SocketRecvFrom_Impl);
     ADD_TEST(OS_SocketSendTo_Impl);
+    ADD_TEST(OS_SocketRecvFromMulti_Impl);
+    ADD_TEST(OS_SocketSendToMulti_Impl);
+    ADD_TEST(OS_SocketSendV_Impl);
     ADD_TEST(OS_SocketGetInfo_Impl);
     ADD_TEST(OS_SocketAddrInit_Impl);
     ADD_TEST(OS_SocketAddrToString_Impl);
@@ -26,38 +26,190 @@
 #include "os-portable-coveragetest.h"
 #include "os-shared-printf.h"
 #include "os-shared-idmap.h"
+#include "os-shared-common.h"
+#include "os-shared-console.h"
 
 #include "OCS_stdio.h"
 #include "OCS_bsp-impl.h"
 
-#define TEST_BUFFER_LEN 16
+/* Sets up a complete record in the test buffer, returns the offset of the next record */
+static size_t UT_ConsoleSetupRecord(atomic_uint *Buffer, size_t Pos, const char *Str)
+{
+    size_t DataLen = strlen(Str);
+
+    memcpy((char *)Buffer + Pos + OS_CONSOLE_REC_ALIGN, Str, DataLen);
+    Buffer[Pos / OS_CONSOLE_REC_ALIGN] = OS_CONSOLE_REC_COMPLETE | DataLen;
+
+    return Pos + OS_CONSOLE_REC_SIZE(DataLen);
+}
+
+/* Sets up a deferred record in the test buffer, returns the offset of the next record */
+static size_t UT_ConsoleSetupDeferred(atomic_uint *Buffer, size_t Pos, const char *Format, uint64 Word, const char *Str)
+{
+    OS_console_deferred_t Msg;
+    size_t                DataLen;
+
+    memset(&Msg, 0, sizeof(Msg));
+    Msg.Timestamp.ticks = 1234;
+    Msg.Format          = Format;
+    Msg.NumWords        = 1;
+    Msg.StrSize         = strlen(Str) + 1;
+    Msg.Words[0]        = Word;
+    DataLen             = offsetof(OS_console_deferred_t, Words) + sizeof(uint64);
+
+    memcpy((char *)Buffer + Pos + OS_CONSOLE_REC_ALIGN, &Msg, DataLen);
+    memcpy((char *)Buffer + Pos + OS_CONSOLE_REC_ALIGN + DataLen, Str, Msg.StrSize);
+    DataLen += Msg.StrSize;
+    Buffer[Pos / OS_CONSOLE_REC_ALIGN] = OS_CONSOLE_REC_COMPLETE | OS_CONSOLE_REC_DEFERRED | DataLen;
+
+    return Pos + OS_CONSOLE_REC_SIZE(DataLen);
+}
 
-const char TEST_BUF_INITIALIZER[1 + TEST_BUFFER_LEN] = "abcdefghijklmnop";
+static void UT_FormatDeferredHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    char * Buffer = UT_Hook_GetArgValueByName(Context, "Buffer", char *);
+    size_t Len    = 3;
+
+    memcpy(Buffer, "fmt", Len);
+    UT_Stub_SetReturnValue(FuncKey, Len);
+}
 
 void Test_OS_ConsoleOutput_Impl(void)
 {
-    char              TestConsoleBspBuffer[TEST_BUFFER_LEN];
+    atomic_uint       TestConsoleBspBuffer[16];
     char              TestOutputBuffer[32];
     OS_object_token_t token;
+    size_t            Pos;
+    size_t            i;
 
     memset(&token, 0, sizeof(token));
 
-    memcpy(TestConsoleBspBuffer, TEST_BUF_INITIALIZER, sizeof(TestConsoleBspBuffer));
+    memset(TestConsoleBspBuffer, 0, sizeof(TestConsoleBspBuffer));
     memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
 
-    OS_console_table[0].BufBase = TestConsoleBspBuffer;
+    OS_console_table[0].BufBase = (char *)TestConsoleBspBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
 
-    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutputV_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
+
+    /* Nothing to output */
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputV_Impl, 0);
+
+    /* Two records, output in one call, and cleared afterward */
+    Pos                          = UT_ConsoleSetupRecord(TestConsoleBspBuffer, 0, "abcd");
+    Pos                          = UT_ConsoleSetupRecord(TestConsoleBspBuffer, Pos, "ef");
+    OS_console_table[0].WritePos = Pos;
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdef", 6);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputV_Impl, 1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 16);
+    UtAssert_ZERO(TestConsoleBspBuffer[0]);
+    UtAssert_ZERO(TestConsoleBspBuffer[2]);
+
+    /* A complete record, then one that is still being written */
+    Pos                          = UT_ConsoleSetupRecord(TestConsoleBspBuffer, 16, "gh");
+    OS_console_table[0].WritePos = Pos + 8;
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdefgh", 8);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, Pos);
 
-    OS_console_table[0].WritePos = 4;
+    /* Complete the record, then wrap around via a skip record at the end */
+    UT_ConsoleSetupRecord(TestConsoleBspBuffer, Pos, "ijk");
+    TestConsoleBspBuffer[8]      = OS_CONSOLE_REC_SKIP;
+    OS_console_table[0].WritePos = UT_ConsoleSetupRecord(TestConsoleBspBuffer, 0, "lm");
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdefghijklm", 13);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 8);
+    UtAssert_ZERO(TestConsoleBspBuffer[8]);
+    UtAssert_ZERO(TestConsoleBspBuffer[0]);
+
+    /* More records than can be output in one call */
+    Pos = 8;
+    for (i = 0; i < 6; ++i)
+    {
+        Pos = UT_ConsoleSetupRecord(TestConsoleBspBuffer, Pos, "n");
+    }
+    OS_console_table[0].WritePos = Pos;
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcd") == 0, "TestOutputBuffer (%s) == abcd", TestOutputBuffer);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdefghijklmnnnnnn", 19);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputV_Impl, 5);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, Pos);
+}
+
+void Test_OS_ConsoleOutput_Impl_Deferred(void)
+{
+    atomic_uint             TestConsoleBspBuffer[64];
+    char                    TestOutputBuffer[256];
+    OS_object_token_t       token;
+    OS_console_binary_hdr_t FrameHdr;
+    size_t                  Pos;
+    size_t                  FramePos;
+
+    memset(&token, 0, sizeof(token));
 
-    OS_console_table[0].WritePos = 2;
+    memset(TestConsoleBspBuffer, 0, sizeof(TestConsoleBspBuffer));
+    memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
+
+    OS_console_table[0].BufBase = (char *)TestConsoleBspBuffer;
+    OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
+
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutputV_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
+    UT_SetHandlerFunction(UT_KEY(OS_Console_FormatDeferred), UT_FormatDeferredHandler, NULL);
+
+    /* Deferred records are formatted when output, others are output as-is */
+    OS_SharedGlobalVars.PrintfMode = OS_PRINTF_MODE_DEFERRED;
+    Pos                            = UT_ConsoleSetupRecord(TestConsoleBspBuffer, 0, "ab");
+    Pos                            = UT_ConsoleSetupDeferred(TestConsoleBspBuffer, Pos, "%d%s", 5, "s");
+    OS_console_table[0].WritePos   = Pos;
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abfmt", 5);
+    UtAssert_STUB_COUNT(OS_Console_FormatDeferred, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputV_Impl, 1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, Pos);
+
+    /*
+     * In binary mode each record is output as a frame, one per call because of the segment limit,
+     * and the frames go to the binary output rather than the console
+     */
+    UT_ResetState(UT_KEY(OCS_OS_BSP_ConsoleOutputV_Impl));
+    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleBinaryOutputV_Impl), TestOutputBuffer, sizeof(TestOutputBuffer),
+                     false);
+    memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
+    OS_SharedGlobalVars.PrintfMode = OS_PRINTF_MODE_BINARY;
+    OS_console_table[0].ReadPos    = 0;
+    Pos                            = UT_ConsoleSetupRecord(TestConsoleBspBuffer, 0, "ab");
+    Pos                            = UT_ConsoleSetupDeferred(TestConsoleBspBuffer, Pos, "%d%s", 5, "s");
+    OS_console_table[0].WritePos   = Pos;
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcdefghijklmnopab") == 0, "TestOutputBuffer (%s) == abcdefghijklmnopab",
-                  TestOutputBuffer);
+    UtAssert_STUB_COUNT(OS_Console_FormatDeferred, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleBinaryOutputV_Impl, 2);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutputV_Impl, 0);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, Pos);
+
+    memcpy(&FrameHdr, TestOutputBuffer, sizeof(FrameHdr));
+    UtAssert_UINT32_EQ(FrameHdr.Magic, OS_CONSOLE_BINARY_MAGIC);
+    UtAssert_UINT32_EQ(FrameHdr.Type, OS_CONSOLE_BINARY_TEXT);
+    UtAssert_UINT32_EQ(FrameHdr.FrameLen, sizeof(FrameHdr) + 2);
+    UtAssert_UINT32_EQ(FrameHdr.StrSize, 2);
+    UtAssert_ZERO(FrameHdr.FormatLen);
+    UtAssert_ZERO(FrameHdr.NumWords);
+    UtAssert_STRINGBUF_EQ(&TestOutputBuffer[sizeof(FrameHdr)], 2, "ab", 2);
+
+    FramePos = FrameHdr.FrameLen;
+    memcpy(&FrameHdr, &TestOutputBuffer[FramePos], sizeof(FrameHdr));
+    UtAssert_UINT32_EQ(FrameHdr.Magic, OS_CONSOLE_BINARY_MAGIC);
+    UtAssert_UINT32_EQ(FrameHdr.Type, OS_CONSOLE_BINARY_DEFERRED);
+    UtAssert_UINT32_EQ(FrameHdr.FrameLen, sizeof(FrameHdr) + 4 + sizeof(uint64) + 2);
+    UtAssert_UINT32_EQ(FrameHdr.FormatLen, 4);
+    UtAssert_UINT32_EQ(FrameHdr.NumWords, 1);
+    UtAssert_UINT32_EQ(FrameHdr.StrSize, 2);
+    UtAssert_INT32_EQ(FrameHdr.Timestamp, 1234);
+    UtAssert_UINT32_EQ(FrameHdr.TicksPerSecond, OS_TIME_TICKS_PER_SECOND);
+    FramePos += sizeof(FrameHdr);
+    UtAssert_STRINGBUF_EQ(&TestOutputBuffer[FramePos], 4, "%d%s", 4);
+    FramePos += 4 + sizeof(uint64);
+    UtAssert_STRINGBUF_EQ(&TestOutputBuffer[FramePos], 2, "s", 2);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
@@ -71,6 +223,7 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
+    memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
 }
 
 /*
@@ -89,4 +242,5 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleOutput_Impl);
+    ADD_TEST(OS_ConsoleOutput_Impl_Deferred);
 }
@@ -0,0 +1,99 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-mempool.h"
+
+void Test_OS_MemPoolCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_MemPoolCreate_Impl(const OS_object_token_t *token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate_Impl, (UT_INDEX_0), OS_SUCCESS);
+}
+
+void Test_OS_MemPoolDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_MemPoolDelete_Impl(const OS_object_token_t *token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolDelete_Impl, (UT_INDEX_0), OS_SUCCESS);
+}
+
+void Test_OS_MemPoolWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_MemPoolWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_timeout)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolWait_Impl, (UT_INDEX_0, NULL), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_MemPoolWake_Impl(void)
+{
+    /* Test Case For:
+     * void OS_MemPoolWake_Impl(const OS_object_token_t *token)
+     */
+    UtAssert_VOIDCALL(OS_MemPoolWake_Impl(UT_INDEX_0));
+}
+
+void Test_OS_MemPoolGetCpu_Impl(void)
+{
+    /* Test Case For:
+     * uint32 OS_MemPoolGetCpu_Impl(void)
+     */
+    UtAssert_ZERO(OS_MemPoolGetCpu_Impl());
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_MemPoolCreate_Impl);
+    ADD_TEST(OS_MemPoolDelete_Impl);
+    ADD_TEST(OS_MemPoolWait_Impl);
+    ADD_TEST(OS_MemPoolWake_Impl);
+    ADD_TEST(OS_MemPoolGetCpu_Impl);
+}
@@ -0,0 +1,105 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-poller.h"
+
+void Test_OS_PollerCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate_Impl, (UT_INDEX_0, 0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollerDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete_Impl, (UT_INDEX_0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollerAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (NULL, NULL, OS_STREAM_STATE_READABLE), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollerRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (NULL, NULL), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollerWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+     *                          uint32 *num_events, OS_time_t abs_timeout)
+     */
+    OS_poller_event_t events[1];
+    uint32            num_events;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (UT_INDEX_0, events, 1, &num_events, OS_TIME_MAX),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollerCreate_Impl);
+    ADD_TEST(OS_PollerDelete_Impl);
+    ADD_TEST(OS_PollerAdd_Impl);
+    ADD_TEST(OS_PollerRemove_Impl);
+    ADD_TEST(OS_PollerWait_Impl);
+}
@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-queue.h"
+
+void Test_OS_QueuePutMulti_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *data, size_t stride,
+     *                             const size_t *sizes, uint32 count, uint32 *count_put, uint32 flags)
+     */
+    char   data[4] = {0};
+    size_t sizes[1];
+    uint32 count;
+
+    sizes[0] = sizeof(data);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti_Impl, (UT_INDEX_0, data, sizeof(data), sizes, 1, &count, 0),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueGetMulti_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t stride, size_t *sizes,
+     *                             uint32 count, uint32 *count_copied, int32 timeout)
+     */
+    char   data[4];
+    size_t sizes[1];
+    uint32 count;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti_Impl, (UT_INDEX_0, data, sizeof(data), sizes, 1, &count, OS_PEND),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_QueuePutMulti_Impl);
+    ADD_TEST(OS_QueueGetMulti_Impl);
+}
@@ -0,0 +1,111 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-queue.h"
+
+void Test_OS_QueueReserve_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data)
+     */
+    void *data;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve_Impl, (UT_INDEX_0, &data), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueCommit_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data, size_t size)
+     */
+    char data[4] = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit_Impl, (UT_INDEX_0, data, sizeof(data)), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueCancel_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueCancel_Impl(const OS_object_token_t *token, void *data)
+     */
+    char data[4] = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel_Impl, (UT_INDEX_0, data), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueBorrow_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **data, size_t *size, int32 timeout)
+     */
+    const void *data;
+    size_t      size;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow_Impl, (UT_INDEX_0, &data, &size, OS_PEND), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueReturn_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueReturn_Impl(const OS_object_token_t *token, const void *data)
+     */
+    char data[4] = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn_Impl, (UT_INDEX_0, data), OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_QueueReserve_Impl);
+    ADD_TEST(OS_QueueCommit_Impl);
+    ADD_TEST(OS_QueueCancel_Impl);
+    ADD_TEST(OS_QueueBorrow_Impl);
+    ADD_TEST(OS_QueueReturn_Impl);
+}
@@ -41,6 +41,20 @@ void Test_OS_GetLocalTime_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_GetLocalTime_Impl, (&timeval), OS_ERROR);
 }
 
+void Test_OS_GetMonotonicTime_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+     */
+    OS_time_t timeval = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime_Impl, (&timeval), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_clock_gettime), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime_Impl, (&timeval), OS_ERROR);
+}
+
 void Test_OS_SetLocalTime_Impl(void)
 {
     /*
@@ -85,5 +99,6 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_GetLocalTime_Impl);
+    ADD_TEST(OS_GetMonotonicTime_Impl);
     ADD_TEST(OS_SetLocalTime_Impl);
 }
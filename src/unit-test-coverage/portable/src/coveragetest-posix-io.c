@@ -34,6 +34,7 @@
 #include "OCS_unistd.h"
 #include "OCS_fcntl.h"
 #include "OCS_errno.h"
+#include "OCS_sys_uio.h"
 
 /* OS_SelectSingle_Impl hook to clear SelectFlags */
 static int32 UT_Hook_OS_SelectSingle_Impl(void *UserObj, int32 StubRetcode, uint32 CallCount,
@@ -183,6 +184,143 @@ void Test_OS_GenericWrite_Impl(void)
     UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
 }
 
+void Test_OS_GenericPread_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    char              SrcData[]                 = "ABCDEFGHIJKL";
+    char              DestData[sizeof(SrcData)] = {0};
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    UT_SetDataBuffer(UT_KEY(OCS_pread), SrcData, sizeof(SrcData), false);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 1000), sizeof(DestData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "pread() data valid");
+
+    /* select() is never needed */
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* pread() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pread), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 1000), OS_ERROR);
+}
+
+void Test_OS_GenericPwrite_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes,
+     *                             osal_offset_t offset)
+     */
+    char              SrcData[]                 = "ABCDEFGHIJKL";
+    char              DestData[sizeof(SrcData)] = {0};
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    UT_SetDataBuffer(UT_KEY(OCS_pwrite), DestData, sizeof(DestData), false);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 1000), sizeof(SrcData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "pwrite() data valid");
+
+    /* select() is never needed */
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* pwrite() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pwrite), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 1000), OS_ERROR);
+}
+
+void Test_OS_GenericReadv_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+     *                            OS_time_t abs_timeout)
+     */
+    char              Hdr[4];
+    char              Payload[8];
+    OS_iovec_t        Iov[2];
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    Iov[0].Buffer = Hdr;
+    Iov[0].Length = sizeof(Hdr);
+    Iov[1].Buffer = Payload;
+    Iov[1].Length = sizeof(Payload);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_readv), sizeof(Hdr) + sizeof(Payload));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Hdr) + sizeof(Payload));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* test invocation of select() in nonblocking mode */
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Hdr) + sizeof(Payload));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 1);
+
+    /* readv() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_readv), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR);
+
+    /* Fail select */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR_TIMEOUT);
+
+    /* Not readable */
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericReadv_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_SUCCESS);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+}
+
+void Test_OS_GenericWritev_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt,
+     *                             OS_time_t abs_timeout)
+     */
+    char              Hdr[4]     = "HDR";
+    char              Payload[8] = "PAYLOAD";
+    OS_iovec_t        Iov[2];
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    Iov[0].Buffer = Hdr;
+    Iov[0].Length = sizeof(Hdr);
+    Iov[1].Buffer = Payload;
+    Iov[1].Length = sizeof(Payload);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_writev), sizeof(Hdr) + sizeof(Payload));
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Hdr) + sizeof(Payload));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* test invocation of select() in nonblocking mode */
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), sizeof(Hdr) + sizeof(Payload));
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 1);
+
+    /* writev() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_writev), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR);
+
+    /* Fail select */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_ERROR_TIMEOUT);
+
+    /* Not writeable */
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericWritev_Impl, (&token, Iov, 2, OS_TIME_MIN), OS_SUCCESS);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -218,4 +356,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GenericSeek_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_GenericPread_Impl);
+    ADD_TEST(OS_GenericPwrite_Impl);
+    ADD_TEST(OS_GenericReadv_Impl);
+    ADD_TEST(OS_GenericWritev_Impl);
 }
@@ -59,6 +59,18 @@ void Test_OS_SetLocalTime(void)
     UtAssert_True(actual == expected, "OS_SetLocalTime() (%ld) == OS_INVALID_POINTER", (long)actual);
 }
 
+void Test_OS_GetMonotonicTime(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+     */
+    OS_time_t time_struct;
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime(&time_struct), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_GetMonotonicTime(NULL), OS_INVALID_POINTER);
+}
+
 void Test_OS_TimeAccessConversions(void)
 {
     /*
@@ -221,6 +233,7 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_GetLocalTime);
     ADD_TEST(OS_SetLocalTime);
+    ADD_TEST(OS_GetMonotonicTime);
     ADD_TEST(OS_TimeAccessConversions);
     ADD_TEST(OS_TimeFromRelativeMilliseconds);
     ADD_TEST(OS_TimeToRelativeMilliseconds);
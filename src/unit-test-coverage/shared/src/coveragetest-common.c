@@ -220,6 +220,12 @@ void Test_OS_CleanUpObject(void)
             case OS_OBJECT_TYPE_OS_DIR:
                 delhandler = UT_KEY(OS_DirectoryClose);
                 break;
+            case OS_OBJECT_TYPE_OS_POLLER:
+                delhandler = UT_KEY(OS_PollerDelete);
+                break;
+            case OS_OBJECT_TYPE_OS_MEMPOOL:
+                delhandler = UT_KEY(OS_MemPoolDelete);
+                break;
             default:
                 delhandler = 0;
                 break;
@@ -89,7 +89,18 @@ void Test_OS_close(void)
      * Test Case For:
      * int32 OS_close (uint32 filedes)
      */
+    uint8 MapBuf[4];
+
+    OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncClose_Impl, 1);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 0);
+
+    /* Mappings still in place are removed */
+    OS_stream_table[1].mappings[1].base = MapBuf;
+    OS_stream_table[1].mappings[1].addr = MapBuf;
     OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 1);
+    UtAssert_NULL(OS_stream_table[1].mappings[1].base);
 
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_ERR_INVALID_ID);
@@ -179,6 +190,272 @@ void Test_OS_write(void)
     UtAssert_True(memcmp(Buf, DstBuf, actual) == 0, "buffer content match");
 }
 
+void Test_OS_pread(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    char Buf[4];
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericPread_Impl), 1, sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 1000), sizeof(Buf));
+
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, NULL, sizeof(Buf), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, 0, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), -1), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_pwrite(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+     */
+    char Buf[4] = "BUF";
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericPwrite_Impl), 1, sizeof(Buf));
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 1000), sizeof(Buf));
+
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, NULL, sizeof(Buf), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, 0, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), -1), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_FileMap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t len, uint32 access, void **addr)
+     */
+    void * addr;
+    uint8  MapBuf[4];
+    uint32 i;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ | OS_FILE_MAP_SEQUENTIAL, &addr),
+                           OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileMap_Impl, 1);
+    UtAssert_BOOL_FALSE(OS_stream_table[1].mappings[0].busy);
+    UtAssert_STUB_COUNT(OS_Lock_Global, 2);
+    UtAssert_STUB_COUNT(OS_Unlock_Global, 2);
+
+    /* Implementation failure leaves the slot free */
+    UT_SetDeferredRetcode(UT_KEY(OS_FileMap_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_WRITE, &addr), OS_ERROR);
+    UtAssert_NULL(OS_stream_table[1].mappings[0].base);
+    UtAssert_BOOL_FALSE(OS_stream_table[1].mappings[0].busy);
+
+    /* All slots in use, or claimed by a call in progress */
+    OS_stream_table[1].mappings[0].busy = true;
+    for (i = 1; i < OS_MAX_FILE_MAPPINGS; ++i)
+    {
+        OS_stream_table[1].mappings[i].base = MapBuf;
+    }
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ, &addr), OS_ERR_NO_FREE_IDS);
+    memset(OS_stream_table[1].mappings, 0, sizeof(OS_stream_table[1].mappings));
+
+    /* Sockets cannot be mapped */
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INET;
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ, &addr), OS_ERR_INCORRECT_OBJ_TYPE);
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INVALID;
+
+    UtAssert_STUB_COUNT(OS_FileMap_Impl, 2);
+
+    /* Argument checks */
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 0, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, -1, 4, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_WILLNEED, &addr), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ | 0x80000000, &addr),
+                           OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, 4, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_FileUnmap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileUnmap(osal_id_t filedes, void *addr)
+     */
+    uint8 MapBuf[8];
+
+    /* Not a mapping of this file */
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, MapBuf), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 0);
+
+    OS_stream_table[1].mappings[2].base = MapBuf;
+    OS_stream_table[1].mappings[2].addr = &MapBuf[4];
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, MapBuf), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, &MapBuf[4]), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 1);
+    UtAssert_NULL(OS_stream_table[1].mappings[2].base);
+    UtAssert_BOOL_FALSE(OS_stream_table[1].mappings[2].busy);
+
+    /* A mapping already being removed by another call is not matched */
+    OS_stream_table[1].mappings[2].base = MapBuf;
+    OS_stream_table[1].mappings[2].addr = MapBuf;
+    OS_stream_table[1].mappings[2].busy = true;
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, MapBuf), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 1);
+    OS_stream_table[1].mappings[2].busy = false;
+
+    /* The mapping is forgotten even if the implementation fails */
+    OS_stream_table[1].mappings[2].base = MapBuf;
+    OS_stream_table[1].mappings[2].addr = MapBuf;
+    UT_SetDeferredRetcode(UT_KEY(OS_FileUnmap_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, MapBuf), OS_ERROR);
+    UtAssert_NULL(OS_stream_table[1].mappings[2].base);
+    UtAssert_STUB_COUNT(OS_Lock_Global, UT_GetStubCount(UT_KEY(OS_Unlock_Global)));
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1, MapBuf), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_AsyncReadSubmit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_AsyncReadSubmit(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset,
+     *                          void *user_arg)
+     */
+    char Buf[4];
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncSubmit_Impl, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncSubmit_Impl), 1, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_QUEUE_FULL);
+
+    /* Sockets are not supported */
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INET;
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_ERR_INCORRECT_OBJ_TYPE);
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INVALID;
+    UtAssert_STUB_COUNT(OS_AsyncSubmit_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, NULL, sizeof(Buf), 8, Buf), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, 0, 8, Buf), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, sizeof(Buf), -1, Buf), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncReadSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_AsyncWriteSubmit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_AsyncWriteSubmit(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset,
+     *                           void *user_arg)
+     */
+    char Buf[4] = "www";
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWriteSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncSubmit_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWriteSubmit(UT_OBJID_1, NULL, sizeof(Buf), 8, Buf), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWriteSubmit(UT_OBJID_1, Buf, 0, 8, Buf), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWriteSubmit(UT_OBJID_1, Buf, sizeof(Buf), -1, Buf), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWriteSubmit(UT_OBJID_1, Buf, sizeof(Buf), 8, Buf), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_AsyncWaitCompletion(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_AsyncWaitCompletion(osal_id_t filedes, OS_async_completion_t *completion, int32 msecs)
+     */
+    OS_async_completion_t completion;
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWaitCompletion(UT_OBJID_1, &completion, OS_PEND), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWaitCompletion_Impl, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWaitCompletion_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWaitCompletion(UT_OBJID_1, &completion, 10), OS_ERROR_TIMEOUT);
+
+    /* Sockets are not supported */
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INET;
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWaitCompletion(UT_OBJID_1, &completion, OS_CHECK), OS_ERR_INCORRECT_OBJ_TYPE);
+    OS_stream_table[1].socket_domain = OS_SocketDomain_INVALID;
+    UtAssert_STUB_COUNT(OS_AsyncWaitCompletion_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWaitCompletion(UT_OBJID_1, NULL, OS_PEND), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWaitCompletion(UT_OBJID_1, &completion, OS_PEND), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_readv(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+     */
+    char       Hdr[2];
+    char       Payload[4];
+    OS_iovec_t Iov[2];
+
+    Iov[0].Buffer = Hdr;
+    Iov[0].Length = sizeof(Hdr);
+    Iov[1].Buffer = Payload;
+    Iov[1].Length = sizeof(Payload);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericReadv_Impl), 1, 6);
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, 2), 6);
+
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, NULL, 2), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, OS_IOV_MAX + 1), OS_ERR_INVALID_SIZE);
+
+    Iov[1].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, 2), OS_INVALID_POINTER);
+    Iov[1].Buffer = Payload;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_readv(UT_OBJID_1, Iov, 2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_writev(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+     */
+    char       Hdr[2]     = "H";
+    char       Payload[4] = "PPP";
+    OS_iovec_t Iov[2];
+
+    Iov[0].Buffer = Hdr;
+    Iov[0].Length = sizeof(Hdr);
+    Iov[1].Buffer = Payload;
+    Iov[1].Length = sizeof(Payload);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericWritev_Impl), 1, 6);
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, 2), 6);
+
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, NULL, 2), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, OS_IOV_MAX + 1), OS_ERR_INVALID_SIZE);
+
+    Iov[1].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, 2), OS_INVALID_POINTER);
+    Iov[1].Buffer = Payload;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_writev(UT_OBJID_1, Iov, 2), OS_ERR_INVALID_ID);
+}
+
 void Test_OS_chmod(void)
 {
     /*
@@ -250,6 +527,24 @@ void Test_OS_rename(void)
     OSAPI_TEST_FUNCTION_RC(OS_rename("/cf/file1", "/cf/file2"), OS_ERROR);
 }
 
+/*
+ * Handler for OS_FileCopyRange_Impl which reports the number of bytes
+ * given in the user object as copied, on success
+ */
+static void UT_Handler_OS_FileCopyRange_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_offset_t *copied = UT_Hook_GetArgValueByName(Context, "copied", osal_offset_t *);
+    int32          status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status == OS_SUCCESS)
+    {
+        *copied = *((osal_offset_t *)UserObj);
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 void Test_OS_cp(void)
 {
     /*
@@ -262,7 +557,17 @@ void Test_OS_cp(void)
     OSAPI_TEST_FUNCTION_RC(OS_cp(NULL, "/cf/file2"), OS_INVALID_POINTER);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", NULL), OS_INVALID_POINTER);
 
+    /* nominal, where the implementation copies the whole file */
+    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileCopyRange_Impl, 1);
+    UtAssert_STUB_COUNT(OS_GenericRead_Impl, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_FileCopyRange_Impl), 1, -333);
+    OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), -333);
+    UtAssert_STUB_COUNT(OS_GenericRead_Impl, 0);
+
     /* setup to make internal copy loop execute at least once */
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileCopyRange_Impl), OS_ERR_NOT_IMPLEMENTED);
     UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
     UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), OS_SUCCESS);
@@ -278,6 +583,46 @@ void Test_OS_cp(void)
     OSAPI_TEST_FUNCTION_RC(OS_cp("/cf/file1", "/cf/file2"), -666);
 }
 
+void Test_OS_FileCopyRange(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopyRange(osal_id_t src_fd, osal_offset_t src_off, osal_id_t dst_fd, osal_offset_t dst_off,
+     *                        osal_offset_t len)
+     */
+    osal_offset_t copied;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, -1, UT_OBJID_2, 0, 10), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, -1, 10), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, -1), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_FileCopyRange_Impl, 0);
+
+    /* nominal, the whole range is copied */
+    copied = 10;
+    UT_SetHandlerFunction(UT_KEY(OS_FileCopyRange_Impl), UT_Handler_OS_FileCopyRange_Impl, &copied);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 100, UT_OBJID_2, 200, 10), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileCopyRange_Impl, 1);
+
+    /* zero length is OK */
+    copied = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, 0), OS_SUCCESS);
+
+    /* source ends before the end of the range */
+    copied = 5;
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, 10), OS_ERR_INVALID_SIZE);
+
+    /* error from the implementation is passed through */
+    UT_SetDeferredRetcode(UT_KEY(OS_FileCopyRange_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, 10), OS_ERROR);
+
+    /* either ID not valid */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, 10), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, 0, UT_OBJID_2, 0, 10), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_FileCopyRange_Impl, 4);
+}
+
 void Test_OS_mv(void)
 {
     /*
@@ -411,12 +756,22 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimedWrite);
     ADD_TEST(OS_read);
     ADD_TEST(OS_write);
+    ADD_TEST(OS_pread);
+    ADD_TEST(OS_pwrite);
+    ADD_TEST(OS_FileMap);
+    ADD_TEST(OS_FileUnmap);
+    ADD_TEST(OS_AsyncReadSubmit);
+    ADD_TEST(OS_AsyncWriteSubmit);
+    ADD_TEST(OS_AsyncWaitCompletion);
+    ADD_TEST(OS_readv);
+    ADD_TEST(OS_writev);
     ADD_TEST(OS_chmod);
     ADD_TEST(OS_stat);
     ADD_TEST(OS_lseek);
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
+    ADD_TEST(OS_FileCopyRange);
     ADD_TEST(OS_mv);
     ADD_TEST(OS_FDGetInfo);
     ADD_TEST(OS_FileOpenCheck);
@@ -403,6 +403,22 @@ void Test_OS_GetFsInfo(void)
     UtAssert_True(!OS_FileSysFilterFree(NULL, NULL, &rec), "!OS_FileSysFilterFree() (used record)");
 }
 
+/*
+ * Fills the mount point table with nested mount points /cf and /cf/apps
+ */
+static void Test_FileSys_SetupMountTable(void)
+{
+    OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[1].virtual_mountpt, "/cf");
+    strcpy(OS_filesys_table[1].system_mountpt, "/mnt/cf");
+    OS_filesys_table[2].flags = OS_filesys_table[1].flags;
+    strcpy(OS_filesys_table[2].virtual_mountpt, "/cf/apps");
+    strcpy(OS_filesys_table[2].system_mountpt, "/mnt/apps");
+
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_FILESYS, 1, 2);
+    OS_FileSys_UpdateMountTable();
+}
+
 void Test_OS_TranslatePath(void)
 {
     /*
@@ -472,6 +488,160 @@ void Test_OS_TranslatePath(void)
     expected                  = OS_ERR_INCORRECT_OBJ_STATE;
     actual                    = OS_TranslatePath("/cf/test", LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
+
+    /* Paths under a mount point in the mount point table are translated without a search */
+    UT_ResetState(0);
+    Test_FileSys_SetupMountTable();
+    memset(LocalBuffer, 0, sizeof(LocalBuffer));
+    OSAPI_TEST_FUNCTION_RC(OS_TranslatePath("/cf/test", LocalBuffer), OS_SUCCESS);
+    UtAssert_StrCmp(LocalBuffer, "/mnt/cf/test", "OS_TranslatePath(/cf/test) (%s) == /mnt/cf/test", LocalBuffer);
+    OSAPI_TEST_FUNCTION_RC(OS_TranslatePath("/cf/apps/test", LocalBuffer), OS_SUCCESS);
+    UtAssert_StrCmp(LocalBuffer, "/mnt/apps/test", "OS_TranslatePath(/cf/apps/test) (%s) == /mnt/apps/test",
+                    LocalBuffer);
+    OSAPI_TEST_FUNCTION_RC(OS_TranslatePath("/cf/apps", LocalBuffer), OS_SUCCESS);
+    UtAssert_StrCmp(LocalBuffer, "/mnt/apps", "OS_TranslatePath(/cf/apps) (%s) == /mnt/apps", LocalBuffer);
+    UtAssert_STUB_COUNT(OS_ObjectIdGetBySearch, 0);
+
+    /* Other paths are still searched for under the lock */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetBySearch), OS_ERR_NAME_NOT_FOUND);
+    OSAPI_TEST_FUNCTION_RC(OS_TranslatePath("/cfx/test", LocalBuffer), OS_FS_ERR_PATH_INVALID);
+    UtAssert_STUB_COUNT(OS_ObjectIdGetBySearch, 1);
+}
+
+/*
+ * Changes the generation of the mount point table, as if
+ * it was rebuilt while OS_TranslatePath() was reading it.
+ */
+static int32 Test_FileSys_MountTableChangeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                               const UT_StubContext_t *Context)
+{
+    uint32 *changes = UserObj;
+
+    if (*changes > 0)
+    {
+        --(*changes);
+        atomic_fetch_add(&OS_filesys_mount_table.generation, 2);
+    }
+
+    return StubRetcode;
+}
+
+void Test_OS_FileSys_LookupMountTable(void)
+{
+    /*
+     * Test Case For:
+     * bool OS_FileSys_LookupMountTable(const char *VirtualPath, size_t VirtPathLen, char *LocalPath,
+     *                                  size_t *VirtPathBegin, size_t *SysMountPointLen)
+     */
+    char   LocalBuffer[OS_MAX_LOCAL_PATH_LEN];
+    size_t VirtPathBegin;
+    size_t SysMountPointLen;
+    uint32 changes;
+    uint32 slot;
+
+    Test_FileSys_SetupMountTable();
+
+    UtAssert_True(OS_FileSys_LookupMountTable("/cf/apps/x", 10, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "OS_FileSys_LookupMountTable(/cf/apps/x) (nominal)");
+    UtAssert_UINT32_EQ(VirtPathBegin, 8);
+    UtAssert_UINT32_EQ(SysMountPointLen, 9);
+
+    /* Not a match at a directory separator */
+    UtAssert_True(!OS_FileSys_LookupMountTable("/cfx", 4, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/cfx)");
+    UtAssert_True(!OS_FileSys_LookupMountTable("/", 1, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/)");
+
+    /* A change in the table while it is being read causes a retry */
+    changes = 1;
+    UT_ResetState(UT_KEY(OCS_memcpy));
+    UT_SetHookFunction(UT_KEY(OCS_memcpy), Test_FileSys_MountTableChangeHook, &changes);
+    UtAssert_True(OS_FileSys_LookupMountTable("/cf/x", 5, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "OS_FileSys_LookupMountTable(/cf/x) (retry)");
+    UtAssert_STUB_COUNT(OCS_memcpy, 2);
+
+    /* Too many changes gives up */
+    changes = OS_FILESYS_MOUNT_LOOKUP_ATTEMPTS;
+    UtAssert_True(!OS_FileSys_LookupMountTable("/cf/x", 5, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/cf/x) (changing)");
+    UT_ResetState(UT_KEY(OCS_memcpy));
+
+    /* Table being rebuilt */
+    atomic_fetch_add(&OS_filesys_mount_table.generation, 1);
+    UtAssert_True(!OS_FileSys_LookupMountTable("/cf/x", 5, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/cf/x) (rebuilding)");
+    atomic_fetch_add(&OS_filesys_mount_table.generation, 1);
+
+    /* Probing is limited even if the index is corrupted by a concurrent change */
+    memset(OS_filesys_mount_table.index, 0xFF, sizeof(OS_filesys_mount_table.index));
+    UtAssert_True(!OS_FileSys_LookupMountTable("/cf/x", 5, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/cf/x) (bad entry)");
+    OS_filesys_mount_table.entries[0].hash = 0;
+    for (slot = 0; slot < OS_FILESYS_MOUNT_HASH_SIZE; ++slot)
+    {
+        OS_filesys_mount_table.index[slot] = 1;
+    }
+    UtAssert_True(!OS_FileSys_LookupMountTable("/cf/x", 5, LocalBuffer, &VirtPathBegin, &SysMountPointLen),
+                  "!OS_FileSys_LookupMountTable(/cf/x) (full index)");
+}
+
+void Test_OS_FileSys_UpdateMountTable(void)
+{
+    /*
+     * Test Case For:
+     * void OS_FileSys_UpdateMountTable(void)
+     */
+    char   LocalBuffer[OS_MAX_LOCAL_PATH_LEN];
+    uint32 slot;
+    uint32 used_slots;
+
+    /* The table is invalidated if it can not be locked, and stays so on a second failure */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdIterateActive), OS_ERROR);
+    OS_FileSys_UpdateMountTable();
+    UtAssert_UINT32_EQ(atomic_load(&OS_filesys_mount_table.generation), 1);
+    OS_FileSys_UpdateMountTable();
+    UtAssert_UINT32_EQ(atomic_load(&OS_filesys_mount_table.generation), 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdIteratorDestroy, 0);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdIterateActive));
+
+    /*
+     * Entries 1 and 2 share a mount point, entry 3 has no mount point,
+     * the system mount point of entry 4 does not fit and entry 5 is not mounted
+     */
+    OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    OS_filesys_table[2].flags = OS_filesys_table[1].flags;
+    OS_filesys_table[3].flags = OS_filesys_table[1].flags;
+    OS_filesys_table[4].flags = OS_filesys_table[1].flags;
+    OS_filesys_table[5].flags = OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[5].virtual_mountpt, "/other");
+    strcpy(OS_filesys_table[5].system_mountpt, "/mnt/other");
+    strcpy(OS_filesys_table[1].virtual_mountpt, "/cf");
+    strcpy(OS_filesys_table[1].system_mountpt, "/mnt/cf");
+    strcpy(OS_filesys_table[2].virtual_mountpt, "/cf");
+    strcpy(OS_filesys_table[2].system_mountpt, "/mnt/other");
+    strcpy(OS_filesys_table[4].virtual_mountpt, "/big");
+    memset(OS_filesys_table[4].system_mountpt, 'x', sizeof(OS_filesys_table[4].system_mountpt));
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_FILESYS, 1, 5);
+
+    OS_FileSys_UpdateMountTable();
+    UtAssert_UINT32_EQ(atomic_load(&OS_filesys_mount_table.generation), 2);
+    UtAssert_STUB_COUNT(OS_ObjectIdIteratorDestroy, 1);
+
+    used_slots = 0;
+    for (slot = 0; slot < OS_FILESYS_MOUNT_HASH_SIZE; ++slot)
+    {
+        if (OS_filesys_mount_table.index[slot] != 0)
+        {
+            ++used_slots;
+        }
+    }
+    UtAssert_UINT32_EQ(used_slots, 2);
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.entries[0].system_len, 7);
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.entries[1].system_len, 10);
+
+    /* The first of the file systems sharing a mount point is used */
+    UtAssert_INT32_EQ(OS_TranslatePath("/cf/file", LocalBuffer), OS_SUCCESS);
+    UtAssert_StrCmp(LocalBuffer, "/mnt/cf/file", "OS_TranslatePath(/cf/file) (%s) == /mnt/cf/file", LocalBuffer);
 }
 
 void Test_OS_FileSys_FindVirtMountPoint(void)
@@ -543,6 +713,7 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(&OS_filesys_mount_table, 0, sizeof(OS_filesys_mount_table));
 }
 
 /*
@@ -570,5 +741,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GetFsInfo);
     ADD_TEST(OS_TranslatePath);
     ADD_TEST(OS_FileSys_FindVirtMountPoint);
+    ADD_TEST(OS_FileSys_LookupMountTable);
+    ADD_TEST(OS_FileSys_UpdateMountTable);
     ADD_TEST(OS_FileSysStatVolume);
 }
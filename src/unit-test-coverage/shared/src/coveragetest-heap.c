@@ -24,6 +24,135 @@
  */
 #include "os-shared-coveragetest.h"
 #include "os-shared-heap.h"
+#include "os-shared-task.h"
+
+#include "OCS_stdlib.h"
+
+/* Memory for the emulated malloc() to hand out */
+static uint8 UT_HeapPool[32768];
+
+void Test_OS_HeapAlloc(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_HeapAlloc(void **ptr, size_t size)
+     */
+    UT_idbuf_t idbuf;
+    void *     ptr;
+    void *     ptr2;
+    size_t     bytes;
+
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(NULL, 10), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 0), OS_ERR_INVALID_SIZE);
+
+    /* Sizes that would overflow when the header is added */
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, SIZE_MAX), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, SIZE_MAX - sizeof(OS_heap_block_hdr_t) + 1), OS_ERR_INVALID_SIZE);
+    UtAssert_STUB_COUNT(OCS_malloc, 0);
+
+    /* Not called from a task - nothing is cached or charged */
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 10), OS_SUCCESS);
+    UtAssert_NOT_NULL(ptr);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+    UtAssert_ZERO(OS_heap_task_cache_table[1].free_count[0]);
+
+    /* Called from a task - the size is rounded up to the class size and charged to the task */
+    idbuf.val = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId_Impl), idbuf.val);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 100), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_UINT32_EQ(bytes, 128);
+
+    /* The freed block is cached and handed out again */
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_ZERO(bytes);
+    UtAssert_UINT32_EQ(OS_heap_task_cache_table[1].free_count[2], 1);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr2, 65), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(ptr2, ptr);
+    UtAssert_ZERO(OS_heap_task_cache_table[1].free_count[2]);
+
+    /* Large blocks are charged at their actual size */
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, OS_HEAP_MAX_CLASS_SIZE + 1), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_UINT32_EQ(bytes, 128 + OS_HEAP_MAX_CLASS_SIZE + 1);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+
+    /* A new task in the same slot starts from zero, and frees of the old task's blocks are not charged to it */
+    idbuf.val = 0x10001;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId_Impl), idbuf.val);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 32), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr2), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_UINT32_EQ(bytes, 32);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+
+    /* The count saturates rather than spilling into the owner, and does not go below zero */
+    OS_heap_task_cache_table[1].usage = ((uint_least64_t)idbuf.val << 32) | (OS_HEAP_USAGE_BYTES_MAX - 1);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 32), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_UINT32_EQ(bytes, OS_HEAP_USAGE_BYTES_MAX);
+    OS_heap_task_cache_table[1].usage = ((uint_least64_t)idbuf.val << 32) | 1;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(idbuf.id, &bytes), OS_SUCCESS);
+    UtAssert_ZERO(bytes);
+
+    /* Failure of the system allocator */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_malloc), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 1000), OS_ERROR);
+}
+
+void Test_OS_HeapFree(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_HeapFree(void *ptr)
+     */
+    UT_idbuf_t idbuf;
+    void *     ptr;
+
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(NULL), OS_INVALID_POINTER);
+
+    /* The cache depth is limited, any excess goes back to the system */
+    idbuf.val = 2;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId_Impl), idbuf.val);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 1), OS_SUCCESS);
+    OS_heap_task_cache_table[2].free_count[0] = OS_HEAP_CACHE_DEPTH;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_heap_task_cache_table[2].free_count[0], OS_HEAP_CACHE_DEPTH);
+    UtAssert_NULL(OS_heap_task_cache_table[2].free_list[0]);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* A block from a task may be freed by a non-task thread */
+    OS_heap_task_cache_table[2].free_count[0] = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapAlloc(&ptr, 1), OS_SUCCESS);
+    UT_ResetState(UT_KEY(OS_TaskGetId_Impl));
+    OSAPI_TEST_FUNCTION_RC(OS_HeapFree(ptr), OS_SUCCESS);
+    UtAssert_ZERO(OS_heap_task_cache_table[2].free_count[0]);
+    UtAssert_STUB_COUNT(OCS_free, 2);
+}
+
+void Test_OS_HeapGetTaskUsage(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_HeapGetTaskUsage(osal_id_t task_id, size_t *bytes)
+     */
+    size_t bytes;
+
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(OS_OBJECT_ID_UNDEFINED, &bytes), OS_ERR_INVALID_ID);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(UT_OBJID_1, &bytes), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(UT_OBJID_MAX, &bytes), OS_ERR_INVALID_ID);
+
+    /* A task that has not allocated anything */
+    bytes = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetTaskUsage(UT_OBJID_1, &bytes), OS_SUCCESS);
+    UtAssert_ZERO(bytes);
+}
 
 void Test_OS_HeapGetInfo(void)
 {
@@ -33,7 +162,10 @@ void Test_OS_HeapGetInfo(void)
      */
     OS_heap_prop_t heap_prop;
     int32          expected = OS_SUCCESS;
-    int32          actual   = OS_HeapGetInfo(&heap_prop);
+    int32          actual;
+
+    memset(&heap_prop, 0, sizeof(heap_prop));
+    actual = OS_HeapGetInfo(&heap_prop);
 
     UtAssert_True(actual == expected, "OS_HeapGetInfo() (%ld) == OS_SUCCESS", (long)actual);
 
@@ -41,6 +173,25 @@ void Test_OS_HeapGetInfo(void)
     actual   = OS_HeapGetInfo(NULL);
 
     UtAssert_True(actual == expected, "OS_HeapGetInfo() (%ld) == OS_INVALID_POINTER", (long)actual);
+
+    /* Blocks in the task caches are added to the system heap info */
+    OS_heap_task_cache_table[0].free_count[0] = 2;
+    OS_heap_task_cache_table[3].free_count[1] = 1;
+    heap_prop.free_bytes                      = 1000;
+    heap_prop.free_blocks                     = 10;
+    heap_prop.largest_free_block              = 40;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetInfo(&heap_prop), OS_SUCCESS);
+    UtAssert_UINT32_EQ(heap_prop.free_bytes, 1000 + (2 * 32) + 64);
+    UtAssert_UINT32_EQ(heap_prop.free_blocks, 13);
+    UtAssert_UINT32_EQ(heap_prop.largest_free_block, 64);
+
+    /* An unknown largest free block stays unknown */
+    heap_prop.largest_free_block = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetInfo(&heap_prop), OS_SUCCESS);
+    UtAssert_ZERO(heap_prop.largest_free_block);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_HeapGetInfo_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_HeapGetInfo(&heap_prop), OS_ERR_NOT_IMPLEMENTED);
 }
 
 /* Osapi_Test_Setup
@@ -51,6 +202,8 @@ void Test_OS_HeapGetInfo(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
+    memset(OS_heap_task_cache_table, 0, sizeof(OS_heap_task_cache_table));
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), UT_HeapPool, sizeof(UT_HeapPool), false);
 }
 
 /*
@@ -66,5 +219,8 @@ void Osapi_Test_Teardown(void) {}
  */
 void UtTest_Setup(void)
 {
+    ADD_TEST(OS_HeapAlloc);
+    ADD_TEST(OS_HeapFree);
+    ADD_TEST(OS_HeapGetTaskUsage);
     ADD_TEST(OS_HeapGetInfo);
 }
@@ -23,6 +23,7 @@
  *
  */
 #include "os-shared-coveragetest.h"
+#include "os-shared-clock.h"
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
 #include "os-shared-task.h"
@@ -52,6 +53,23 @@ void UT_Handler_OS_TaskGetId_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT
     UT_Stub_SetReturnValue(FuncKey, objid);
 }
 
+/*
+ * Simulates another task changing the record while waiting, for as many times as
+ * indicated by the counter passed as the user object
+ */
+static void UT_Handler_OS_WaitForStateChange_Impl(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    atomic_uint *state_word = UT_Hook_GetArgValueByName(Context, "state_word", atomic_uint *);
+    uint32 *     changes    = UserObj;
+
+    if (*changes > 0)
+    {
+        --(*changes);
+        atomic_fetch_add(state_word, OS_OBJECT_STATE_SEQ_INCR);
+    }
+}
+
 static void ObjTypeCounter(osal_id_t object_id, void *arg)
 {
     Test_OS_ObjTypeCount_t *count = arg;
@@ -155,6 +173,107 @@ void Test_OS_LockUnlockGlobal(void)
     OS_Unlock_Global(&token);
 }
 
+void Test_OS_ObjectTypeGetLockStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ObjectTypeGetLockStats(osal_objtype_t idtype, OS_lock_stats_t *stats)
+     */
+    OS_lock_stats_t stats;
+
+    memset(&stats, 0xFF, sizeof(stats));
+
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_QUEUE, NULL), OS_INVALID_POINTER);
+
+#ifdef OSAL_CONFIG_LOCK_STATS
+    {
+        /*
+         * The monotonic time samples for each lock/unlock:
+         *  - uncontended lock held by a valid task, wait 5 and hold 25
+         *  - two locks in a row, the second is contended and waits 20
+         *  - wait for a state change while locked, the lock is held 5 before and 10 after
+         *  - unlock twice, the second unlock is held 20 since the state change
+         * Further samples, from reading the statistics, are all zero.
+         */
+        static const OS_time_t TestTimes[] = {{10}, {15}, {40}, {100}, {100}, {110}, {130}, {135}, {140}, {150}, {160}};
+        OS_object_token_t      token;
+        osal_id_t              task_id;
+
+        OS_ObjectIdInit();
+        UT_SetDataBuffer(UT_KEY(OS_GetMonotonicTime_Impl), (void *)TestTimes, sizeof(TestTimes), false);
+
+        memset(&token, 0, sizeof(token));
+        token.obj_type  = OS_OBJECT_TYPE_OS_QUEUE;
+        token.lock_mode = OS_LOCK_MODE_GLOBAL;
+
+        UT_SetHandlerFunction(UT_KEY(OS_TaskGetId_Impl), UT_Handler_OS_TaskGetId_Impl, NULL);
+        OS_Lock_Global(&token);
+        OS_Unlock_Global(&token);
+        UT_ResetState(UT_KEY(OS_TaskGetId_Impl));
+
+        OS_Lock_Global(&token);
+        OS_Lock_Global(&token);
+        OS_WaitForStateChange(&token, 0, 1);
+        OS_Unlock_Global(&token);
+        OS_Unlock_Global(&token);
+
+        OSAPI_TEST_FUNCTION_RC(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_QUEUE, &stats), OS_SUCCESS);
+        UtAssert_UINT32_EQ(stats.acquire_count, 4);
+        UtAssert_UINT32_EQ(stats.contended_count, 1);
+        UtAssert_INT32_EQ(OS_TimeGetTotalNanoseconds(stats.total_wait_time), 2500);
+        UtAssert_INT32_EQ(OS_TimeGetTotalNanoseconds(stats.max_wait_time), 2000);
+        UtAssert_INT32_EQ(OS_TimeGetTotalNanoseconds(stats.total_hold_time), 6000);
+        UtAssert_INT32_EQ(OS_TimeGetTotalNanoseconds(stats.max_hold_time), 2500);
+
+        OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1, &task_id);
+        UtAssert_True(OS_ObjectIdEqual(stats.max_hold_task_id, task_id), "max_hold_task_id (%lx) == %lx",
+                      OS_ObjectIdToInteger(stats.max_hold_task_id), OS_ObjectIdToInteger(task_id));
+
+        OSAPI_TEST_FUNCTION_RC(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_UNDEFINED, &stats), OS_ERR_INVALID_ID);
+    }
+#else
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectTypeGetLockStats(OS_OBJECT_TYPE_OS_QUEUE, &stats), OS_ERR_NOT_IMPLEMENTED);
+#endif
+}
+
+void Test_OS_WaitForStateChange(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_WaitForStateChange(OS_object_token_t *token, uint32 state_seq, uint32 attempts)
+     */
+    OS_object_token_t   token;
+    OS_common_record_t *record;
+    uint32              changes;
+
+    memset(&token, 0, sizeof(token));
+    token.obj_type  = OS_OBJECT_TYPE_OS_TASK;
+    token.lock_mode = OS_LOCK_MODE_GLOBAL;
+    record          = OS_ObjectIdGlobalFromToken(&token);
+
+    /* nothing changes while waiting, this should flag the record as having a waiter */
+    OSAPI_TEST_FUNCTION_RC(OS_WaitForStateChange(&token, 0, 1), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 1);
+    UtAssert_UINT32_EQ(record->state_seq, OS_OBJECT_STATE_WAITERS);
+
+    /* another task is already waiting */
+    OSAPI_TEST_FUNCTION_RC(OS_WaitForStateChange(&token, OS_OBJECT_STATE_WAITERS, 2), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 2);
+
+    /* record already changed since the state was read, should not wait at all */
+    record->state_seq = OS_OBJECT_STATE_SEQ_INCR;
+    OSAPI_TEST_FUNCTION_RC(OS_WaitForStateChange(&token, 0, 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 2);
+    UtAssert_UINT32_EQ(record->state_seq, OS_OBJECT_STATE_SEQ_INCR);
+
+    /* record changed while waiting */
+    changes = 1;
+    UT_SetHandlerFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_Handler_OS_WaitForStateChange_Impl, &changes);
+    OSAPI_TEST_FUNCTION_RC(OS_WaitForStateChange(&token, OS_OBJECT_STATE_SEQ_INCR, 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 3);
+    UtAssert_UINT32_EQ(changes, 0);
+}
+
 void Test_OS_ObjectIdConvertToken(void)
 {
     /*
@@ -169,6 +288,7 @@ void Test_OS_ObjectIdConvertToken(void)
     OS_object_token_t   token;
     OS_common_record_t *record;
     osal_id_t           objid;
+    uint32              changes;
 
     /* confirm that calling w/invalid token returns OS_ERR_INCORRECT_OBJ_STATE */
     memset(&token, 0, sizeof(token));
@@ -207,6 +327,13 @@ void Test_OS_ObjectIdConvertToken(void)
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
     UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 4);
     UT_ResetState(UT_KEY(OS_WaitForStateChange_Impl));
+
+    /* waits where the record changed do not count as an attempt */
+    changes = 2;
+    UT_SetHandlerFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_Handler_OS_WaitForStateChange_Impl, &changes);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdConvertToken(&token), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 6);
+    UT_ResetState(UT_KEY(OS_WaitForStateChange_Impl));
     record->active_id = objid;
 
     /* Failure branch for exclusive lock where active id was overwritten (non-reserved expected_id) */
@@ -459,10 +586,11 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
-    int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
+    int32             actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
     /*
@@ -488,16 +616,93 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                     = OS_OBJECT_TYPE_OS_TASK;
     OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
     OS_global_task_table[0].name_entry = TaskName;
+    OS_ObjectIdNameIndexUpdate(&token, TaskName);
     actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
     expected                           = OS_SUCCESS;
     OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
     OS_global_task_table[0].name_entry = NULL;
+    OS_ObjectIdNameIndexUpdate(&token, NULL);
 
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_SUCCESS", TaskName, (long)actual);
 }
 
+void Test_OS_ObjectIdNameIndex(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token, const char *name);
+     * int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
+     */
+    OS_object_token_t token;
+    OS_object_token_t lookup;
+    char              NameBuf[] = "UT_index";
+    uint32            i;
+
+    memset(&lookup, 0, sizeof(lookup));
+    lookup.obj_type = OS_OBJECT_TYPE_OS_TASK;
+
+    /* An index update with an out of range index should be ignored */
+    memset(&token, 0, sizeof(token));
+    token.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    token.obj_idx  = OSAL_INDEX_C(OS_MAX_TASKS);
+    OS_ObjectIdNameIndexUpdate(&token, NameBuf);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_ERR_NAME_NOT_FOUND);
+
+    /* Lookups on an object type with no entries should not find anything */
+    lookup.obj_type = OS_OBJECT_TYPE_UNDEFINED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_ERR_NAME_NOT_FOUND);
+    lookup.obj_type = OS_OBJECT_TYPE_OS_TASK;
+
+    /* Index every task entry under the same name, only the active ones should match */
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        token.obj_idx                      = OSAL_INDEX_C(i);
+        OS_global_task_table[i].name_entry = NameBuf;
+        OS_ObjectIdNameIndexUpdate(&token, NameBuf);
+    }
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_ERR_NAME_NOT_FOUND);
+    UtAssert_Bool(!OS_ObjectIdDefined(lookup.obj_id), "Token Object ID undefined");
+
+    /* With duplicate names, the lowest index should be returned */
+    OS_global_task_table[OS_MAX_TASKS - 1].active_id = UT_OBJID_1;
+    OS_global_task_table[1].active_id                = UT_OBJID_2;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_SUCCESS);
+    UtAssert_UINT32_EQ(lookup.obj_idx, 1);
+    UtAssert_Bool(OS_ObjectIdEqual(lookup.obj_id, UT_OBJID_2), "Token Object ID");
+
+    /* Removing an entry from the middle of the chain keeps the remainder */
+    token.obj_idx = OSAL_INDEX_C(1);
+    OS_ObjectIdNameIndexUpdate(&token, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_SUCCESS);
+    UtAssert_UINT32_EQ(lookup.obj_idx, OS_MAX_TASKS - 1);
+
+    /* Removing an entry that is not indexed is benign */
+    OS_ObjectIdNameIndexUpdate(&token, NULL);
+
+    /* Renaming moves an entry to a different chain */
+    token.obj_idx                                     = OSAL_INDEX_C(OS_MAX_TASKS - 1);
+    OS_global_task_table[OS_MAX_TASKS - 1].name_entry = "UT_renamed";
+    OS_ObjectIdNameIndexUpdate(&token, "UT_renamed");
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch(NameBuf, &lookup), OS_ERR_NAME_NOT_FOUND);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_renamed", &lookup), OS_SUCCESS);
+    UtAssert_UINT32_EQ(lookup.obj_idx, OS_MAX_TASKS - 1);
+
+    /* A match in the hash chain must also match the actual name */
+    OS_global_task_table[OS_MAX_TASKS - 1].name_entry = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_renamed", &lookup), OS_ERR_NAME_NOT_FOUND);
+
+    /* Clean up */
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        token.obj_idx = OSAL_INDEX_C(i);
+        OS_ObjectIdNameIndexUpdate(&token, NULL);
+    }
+}
+
 void Test_OS_ObjectIdGetById(void)
 {
     /*
@@ -509,6 +714,7 @@ void Test_OS_ObjectIdGetById(void)
     int32               actual   = ~OS_SUCCESS;
     int32               expected = OS_SUCCESS;
     osal_id_t           refobjid;
+    osal_id_t           staleobjid;
     osal_index_t        local_idx = OSAL_INDEX_C(0);
     OS_common_record_t *rptr      = NULL;
     OS_object_token_t   token1;
@@ -541,6 +747,10 @@ void Test_OS_ObjectIdGetById(void)
     UtAssert_True(actual == expected, "OS_ObjectIdGetById() (%ld) == OS_SUCCESS", (long)actual);
     UtAssert_UINT32_EQ(token1.obj_idx, local_idx);
     UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+    /* uncontended REFCOUNT lock should not use the global table lock */
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+#endif
 
     /* attempting to get an exclusive lock should return IN_USE error */
     expected = OS_ERR_OBJECT_IN_USE;
@@ -555,6 +765,13 @@ void Test_OS_ObjectIdGetById(void)
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
 
+    /* stale ID referring to the same entry should fail, and leave refcount unchanged */
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000 + OS_MAX_TASKS, &staleobjid);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, staleobjid, &token1),
+                           OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(token1.lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+
     /* attempt to get non-exclusive lock during shutdown should fail */
     OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
     expected                        = OS_ERR_INCORRECT_OBJ_STATE;
@@ -888,13 +1105,18 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(record->active_id, ==, objid);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
-    /* exclusive lock finish (restores ID from token) */
+    UtAssert_STUB_COUNT(OS_NotifyStateChange_Impl, 0);
+
+    /* exclusive lock finish (restores ID from token), and wakes the waiting task */
     record->refcount  = 1;
     record->active_id = OS_OBJECT_ID_RESERVED;
+    record->state_seq = OS_OBJECT_STATE_WAITERS;
     token.lock_mode   = OS_LOCK_MODE_EXCLUSIVE;
     OS_ObjectIdTransactionFinish(&token, NULL);
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_NotifyStateChange_Impl, 1);
+    UtAssert_UINT32_EQ(record->state_seq, OS_OBJECT_STATE_SEQ_INCR);
     OSAPI_TEST_OBJID(record->active_id, ==, token.obj_id);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
@@ -903,16 +1125,39 @@ void Test_OS_ObjectIdTransaction(void)
     record->refcount  = 1;
     record->active_id = UT_OBJID_1;
     OS_ObjectIdTransactionFinish(&token, NULL);
+#ifdef OSAL_CONFIG_LOCKFREE_REFCOUNT
+    /* refcount is released without locking the global table */
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* with an exclusive request pending, the waiting task is notified, still without locking */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    record->state_seq = OS_OBJECT_STATE_WAITERS;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_NotifyStateChange_Impl, 2);
+    UtAssert_UINT32_EQ(record->state_seq, OS_OBJECT_STATE_SEQ_INCR);
+    record->active_id = UT_OBJID_1;
+#else
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 4);
+#endif
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
     /* other finish with refcount already 0 */
+    UT_ResetState(UT_KEY(OS_Lock_Global_Impl));
+    UT_ResetState(UT_KEY(OS_Unlock_Global_Impl));
     token.lock_mode = OS_LOCK_MODE_GLOBAL;
     OS_ObjectIdTransactionFinish(&token, NULL);
-    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
-    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
@@ -1041,7 +1286,7 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObject() TaskCount (%lu) == 1", (unsigned long)Count.TaskCount);
     UtAssert_True(Count.QueueCount == 1, "OS_ForEachObject() QueueCount (%lu) == 1", (unsigned long)Count.QueueCount);
     UtAssert_True(Count.MutexCount == 1, "OS_ForEachObject() MutexCount (%lu) == 1", (unsigned long)Count.MutexCount);
-    UtAssert_True(Count.OtherCount == 10, "OS_ForEachObject() OtherCount (%lu) == 9", (unsigned long)Count.OtherCount);
+    UtAssert_True(Count.OtherCount == 12, "OS_ForEachObject() OtherCount (%lu) == 12", (unsigned long)Count.OtherCount);
 
     OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObjectOfType(), creator %08lx TaskCount (%lu) == 1",
@@ -1252,14 +1497,17 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_ObjectIdInit);
     ADD_TEST(OS_LockUnlockGlobal);
+    ADD_TEST(OS_ObjectTypeGetLockStats);
     ADD_TEST(OS_ObjectIdFindNextFree);
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
+    ADD_TEST(OS_ObjectIdNameIndex);
     ADD_TEST(OS_ObjectIdGetById);
     ADD_TEST(OS_ObjectIdTransaction);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdFinalize);
     ADD_TEST(OS_ObjectIdConvertToken);
+    ADD_TEST(OS_WaitForStateChange);
     ADD_TEST(OS_ObjectIdGetBySearch);
     ADD_TEST(OS_ConvertToArrayIndex);
     ADD_TEST(OS_ForEachObject);
@@ -0,0 +1,388 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-clock.h"
+#include "os-shared-mempool.h"
+
+#include "OCS_stdlib.h"
+#include "OCS_string.h"
+
+#define UT_MEMPOOL_BLOCKS 3
+#define UT_MEMPOOL_STRIDE 64
+
+static uint8       UT_HeapPool[4096];
+static uint8       UT_PoolStorage[UT_MEMPOOL_BLOCKS * UT_MEMPOOL_STRIDE];
+static atomic_uint UT_PoolNextFree[UT_MEMPOOL_BLOCKS];
+
+/*
+ * Sets up the pool record at UT_INDEX_1 with all blocks on the free list,
+ * the same as OS_MemPoolCreate() would
+ */
+static OS_mempool_internal_record_t *UT_SetupPool(void)
+{
+    OS_mempool_internal_record_t *pool = &OS_mempool_table[UT_INDEX_1];
+
+    memset(pool, 0, sizeof(*pool));
+    pool->storage        = UT_PoolStorage;
+    pool->next_free      = UT_PoolNextFree;
+    pool->block_size     = UT_MEMPOOL_STRIDE;
+    pool->stride         = UT_MEMPOOL_STRIDE;
+    pool->num_blocks     = UT_MEMPOOL_BLOCKS;
+    pool->free_count     = UT_MEMPOOL_BLOCKS;
+    pool->min_free_count = UT_MEMPOOL_BLOCKS;
+    pool->free_head      = 1;
+    UT_PoolNextFree[0]   = 2;
+    UT_PoolNextFree[1]   = 3;
+    UT_PoolNextFree[2]   = 0;
+
+    return pool;
+}
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_MemPoolAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_MemPoolCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolCreate(osal_id_t *pool_id, const char *pool_name, size_t block_size,
+     *                        osal_blockcount_t num_blocks)
+     */
+    OS_mempool_internal_record_t *pool;
+    osal_id_t                     objid = OS_OBJECT_ID_UNDEFINED;
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UtAssert_STUB_COUNT(OS_MemPoolCreate_Impl, 1);
+
+    /* Blocks are rounded up to a multiple of the alignment, and all are initially free */
+    pool = &OS_mempool_table[UT_INDEX_1];
+    UtAssert_NOT_NULL(pool->storage);
+    UtAssert_True(pool->stride >= 10 && (pool->stride % sizeof(uint32)) == 0, "stride (%lu) aligned",
+                  (unsigned long)pool->stride);
+    UtAssert_UINT32_EQ(pool->free_count, 4);
+    UtAssert_UINT32_EQ(pool->min_free_count, 4);
+    UtAssert_UINT32_EQ(pool->free_head, 1);
+    UtAssert_UINT32_EQ(pool->next_free[0], 2);
+    UtAssert_UINT32_EQ(pool->next_free[3], 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(NULL, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, NULL, 10, OSAL_BLOCKCOUNT_C(4)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 0, OSAL_BLOCKCOUNT_C(4)), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(0)), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 1, OSAL_BLOCKCOUNT_C(UINT32_MAX)), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_ERR_NAME_TOO_LONG);
+    UT_ClearDefaultReturnValue(UT_KEY(OCS_memchr));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNew), 1, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_ERR_NO_FREE_IDS);
+    UtAssert_STUB_COUNT(OS_MemPoolCreate_Impl, 1);
+
+    /* The storage must be released if the implementation fails */
+    UT_SetDeferredRetcode(UT_KEY(OS_MemPoolCreate_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_ERROR);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_malloc), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolCreate(&objid, "UT", 10, OSAL_BLOCKCOUNT_C(4)), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_MemPoolCreate_Impl, 2);
+}
+
+void Test_OS_MemPoolDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolDelete(osal_id_t pool_id)
+     */
+    UT_SetupPool();
+    UT_SetDefaultReturnValue(UT_KEY(OS_MemPoolDelete_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolDelete(UT_OBJID_1), OS_ERROR);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+    UtAssert_NOT_NULL(OS_mempool_table[UT_INDEX_1].storage);
+
+    UT_ClearDefaultReturnValue(UT_KEY(OS_MemPoolDelete_Impl));
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolDelete(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+    UtAssert_NULL(OS_mempool_table[UT_INDEX_1].storage);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolDelete(UT_OBJID_1), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_MemPoolGet(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolGet(osal_id_t pool_id, void **block, int32 timeout)
+     */
+    OS_mempool_internal_record_t *pool;
+    void *                        block;
+
+    pool = UT_SetupPool();
+
+    /* Blocks come off the free list in order */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_CHECK), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_PEND), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[UT_MEMPOOL_STRIDE]);
+    UtAssert_UINT32_EQ(pool->free_count, 1);
+    UtAssert_UINT32_EQ(pool->min_free_count, 1);
+    UtAssert_UINT32_EQ(UT_PoolNextFree[0], UINT32_MAX);
+    UtAssert_UINT32_EQ(UT_PoolNextFree[1], UINT32_MAX);
+
+    /* A block in the cache of the current CPU is used first */
+    pool->cache[2].block = 1;
+    pool->free_count++;
+    UT_SetDefaultReturnValue(UT_KEY(OS_MemPoolGetCpu_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_CHECK), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[0]);
+    UtAssert_UINT32_EQ(pool->cache[2].block, 0);
+
+    /* The last block on the shared list, then a block in the cache of another CPU */
+    pool->cache[1].block = 2;
+    pool->free_count++;
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_CHECK), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[2 * UT_MEMPOOL_STRIDE]);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_CHECK), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[UT_MEMPOOL_STRIDE]);
+    UtAssert_UINT32_EQ(pool->free_count, 0);
+    UtAssert_STUB_COUNT(OS_MemPoolWait_Impl, 0);
+
+    /* Empty pool, not waiting */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_CHECK), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(pool->failed_gets, 1);
+    UtAssert_STUB_COUNT(OS_MemPoolWait_Impl, 0);
+
+    /* Empty pool, waits until the timeout */
+    UT_SetDefaultReturnValue(UT_KEY(OS_MemPoolWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, 100), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_MemPoolWait_Impl, 1);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 7);
+    UtAssert_UINT32_EQ(pool->failed_gets, 2);
+
+    /* Waiting is not supported by the implementation */
+    UT_SetDefaultReturnValue(UT_KEY(OS_MemPoolWait_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_PEND), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_STUB_COUNT(OS_GetMonotonicTime_Impl, 1);
+    UtAssert_UINT32_EQ(pool->failed_gets, 3);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_PEND), OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(pool->failed_gets, 3);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 8);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, NULL, OS_PEND), OS_INVALID_POINTER);
+}
+
+/* Hook to return a block to the pool while OS_MemPoolGet() is waiting */
+static int32 UT_MemPoolWaitHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    OS_mempool_internal_record_t *pool = UserObj;
+
+    /* The first wake up is spurious, the pool is still empty */
+    if (CallCount == 1)
+    {
+        pool->free_head = 3;
+        pool->free_count++;
+    }
+
+    return StubRetcode;
+}
+
+void Test_OS_MemPoolGetWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolGet(osal_id_t pool_id, void **block, int32 timeout)
+     * (with a block becoming available while waiting)
+     */
+    OS_mempool_internal_record_t *pool;
+    void *                        block;
+
+    pool             = UT_SetupPool();
+    pool->free_head  = 0;
+    pool->free_count = 0;
+
+    UT_SetHookFunction(UT_KEY(OS_MemPoolWait_Impl), UT_MemPoolWaitHook, pool);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGet(UT_OBJID_1, &block, OS_PEND), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(block, &UT_PoolStorage[2 * UT_MEMPOOL_STRIDE]);
+    UtAssert_STUB_COUNT(OS_MemPoolWait_Impl, 2);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+    UtAssert_UINT32_EQ(pool->failed_gets, 0);
+}
+
+void Test_OS_MemPoolPut(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolPut(osal_id_t pool_id, void *block)
+     */
+    OS_mempool_internal_record_t *pool;
+
+    /* All blocks are in use by the application */
+    pool               = UT_SetupPool();
+    pool->free_head    = 0;
+    pool->free_count   = 0;
+    UT_PoolNextFree[0] = UINT32_MAX;
+    UT_PoolNextFree[1] = UINT32_MAX;
+    UT_PoolNextFree[2] = UINT32_MAX;
+
+    /* The first block goes to the cache for the current CPU, and wakes any waiters */
+    UT_SetDefaultReturnValue(UT_KEY(OS_MemPoolGetCpu_Impl), 3);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[UT_MEMPOOL_STRIDE]), OS_SUCCESS);
+    UtAssert_UINT32_EQ(pool->cache[3].block, 2);
+    UtAssert_UINT32_EQ(pool->free_count, 1);
+    UtAssert_STUB_COUNT(OS_MemPoolWake_Impl, 1);
+
+    /* The cache is full so these go to the shared list, most recent first */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[0]), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[2 * UT_MEMPOOL_STRIDE]), OS_SUCCESS);
+    UtAssert_UINT32_EQ((uint32)pool->free_head, 3);
+    UtAssert_UINT32_EQ(UT_PoolNextFree[2], 1);
+    UtAssert_UINT32_EQ(UT_PoolNextFree[0], 0);
+    UtAssert_UINT32_EQ(pool->free_count, 3);
+    UtAssert_STUB_COUNT(OS_MemPoolWake_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 3);
+
+    /* Blocks already returned, whether in the cache or on the shared list */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[UT_MEMPOOL_STRIDE]), OS_ERR_INCORRECT_OBJ_STATE);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[0]), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_UINT32_EQ((uint32)pool->free_head, 3);
+    UtAssert_UINT32_EQ(UT_PoolNextFree[0], 0);
+    UtAssert_UINT32_EQ(pool->free_count, 3);
+
+    /* Blocks not belonging to the pool */
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[1]), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[sizeof(UT_PoolStorage)]),
+                           OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, UT_HeapPool), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_UINT32_EQ(pool->free_count, 3);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolPut(UT_OBJID_1, &UT_PoolStorage[0]), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_MemPoolGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolGetIdByName (osal_id_t *pool_id, const char *pool_name)
+     */
+    osal_id_t objid;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetIdByName(&objid, "UT"), OS_SUCCESS);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetIdByName(&objid, "NF"), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetIdByName(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetIdByName(&objid, NULL), OS_INVALID_POINTER);
+}
+
+void Test_OS_MemPoolGetInfo(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MemPoolGetInfo (osal_id_t pool_id, OS_mempool_prop_t *pool_prop)
+     */
+    OS_mempool_internal_record_t *pool;
+    OS_mempool_prop_t             pool_prop;
+    osal_id_t                     id;
+
+    pool                  = UT_SetupPool();
+    pool->free_count      = 2;
+    pool->min_free_count  = 1;
+    pool->failed_gets     = 5;
+    pool->block_size      = 50;
+    OS_UT_SetupBasicInfoTest(OS_OBJECT_TYPE_OS_MEMPOOL, UT_INDEX_1, "ABC", UT_OBJID_OTHER);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetInfo(UT_OBJID_1, &pool_prop), OS_SUCCESS);
+
+    id = pool_prop.creator;
+    UtAssert_True(OS_ObjectIdEqual(UT_OBJID_OTHER, id), "pool_prop.creator (%lu) == %lu",
+                  OS_ObjectIdToInteger(pool_prop.creator), OS_ObjectIdToInteger(UT_OBJID_OTHER));
+    UtAssert_StrCmp(pool_prop.name, "ABC", "pool_prop.name (%s) == ABC", pool_prop.name);
+    UtAssert_UINT32_EQ(pool_prop.block_size, 50);
+    UtAssert_UINT32_EQ(pool_prop.num_blocks, UT_MEMPOOL_BLOCKS);
+    UtAssert_UINT32_EQ(pool_prop.free_blocks, 2);
+    UtAssert_UINT32_EQ(pool_prop.min_free_blocks, 1);
+    UtAssert_UINT32_EQ(pool_prop.failed_gets, 5);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetInfo(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MemPoolGetInfo(UT_OBJID_1, &pool_prop), OS_ERR_INVALID_ID);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_mempool_table, 0, sizeof(OS_mempool_table));
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), UT_HeapPool, sizeof(UT_HeapPool), false);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_MemPoolAPI_Init);
+    ADD_TEST(OS_MemPoolCreate);
+    ADD_TEST(OS_MemPoolDelete);
+    ADD_TEST(OS_MemPoolGet);
+    ADD_TEST(OS_MemPoolGetWait);
+    ADD_TEST(OS_MemPoolPut);
+    ADD_TEST(OS_MemPoolGetIdByName);
+    ADD_TEST(OS_MemPoolGetInfo);
+}
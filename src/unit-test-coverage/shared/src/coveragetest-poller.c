@@ -0,0 +1,179 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-poller.h"
+
+#include "OCS_string.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_PollerAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_PollerCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(NULL, "UT", 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, NULL, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_ERR_NAME_TOO_LONG);
+}
+
+void Test_OS_PollerDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerDelete(osal_id_t poller_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete(UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete(UT_OBJID_1), OS_ERROR);
+}
+
+void Test_OS_PollerAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollerAdd_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollerAdd_Impl), OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    /* Invalid stream ID must release the poller */
+    UT_ResetState(UT_KEY(OS_ObjectIdRelease));
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_PollerAdd_Impl, 2);
+}
+
+void Test_OS_PollerRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+
+    UT_ResetState(UT_KEY(OS_ObjectIdRelease));
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 1);
+}
+
+void Test_OS_PollerWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+     *                     int32 msecs)
+     * int32 OS_PollerWaitAbs(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+     *                        OS_time_t abs_timeout)
+     */
+    OS_poller_event_t events[2];
+    uint32            num_events;
+
+    num_events = 99;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, &num_events, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollerWait_Impl, 1);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollerWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWaitAbs(UT_OBJID_1, events, 2, &num_events, OS_TIME_ZERO), OS_ERROR_TIMEOUT);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, NULL, 2, &num_events, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 0, &num_events, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_PollerWait_Impl, 2);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollerAPI_Init);
+    ADD_TEST(OS_PollerCreate);
+    ADD_TEST(OS_PollerDelete);
+    ADD_TEST(OS_PollerAdd);
+    ADD_TEST(OS_PollerRemove);
+    ADD_TEST(OS_PollerWait);
+}
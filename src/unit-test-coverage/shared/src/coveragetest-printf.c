@@ -27,8 +27,28 @@
 #include "os-shared-common.h"
 
 #include "OCS_stdio.h"
+#include "OCS_stdarg.h"
 
-char TestConsoleBuffer[16];
+atomic_uint TestConsoleBuffer[8];
+atomic_uint TestDeferredBuffer[256];
+
+/* The values returned by va_arg() in the implementation */
+uint8  UT_VaArgs[256];
+size_t UT_VaArgsLen;
+
+#define UT_VA_ADD(type, val)                                        \
+    do                                                              \
+    {                                                               \
+        type UT_va_val = (val);                                     \
+        memcpy(&UT_VaArgs[UT_VaArgsLen], &UT_va_val, sizeof(type)); \
+        UT_VaArgsLen += sizeof(type);                               \
+    } while (0)
+
+static void UT_VaArgsSetup(void)
+{
+    UT_ResetState(UT_KEY(OCS_va_arg_ptr));
+    UT_SetDataBuffer(UT_KEY(OCS_va_arg_ptr), UT_VaArgs, UT_VaArgsLen, false);
+}
 
 void Test_OS_ConsoleAPI_Init(void)
 {
@@ -98,7 +118,11 @@ void Test_OS_printf(void)
     UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
                   (unsigned long)OS_console_table[0].WritePos);
 
-    /* print a long string that does not fit in the 16-char buffer */
+    /* the message is stored after a record header */
+    UtAssert_UINT32_EQ(TestConsoleBuffer[0], OS_CONSOLE_REC_COMPLETE | 10);
+    UtAssert_StrnCmp((char *)&TestConsoleBuffer[1], "UnitTest3a", 10, "Record data is UnitTest3a");
+
+    /* print a long string that does not fit in the 32-char buffer */
     OS_printf_enable();
     OS_printf("UnitTest4BufferLengthExceeded");
     UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 1);
@@ -109,10 +133,28 @@ void Test_OS_printf(void)
 
     /* Cover branch for console name overflowing buffer*/
     OS_console_table[0].WritePos = 0;
-    OS_console_table[0].ReadPos  = 1;
+    OS_console_table[0].ReadPos  = 4;
     OS_printf("UnitTest5.5");
     UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 3);
 
+    /* A record that exactly fills the end of the buffer */
+    OS_console_table[0].WritePos = 24;
+    OS_console_table[0].ReadPos  = 24;
+    OS_printf("ab");
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 0);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[6], OS_CONSOLE_REC_COMPLETE | 4);
+
+    /* A record that does not fit at the end of the buffer goes at the start */
+    memset(TestConsoleBuffer, 0, sizeof(TestConsoleBuffer));
+    OS_console_table[0].WritePos = 28;
+    OS_console_table[0].ReadPos  = 28;
+    OS_printf("ab");
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 8);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[7], OS_CONSOLE_REC_SKIP);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[0], OS_CONSOLE_REC_COMPLETE | 4);
+    UtAssert_StrnCmp((char *)&TestConsoleBuffer[1], "utab", 4, "Record data is utab");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 3);
+
     /*
      * For coverage, exercise different paths depending on the return value
      */
@@ -132,6 +174,137 @@ void Test_OS_printf(void)
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
 }
 
+void Test_OS_printf_SetMode(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_printf_SetMode(uint32 mode)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_printf_SetMode(OS_PRINTF_MODE_BINARY), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_SharedGlobalVars.PrintfMode, OS_PRINTF_MODE_BINARY);
+    OSAPI_TEST_FUNCTION_RC(OS_printf_SetMode(OS_PRINTF_MODE_IMMEDIATE), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_SharedGlobalVars.PrintfMode, OS_PRINTF_MODE_IMMEDIATE);
+    OSAPI_TEST_FUNCTION_RC(OS_printf_SetMode(OS_PRINTF_MODE_BINARY + 1), OS_ERR_INVALID_ARGUMENT);
+}
+
+void Test_OS_printf_Deferred(void)
+{
+    /*
+     * Test Case For:
+     * void OS_printf( const char *String, ...);
+     * size_t OS_Console_FormatDeferred(const OS_console_internal_record_t *console, const char *RecordData,
+     *                                  char *Buffer, size_t BufferSize)
+     * in OS_PRINTF_MODE_DEFERRED mode
+     */
+    static const char        Format[] = "%d|%-4hhd|%hu|%ld|%llx|%zu|%jd|%td|%*.*s|%c|%5.1f|%p|%%|%.*s";
+    static const char *const InvalidFormats[] = {"%n",  "%s",  "%00000000000000000000000000000d",
+                                                 "%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%*d",
+                                                 "%Ld", "%lc", "%Lf", "%ls", "%lp", "%y", "%"};
+    static char              LongFormat[UINT16_MAX + 2];
+    char                     Expected[OS_MAX_API_NAME + OS_BUFFER_SIZE];
+    char                     Actual[OS_MAX_API_NAME + OS_BUFFER_SIZE];
+    char                     LongString[OS_BUFFER_SIZE + 10];
+    OS_console_deferred_t    Msg;
+    size_t                   Len;
+    size_t                   i;
+    uint32                   RecordHdr;
+
+    OS_console_table[0].BufBase = (char *)TestDeferredBuffer;
+    OS_console_table[0].BufSize = sizeof(TestDeferredBuffer);
+    OS_console_table[0].IsAsync = true;
+    strncpy(OS_console_table[0].device_name, "ut", sizeof(OS_console_table[0].device_name) - 1);
+    OS_SharedGlobalVars.GlobalState   = OS_INIT_MAGIC_NUMBER;
+    OS_SharedGlobalVars.PrintfEnabled = true;
+    OS_SharedGlobalVars.PrintfMode    = OS_PRINTF_MODE_DEFERRED;
+
+    /* Every type of argument, recorded and then formatted */
+    UT_VaArgsLen = 0;
+    UT_VA_ADD(int, -5);
+    UT_VA_ADD(int, 300);
+    UT_VA_ADD(int, 70000);
+    UT_VA_ADD(long, -7);
+    UT_VA_ADD(unsigned long long, 0x123456789ULL);
+    UT_VA_ADD(size_t, 42);
+    UT_VA_ADD(intmax_t, -9);
+    UT_VA_ADD(ptrdiff_t, 3);
+    UT_VA_ADD(int, 6);
+    UT_VA_ADD(int, 3);
+    UT_VA_ADD(const char *, "abcdef");
+    UT_VA_ADD(int, 'Q');
+    UT_VA_ADD(double, 2.25);
+    UT_VA_ADD(void *, &Msg);
+    UT_VA_ADD(int, -1);
+    UT_VA_ADD(const char *, "xyz");
+    UT_VaArgsSetup();
+    OS_printf(Format, -5, 300, 70000, -7L, 0x123456789ULL, (size_t)42, (intmax_t)-9, (ptrdiff_t)3, 6, 3, "abcdef",
+              'Q', 2.25, (void *)&Msg, -1, "xyz");
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 0);
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 1);
+
+    RecordHdr = TestDeferredBuffer[0];
+    UtAssert_BITMASK_SET(RecordHdr, OS_CONSOLE_REC_COMPLETE | OS_CONSOLE_REC_DEFERRED);
+    UtAssert_UINT32_EQ(RecordHdr & OS_CONSOLE_REC_LEN_MASK, offsetof(OS_console_deferred_t, Words) + (16 * 8) + 8);
+
+    snprintf(Expected, sizeof(Expected), "ut");
+    snprintf(&Expected[2], sizeof(Expected) - 2, Format, -5, 300, 70000, -7L, 0x123456789ULL, (size_t)42,
+             (intmax_t)-9, (ptrdiff_t)3, 6, 3, "abcdef", 'Q', 2.25, (void *)&Msg, -1, "xyz");
+    Len = OS_Console_FormatDeferred(&OS_console_table[0], (char *)&TestDeferredBuffer[1], Actual, sizeof(Actual));
+    UtAssert_STRINGBUF_EQ(Actual, sizeof(Actual), Expected, sizeof(Expected));
+    UtAssert_UINT32_EQ(Len, strlen(Expected));
+
+    /* Truncated output, including the console name */
+    Len = OS_Console_FormatDeferred(&OS_console_table[0], (char *)&TestDeferredBuffer[1], Actual, 8);
+    UtAssert_STRINGBUF_EQ(Actual, 8, Expected, 7);
+    UtAssert_UINT32_EQ(Len, 7);
+    Len = OS_Console_FormatDeferred(&OS_console_table[0], (char *)&TestDeferredBuffer[1], Actual, 2);
+    UtAssert_STRINGBUF_EQ(Actual, 2, "u", 1);
+    UtAssert_UINT32_EQ(Len, 1);
+
+    /* Invalid records */
+    memset(&Msg, 0, sizeof(Msg));
+    Msg.Format   = "%d";
+    Msg.NumWords = OS_CONSOLE_DEFERRED_MAX_WORDS + 1;
+    UtAssert_ZERO(OS_Console_FormatDeferred(&OS_console_table[0], (char *)&Msg, Actual, sizeof(Actual)));
+    Msg.NumWords = 0;
+    Msg.StrSize  = sizeof(Msg.Strings) + 1;
+    UtAssert_ZERO(OS_Console_FormatDeferred(&OS_console_table[0], (char *)&Msg, Actual, sizeof(Actual)));
+    Msg.StrSize = 0;
+    UtAssert_UINT32_EQ(OS_Console_FormatDeferred(&OS_console_table[0], (char *)&Msg, Actual, sizeof(Actual)), 2);
+
+    /*
+     * Messages that cannot be deferred are formatted immediately
+     */
+    UT_VaArgsLen = 0;
+    UT_VaArgsSetup();
+    for (i = 0; i < (sizeof(InvalidFormats) / sizeof(InvalidFormats[0])); ++i)
+    {
+        OS_printf(InvalidFormats[i], 0);
+    }
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 11);
+
+    /* String arguments that do not fit */
+    memset(LongString, 'x', sizeof(LongString) - 1);
+    LongString[sizeof(LongString) - 1] = 0;
+    UT_VaArgsLen                       = 0;
+    UT_VA_ADD(const char *, LongString);
+    UT_VA_ADD(const char *, "a");
+    UT_VaArgsSetup();
+    OS_printf("%s%s", LongString, "a");
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 12);
+
+    /* A format string too long for a binary frame */
+    memset(LongFormat, 'x', sizeof(LongFormat) - 1);
+    OS_printf(LongFormat, 0);
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 13);
+
+    /* OS_ObjectIdGetById failure */
+    UT_ResetState(UT_KEY(OS_ConsoleWakeup_Impl));
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OS_printf("abc");
+    UtAssert_STUB_COUNT(OCS_vsnprintf, 13);
+    UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -142,7 +315,8 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
-    OS_console_table[0].BufBase = TestConsoleBuffer;
+    memset(TestConsoleBuffer, 0, sizeof(TestConsoleBuffer));
+    OS_console_table[0].BufBase = (char *)TestConsoleBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
 }
 
@@ -161,4 +335,6 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleAPI_Init);
     ADD_TEST(OS_printf);
+    ADD_TEST(OS_printf_SetMode);
+    ADD_TEST(OS_printf_Deferred);
 }
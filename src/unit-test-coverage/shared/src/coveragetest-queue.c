@@ -26,6 +26,7 @@
 #include "os-shared-queue.h"
 
 #include "OCS_string.h"
+#include "OCS_stdlib.h"
 
 /*
 **********************************************************************************
@@ -78,8 +79,38 @@ void Test_OS_QueueDelete(void)
      * Test Case For:
      * int32 OS_QueueDelete (uint32 queue_id)
      */
+    void *data;
+    char  Pool[256] = {0};
 
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueSetDeleting_Impl, 1);
+
+    /* If the queue stays in use it is no longer marked as being deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_OBJECT_IN_USE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_QueueSetDeleting_Impl, 3);
+    UtAssert_STUB_COUNT(OS_QueueDelete_Impl, 1);
+
+    /* ...unless it was deleted by another task in the meantime */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_OBJECT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_QueueSetDeleting_Impl, 4);
+
+    /* temporary buffers of the zero-copy API are released with the queue */
+    OS_queue_table[1].max_size = 4;
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueDelete_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERROR);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_free, 2);
+    UtAssert_NULL(OS_queue_table[1].copybufs);
 
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERROR);
@@ -134,6 +165,349 @@ void Test_OS_QueuePut(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), 0), OS_ERROR);
 }
 
+void Test_OS_QueuePutMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutMulti(osal_id_t queue_id, const void *data, size_t stride, const size_t *sizes, uint32 count,
+     *                        uint32 *count_put, uint32 flags)
+     */
+    const char Data[3][4] = {"abc", "def", "ghi"};
+    size_t     Sizes[3]   = {4, 2, 4};
+    uint32     count;
+
+    OS_queue_table[1].max_size = sizeof(Data[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePutMulti_Impl, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 0);
+
+    /* without a batch operation, each message is put individually until one fails */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePutMulti_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 3);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 3);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut_Impl), 2, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0), OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(count, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 5);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, NULL, sizeof(Data[0]), Sizes, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), NULL, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, NULL, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, OSAL_SIZE_C(0), Sizes, 3, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 0, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+
+    /* an invalid size in any message means none are put */
+    Sizes[2] = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0),
+                           OS_QUEUE_INVALID_SIZE);
+    Sizes[2] = 1 + sizeof(Data[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0),
+                           OS_QUEUE_INVALID_SIZE);
+    OS_queue_table[1].max_size = 1 + sizeof(Data[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0),
+                           OS_QUEUE_INVALID_SIZE);
+    UtAssert_UINT32_EQ(count, 0);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 5);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMulti(UT_OBJID_1, Data, sizeof(Data[0]), Sizes, 3, &count, 0), OS_ERROR);
+}
+
+void Test_OS_QueueGetMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t stride, size_t *sizes, uint32 count,
+     *                        uint32 *count_copied, int32 timeout)
+     */
+    char   Buf[3][4];
+    size_t Sizes[3];
+    uint32 count;
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueGetMulti_Impl, 1);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 0);
+
+    /* without a batch operation, each message is got individually until the queue is empty */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueGetMulti_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 3);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 3);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 3, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 2);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 6);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, 100),
+                           OS_QUEUE_TIMEOUT);
+    UtAssert_UINT32_EQ(count, 0);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 7);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, NULL, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), NULL, 3, &count, OS_PEND),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, NULL, OS_PEND),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, OSAL_SIZE_C(0), Sizes, 3, &count, OS_PEND),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 0, &count, OS_PEND),
+                           OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = 1 + sizeof(Buf[0]);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND),
+                           OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMulti(UT_OBJID_1, Buf, sizeof(Buf[0]), Sizes, 3, &count, OS_PEND), OS_ERROR);
+}
+
+void Test_OS_QueueReserve(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueReserve(osal_id_t queue_id, void **data)
+     */
+    void *data;
+    char  Pool[256] = {0};
+
+    OS_queue_table[1].max_size = 4;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueReserve_Impl, 1);
+
+    /* test the copy fallback for queues without direct access */
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    data = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+    UtAssert_NOT_NULL(data);
+    UtAssert_STUB_COUNT(OCS_malloc, 1);
+
+    UtAssert_NOT_NULL(OS_queue_table[1].copybufs);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_malloc), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_ERROR);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_ERROR);
+}
+
+void Test_OS_QueueCommit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCommit(osal_id_t queue_id, void *data, size_t size)
+     */
+    char   Data[4] = "xyz";
+    void * data;
+    size_t size;
+    char   Pool[256] = {0};
+
+    OS_queue_table[1].max_size = sizeof(Data);
+    OS_queue_table[2].max_size = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueCommit_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, NULL, sizeof(Data)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, 1 + sizeof(Data)), OS_QUEUE_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, OSAL_SIZE_C(0)), OS_ERR_INVALID_SIZE);
+    UtAssert_STUB_COUNT(OS_QueueCommit_Impl, 1);
+
+    /* test the copy fallback for queues without direct access */
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueCommit_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+
+    /* a buffer from another queue is rejected, and remains reserved */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_2, data, sizeof(Data)), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, data, sizeof(Data)), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 1);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* the buffer is released even if the put fails */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut_Impl), OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, data, sizeof(Data)), OS_QUEUE_FULL);
+    UtAssert_STUB_COUNT(OCS_free, 2);
+
+    /* committing it again is an error, as is committing a buffer that was not reserved */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, data, sizeof(Data)), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 2);
+    UtAssert_NULL(OS_queue_table[1].copybufs);
+
+    /* a borrowed buffer cannot be committed */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueBorrow_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, (const void **)&data, &size, OS_PEND), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, data, sizeof(Data)), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_NOT_NULL(OS_queue_table[1].copybufs);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data)), OS_ERROR);
+}
+
+void Test_OS_QueueCancel(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCancel(osal_id_t queue_id, void *data)
+     */
+    char  Data[4] = "xyz";
+    void *data;
+    void *data2;
+    char  Pool[256] = {0};
+
+    OS_queue_table[1].max_size = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, Data), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueCancel_Impl, 1);
+
+    /* test the copy fallback for queues without direct access */
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueCancel_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data2), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_2, data), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, data), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut_Impl, 0);
+    UtAssert_NOT_NULL(OS_queue_table[1].copybufs);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, data2), OS_SUCCESS);
+    UtAssert_NULL(OS_queue_table[1].copybufs);
+
+    /* cancelling it again is an error */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, data), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OCS_free, 2);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCancel(UT_OBJID_1, Data), OS_ERROR);
+}
+
+void Test_OS_QueueBorrow(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueBorrow(osal_id_t queue_id, const void **data, size_t *size, int32 timeout)
+     */
+    const void *             data;
+    size_t                   size;
+    char                     Pool[256] = {0};
+    struct OS_queue_copybuf *copybuf;
+
+    OS_queue_table[1].max_size = 4;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_PEND), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueBorrow_Impl, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueBorrow_Impl), 1, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_CHECK), OS_QUEUE_EMPTY);
+    UtAssert_NULL(data);
+    UtAssert_ZERO(size);
+
+    /* test the copy fallback for queues without direct access */
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueBorrow_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_PEND), OS_SUCCESS);
+    UtAssert_NOT_NULL(data);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 1);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+    UtAssert_NOT_NULL(OS_queue_table[1].copybufs);
+
+    /* the buffer is unlisted and released if the get fails */
+    copybuf = OS_queue_table[1].copybufs;
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, 100), OS_QUEUE_TIMEOUT);
+    UtAssert_NULL(data);
+    UtAssert_ADDRESS_EQ(OS_queue_table[1].copybufs, copybuf);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_malloc), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_PEND), OS_ERROR);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, NULL, &size, OS_PEND), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, NULL, OS_PEND), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_PEND), OS_ERROR);
+}
+
+void Test_OS_QueueReturn(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueReturn(osal_id_t queue_id, const void *data)
+     */
+    const void *data;
+    size_t      size;
+    char        Pool[256] = {0};
+
+    OS_queue_table[1].max_size = 4;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, Pool), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueReturn_Impl, 1);
+
+    /* test the copy fallback for queues without direct access */
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), Pool, sizeof(Pool), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueBorrow_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReturn_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueBorrow(UT_OBJID_1, &data, &size, OS_PEND), OS_SUCCESS);
+
+    /* a buffer from another queue is rejected, and remains borrowed */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_2, data), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, data), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* returning it again is an error */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, data), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* a reserved buffer cannot be returned */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, (void **)&data), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, data), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReturn(UT_OBJID_1, data), OS_ERROR);
+}
+
 void Test_OS_QueueGetIdByName(void)
 {
     /*
@@ -183,6 +557,7 @@ void Test_OS_QueueGetInfo(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
+    memset(OS_queue_table, 0, sizeof(OS_queue_table));
 }
 
 /*
@@ -203,6 +578,13 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueDelete);
     ADD_TEST(OS_QueueGet);
     ADD_TEST(OS_QueuePut);
+    ADD_TEST(OS_QueuePutMulti);
+    ADD_TEST(OS_QueueGetMulti);
+    ADD_TEST(OS_QueueReserve);
+    ADD_TEST(OS_QueueCommit);
+    ADD_TEST(OS_QueueCancel);
+    ADD_TEST(OS_QueueBorrow);
+    ADD_TEST(OS_QueueReturn);
     ADD_TEST(OS_QueueGetIdByName);
     ADD_TEST(OS_QueueGetInfo);
 }
@@ -143,6 +143,7 @@ void Test_OS_TimerSet(void)
 
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_1, 0, 1), OS_SUCCESS);
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_1, 1, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TimeBaseQueueSet, 2);
 
     OS_timecb_table[2].timebase_token.obj_type = OS_OBJECT_TYPE_OS_TIMEBASE;
     OS_timecb_table[2].timebase_token.obj_id   = UT_OBJID_2;
@@ -289,6 +290,40 @@ void Test_OS_TimerGetInfo(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimerGetInfo(UT_OBJID_1, &timer_prop), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_TimerGetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TimerGetStats(osal_id_t timer_id, OS_timer_stats_t *stats)
+     */
+    OS_timer_stats_t stats;
+
+    memset(&stats, 0xFF, sizeof(stats));
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimerGetStats(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMECB, UT_INDEX_1);
+    OS_timecb_table[1].timebase_token.obj_type = OS_OBJECT_TYPE_OS_TIMEBASE;
+    OS_timecb_table[1].timebase_token.obj_id   = UT_OBJID_1;
+    OS_timecb_table[1].timebase_token.obj_idx  = UT_INDEX_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimerGetStats(UT_OBJID_1, &stats), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TimeBaseStatsGet, 1);
+    UtAssert_STUB_COUNT(OS_TimeBaseLock_Impl, 1);
+    UtAssert_STUB_COUNT(OS_TimeBaseUnlock_Impl, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId_Impl), 1, 1 | (OS_OBJECT_TYPE_OS_TIMEBASE << OS_OBJECT_TYPE_SHIFT));
+    OSAPI_TEST_FUNCTION_RC(OS_TimerGetStats(UT_OBJID_1, &stats), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TimerGetStats(UT_OBJID_1, &stats), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_TimeBaseStatsGet, 1);
+#else
+    OSAPI_TEST_FUNCTION_RC(OS_TimerGetStats(UT_OBJID_1, &stats), OS_ERR_NOT_IMPLEMENTED);
+#endif
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -319,4 +354,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimerDelete);
     ADD_TEST(OS_TimerGetIdByName);
     ADD_TEST(OS_TimerGetInfo);
+    ADD_TEST(OS_TimerGetStats);
 }
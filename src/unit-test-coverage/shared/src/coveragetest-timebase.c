@@ -216,6 +216,139 @@ void Test_OS_TimeBaseGetFreeRun(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetFreeRun(UT_OBJID_1, &freerun), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_TimeBaseGetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TimeBaseGetStats(osal_id_t timebase_id, OS_timer_stats_t *stats)
+     */
+    OS_timer_stats_t stats;
+
+    memset(&stats, 0xFF, sizeof(stats));
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetStats(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+#ifdef OSAL_CONFIG_TIMER_STATS
+    memset(&OS_timebase_table[1], 0, sizeof(OS_timebase_table[1]));
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_1);
+    OS_timebase_table[1].stats.stats.event_count = 4;
+    OS_timebase_table[1].stats.latency_sum       = 100;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetStats(UT_OBJID_1, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.event_count, 4);
+    UtAssert_UINT32_EQ(stats.latency_mean, 25);
+    UtAssert_STUB_COUNT(OS_TimeBaseLock_Impl, 1);
+    UtAssert_STUB_COUNT(OS_TimeBaseUnlock_Impl, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId_Impl), 1, 1 | (OS_OBJECT_TYPE_OS_TIMEBASE << OS_OBJECT_TYPE_SHIFT));
+    OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetStats(UT_OBJID_1, &stats), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetStats(UT_OBJID_1, &stats), OS_ERR_INVALID_ID);
+
+    memset(&OS_timebase_table[1], 0, sizeof(OS_timebase_table[1]));
+#else
+    OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetStats(UT_OBJID_1, &stats), OS_ERR_NOT_IMPLEMENTED);
+#endif
+}
+
+void Test_OS_TimeBaseStats(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBaseStatsRecord(OS_timer_stats_record_t *record, uint32 latency, uint32 exec_time, bool overrun)
+     * void OS_TimeBaseStatsGet(const OS_timer_stats_record_t *record, OS_timer_stats_t *stats)
+     */
+    OS_timer_stats_record_t record;
+    OS_timer_stats_t        stats;
+
+    memset(&record, 0, sizeof(record));
+
+    /* No events recorded yet, the mean should be zero rather than a divide by zero */
+    OS_TimeBaseStatsGet(&record, &stats);
+    UtAssert_UINT32_EQ(stats.event_count, 0);
+    UtAssert_UINT32_EQ(stats.latency_mean, 0);
+
+    OS_TimeBaseStatsRecord(&record, 3, 0, false);
+    UtAssert_UINT32_EQ(record.stats.latency_min, 3);
+    UtAssert_UINT32_EQ(record.stats.latency_max, 3);
+
+    OS_TimeBaseStatsRecord(&record, 1, 5, true);
+    OS_TimeBaseStatsRecord(&record, 0xFFFFFFFF, 2, false);
+    OS_TimeBaseStatsRecord(&record, 8, 1, true);
+
+    OS_TimeBaseStatsGet(&record, &stats);
+    UtAssert_UINT32_EQ(stats.event_count, 4);
+    UtAssert_UINT32_EQ(stats.overrun_count, 2);
+    UtAssert_UINT32_EQ(stats.latency_min, 1);
+    UtAssert_UINT32_EQ(stats.latency_max, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(stats.latency_mean, (uint32)((0xFFFFFFFFULL + 12) / 4));
+    UtAssert_UINT32_EQ(stats.exec_time_max, 5);
+
+    /* Bin 0 holds zero, bin N holds [2^(N-1), 2^N), and the last bin is open ended */
+    UtAssert_UINT32_EQ(stats.latency_histogram[0], 0);
+    UtAssert_UINT32_EQ(stats.latency_histogram[1], 1);
+    UtAssert_UINT32_EQ(stats.latency_histogram[2], 1);
+    UtAssert_UINT32_EQ(stats.latency_histogram[4], 1);
+    UtAssert_UINT32_EQ(stats.latency_histogram[OS_TIMER_STATS_HISTOGRAM_BINS - 1], 1);
+    UtAssert_UINT32_EQ(stats.exec_time_histogram[0], 1);
+    UtAssert_UINT32_EQ(stats.exec_time_histogram[1], 1);
+    UtAssert_UINT32_EQ(stats.exec_time_histogram[2], 1);
+    UtAssert_UINT32_EQ(stats.exec_time_histogram[3], 1);
+}
+
+void Test_OS_TimeBaseQueue(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBaseQueueSet(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx, uint32 expire_time)
+     * void OS_TimeBaseQueueRemove(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx)
+     */
+    OS_timebase_internal_record_t *timebase;
+
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    timebase = &OS_timebase_table[0];
+
+    /* Insert out of order, the earliest expiry should always be at the head */
+    OS_TimeBaseQueueSet(timebase, 0, 300);
+    OS_TimeBaseQueueSet(timebase, 1, 100);
+    OS_TimeBaseQueueSet(timebase, 2, 400);
+    OS_TimeBaseQueueSet(timebase, 3, 200);
+    UtAssert_UINT32_EQ(timebase->expiry_count, 4);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 1);
+
+    /* Moving an armed timer must not add a duplicate entry */
+    OS_TimeBaseQueueSet(timebase, 2, 50);
+    UtAssert_UINT32_EQ(timebase->expiry_count, 4);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 2);
+    OS_TimeBaseQueueSet(timebase, 2, 500);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 1);
+
+    /* Expire times are compared as free running values which may wrap */
+    OS_TimeBaseQueueSet(timebase, 4, 0xFFFFFF00);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 4);
+    OS_TimeBaseQueueRemove(timebase, 4);
+    UtAssert_UINT32_EQ(OS_timecb_table[4].queue_pos, 0);
+
+    /* Removing entries must keep the remaining ones in expiry order */
+    OS_TimeBaseQueueRemove(timebase, 1);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 3);
+    OS_TimeBaseQueueRemove(timebase, 0);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 3);
+    OS_TimeBaseQueueRemove(timebase, 3);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 2);
+    UtAssert_UINT32_EQ(timebase->expiry_count, 1);
+
+    /* Removing a timer which is not armed has no effect */
+    OS_TimeBaseQueueRemove(timebase, 1);
+    UtAssert_UINT32_EQ(timebase->expiry_count, 1);
+
+    OS_TimeBaseQueueRemove(timebase, 2);
+    UtAssert_UINT32_EQ(timebase->expiry_count, 0);
+    UtAssert_UINT32_EQ(OS_timecb_table[2].queue_pos, 0);
+}
+
 void Test_OS_TimeBase_CallbackThread(void)
 {
     /*
@@ -223,33 +356,26 @@ void Test_OS_TimeBase_CallbackThread(void)
      * void OS_TimeBase_CallbackThread(uint32 timebase_id)
      */
     OS_common_record_t *recptr;
-    OS_object_token_t   timecb_token;
-    OS_object_token_t   timecb_token2;
-
-    memset(&timecb_token, 0, sizeof(timecb_token));
-    memset(&timecb_token2, 0, sizeof(timecb_token2));
 
     recptr = &OS_global_timebase_table[2];
     memset(recptr, 0, sizeof(*recptr));
     recptr->active_id = UT_OBJID_2;
 
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_1, &timecb_token);
+    memset(&OS_timebase_table[2], 0, sizeof(OS_timebase_table[2]));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
     OS_timebase_table[2].external_sync = UT_TimerSync;
-    OS_timebase_table[2].first_cb      = timecb_token.obj_id;
-    OS_timecb_table[1].prev_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].next_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].wait_time       = 2000;
     OS_timecb_table[1].callback_ptr    = UT_TimeCB;
-    TimerSyncCount                     = 0;
-    TimerSyncRetVal                    = 0;
-    TimeCB                             = 0;
+    OS_TimeBaseQueueSet(&OS_timebase_table[2], UT_INDEX_1, 2000);
+    TimerSyncCount  = 0;
+    TimerSyncRetVal = 0;
+    TimeCB          = 0;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
     UtAssert_True(TimerSyncCount == 11, "TimerSyncCount (%lu) == 11", (unsigned long)TimerSyncCount);
 
-    /* No spin path, first timebase->first_cb token get will error */
+    /* No spin path, one-shot timer expires on the second tick and is then disarmed */
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
     TimerSyncCount    = 0;
     TimerSyncRetVal   = 1000;
@@ -258,28 +384,41 @@ void Test_OS_TimeBase_CallbackThread(void)
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
-    /* Check that the TimeCB function was called */
-    UtAssert_True(TimeCB > 0, "TimeCB (%lu) > 0", (unsigned long)TimeCB);
+    /* Check that the TimeCB function was called exactly once */
+    UtAssert_UINT32_EQ(TimeCB, 1);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].expiry_count, 0);
+    UtAssert_UINT32_EQ(OS_timecb_table[1].queue_pos, 0);
+#ifdef OSAL_CONFIG_TIMER_STATS
+    /* Each callback and each tick after the first should be accounted for */
+    UtAssert_UINT32_EQ(OS_timecb_table[1].stats.stats.event_count, 1);
+    UtAssert_NONZERO(OS_timebase_table[2].stats.stats.event_count);
+#endif
 
     /* Error on call to get timebase token */
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
-    /* Other paths for cb logic */
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_2, &timecb_token2);
-    OS_timecb_table[1].next_cb = timecb_token2.obj_id;
-    OS_timecb_table[2].next_cb = timecb_token.obj_id;
+    /*
+     * Other paths for cb logic - a periodic timer with an interval shorter than
+     * the tick (backlog reset) and no callback, along with a timer that is not due
+     */
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
     recptr->active_id = UT_OBJID_2;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
     OS_timecb_table[1].interval_time = 1;
     OS_timecb_table[1].callback_ptr  = NULL;
-
-    /* OS_UT_SetupTestTargetIndex sets the first OS_ObjectIdGetById return, so this sets the second and fourth */
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERROR);
+    OS_TimeBaseQueueSet(&OS_timebase_table[2], UT_INDEX_1, OS_timebase_table[2].freerun_time + 1);
+    OS_timecb_table[2].callback_ptr = UT_TimeCB;
+    OS_TimeBaseQueueSet(&OS_timebase_table[2], UT_INDEX_2, OS_timebase_table[2].freerun_time + 1000000);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
+
+    UtAssert_NONZERO(OS_timecb_table[1].backlog_resets);
+    UtAssert_UINT32_EQ(OS_timebase_table[2].expiry_count, 2);
+    UtAssert_UINT32_EQ(TimeCB, 1);
+
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
 }
 
 void Test_OS_Milli2Ticks(void)
@@ -344,6 +483,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimeBaseGetIdByName);
     ADD_TEST(OS_TimeBaseGetInfo);
     ADD_TEST(OS_TimeBaseGetFreeRun);
+    ADD_TEST(OS_TimeBaseGetStats);
+    ADD_TEST(OS_TimeBaseStats);
+    ADD_TEST(OS_TimeBaseQueue);
     ADD_TEST(OS_TimeBase_CallbackThread);
     ADD_TEST(OS_Milli2Ticks);
 }
@@ -101,6 +101,12 @@ void OS_UT_SetupBasicInfoTest(osal_objtype_t obj_type, osal_index_t test_idx, co
         case OS_OBJECT_TYPE_OS_CONDVAR:
             rptr = OS_global_condvar_table;
             break;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            rptr = OS_global_poller_table;
+            break;
+        case OS_OBJECT_TYPE_OS_MEMPOOL:
+            rptr = OS_global_mempool_table;
+            break;
         default:
             rptr = NULL;
             break;
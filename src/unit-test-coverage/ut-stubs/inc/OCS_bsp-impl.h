@@ -49,6 +49,14 @@
 #define OCS_OS_BSP_CONSOLEMODE_BLUE      0x2108
 #define OCS_OS_BSP_CONSOLEMODE_HIGHLIGHT 0x2110
 
+#define OCS_OS_BSP_CONSOLE_MAX_SEGMENTS 4
+
+typedef struct
+{
+    const char *Str;
+    size_t      DataLen;
+} OCS_OS_BSP_ConsoleSegment_t;
+
 /********************************************************************/
 /* INTERNAL BSP IMPLEMENTATION FUNCTIONS                            */
 /********************************************************************/
@@ -73,6 +81,18 @@ void OCS_OS_BSP_Unlock_Impl(void);
  ------------------------------------------------------------------*/
 extern void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen);
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of several segments.
+ ------------------------------------------------------------------*/
+extern void OCS_OS_BSP_ConsoleOutputV_Impl(const OCS_OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments);
+
+/*----------------------------------------------------------------
+
+    Purpose: Low level output of binary console data, in several segments.
+ ------------------------------------------------------------------*/
+extern void OCS_OS_BSP_ConsoleBinaryOutputV_Impl(const OCS_OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments);
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
@@ -46,5 +46,14 @@ typedef struct
 
 #define OCS_va_start(ap, last) ap.p = &last
 #define OCS_va_end(ap)
+#define OCS_va_copy(dest, src) dest = src
+
+/*
+ * The actual arguments cannot be retrieved, instead each va_arg() returns the next
+ * value from the data buffer registered for OCS_va_arg_ptr, or zero if there is none.
+ */
+#define OCS_va_arg(ap, type) (*(type *)OCS_va_arg_ptr(&(ap), sizeof(type)))
+
+extern void *OCS_va_arg_ptr(OCS_va_list *ap, size_t size);
 
 #endif /* OCS_STDARG_H */
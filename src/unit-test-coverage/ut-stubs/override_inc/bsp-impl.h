@@ -33,11 +33,16 @@
 #define OS_BSP_CONSOLEMODE_GREEN     OCS_OS_BSP_CONSOLEMODE_GREEN
 #define OS_BSP_CONSOLEMODE_BLUE      OCS_OS_BSP_CONSOLEMODE_BLUE
 #define OS_BSP_CONSOLEMODE_HIGHLIGHT OCS_OS_BSP_CONSOLEMODE_HIGHLIGHT
+#define OS_BSP_CONSOLE_MAX_SEGMENTS  OCS_OS_BSP_CONSOLE_MAX_SEGMENTS
 
-#define OS_BSP_Lock_Impl           OCS_OS_BSP_Lock_Impl
-#define OS_BSP_ConsoleOutput_Impl  OCS_OS_BSP_ConsoleOutput_Impl
-#define OS_BSP_ConsoleSetMode_Impl OCS_OS_BSP_ConsoleSetMode_Impl
-#define OS_BSP_Unlock_Impl         OCS_OS_BSP_Unlock_Impl
+#define OS_BSP_ConsoleSegment_t OCS_OS_BSP_ConsoleSegment_t
+
+#define OS_BSP_Lock_Impl                 OCS_OS_BSP_Lock_Impl
+#define OS_BSP_ConsoleOutput_Impl        OCS_OS_BSP_ConsoleOutput_Impl
+#define OS_BSP_ConsoleOutputV_Impl       OCS_OS_BSP_ConsoleOutputV_Impl
+#define OS_BSP_ConsoleBinaryOutputV_Impl OCS_OS_BSP_ConsoleBinaryOutputV_Impl
+#define OS_BSP_ConsoleSetMode_Impl       OCS_OS_BSP_ConsoleSetMode_Impl
+#define OS_BSP_Unlock_Impl               OCS_OS_BSP_Unlock_Impl
 
 /*********************
    END bsp-impl.h
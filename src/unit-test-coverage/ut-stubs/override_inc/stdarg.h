@@ -35,5 +35,7 @@
 #define va_list            OCS_va_list
 #define va_start(ap, last) OCS_va_start(ap, last)
 #define va_end(ap)         OCS_va_end(ap)
+#define va_copy(dest, src) OCS_va_copy(dest, src)
+#define va_arg(ap, type)   OCS_va_arg(ap, type)
 
 #endif /* OVERRIDE_STDARG_H */
@@ -66,6 +66,43 @@ void OCS_OS_BSP_ConsoleOutput_Impl(const char *Str, size_t DataLen)
     }
 }
 
+/*----------------------------------------------------------------
+
+    Purpose: Low level raw console data output of several segments.
+ ------------------------------------------------------------------*/
+void OCS_OS_BSP_ConsoleOutputV_Impl(const OCS_OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    int32_t retcode = UT_DEFAULT_IMPL(OCS_OS_BSP_ConsoleOutputV_Impl);
+    size_t  i;
+
+    if (retcode == 0)
+    {
+        for (i = 0; i < NumSegments; ++i)
+        {
+            UT_Stub_CopyFromLocal(UT_KEY(OCS_OS_BSP_ConsoleOutputV_Impl), Segments[i].Str, Segments[i].DataLen);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Low level output of binary console data, in several segments.
+ ------------------------------------------------------------------*/
+void OCS_OS_BSP_ConsoleBinaryOutputV_Impl(const OCS_OS_BSP_ConsoleSegment_t *Segments, size_t NumSegments)
+{
+    int32_t retcode = UT_DEFAULT_IMPL(OCS_OS_BSP_ConsoleBinaryOutputV_Impl);
+    size_t  i;
+
+    if (retcode == 0)
+    {
+        for (i = 0; i < NumSegments; ++i)
+        {
+            UT_Stub_CopyFromLocal(UT_KEY(OCS_OS_BSP_ConsoleBinaryOutputV_Impl), Segments[i].Str,
+                                  Segments[i].DataLen);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
 
     Purpose: Set the console output mode, if supported by the BSP.
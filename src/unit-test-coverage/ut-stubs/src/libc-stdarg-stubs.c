@@ -0,0 +1,45 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* OSAL coverage stub replacement for stdarg.h */
+#include <string.h>
+#include "utstubs.h"
+
+#include "OCS_stdarg.h"
+
+void *OCS_va_arg_ptr(OCS_va_list *ap, size_t size)
+{
+    static union
+    {
+        long double ld;
+        uint64_t    u64;
+        void *      ptr;
+        uint8_t     bytes[32];
+    } Value;
+
+    UT_DEFAULT_IMPL(OCS_va_arg_ptr);
+
+    memset(&Value, 0, sizeof(Value));
+    if (size > sizeof(Value))
+    {
+        size = sizeof(Value);
+    }
+    UT_Stub_CopyToLocal(UT_KEY(OCS_va_arg_ptr), Value.bytes, size);
+
+    return &Value;
+}
@@ -50,3 +50,22 @@ void UT_DefaultHandler_OS_GetLocalTime_Impl(void *UserObj, UT_EntryKey_t FuncKey
         memset(time_struct, 0, sizeof(*time_struct));
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GetMonotonicTime_Impl' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GetMonotonicTime_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_GetMonotonicTime_Impl), time_struct, sizeof(*time_struct)) < sizeof(*time_struct))
+    {
+        memset(time_struct, 0, sizeof(*time_struct));
+    }
+}
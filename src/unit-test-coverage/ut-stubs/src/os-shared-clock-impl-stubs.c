@@ -26,6 +26,7 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_OS_GetLocalTime_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GetMonotonicTime_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -43,6 +44,22 @@ int32 OS_GetLocalTime_Impl(OS_time_t *time_struct)
     return UT_GenStub_GetReturnValue(OS_GetLocalTime_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetMonotonicTime_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GetMonotonicTime_Impl(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetMonotonicTime_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GetMonotonicTime_Impl, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetMonotonicTime_Impl, Basic, UT_DefaultHandler_OS_GetMonotonicTime_Impl);
+
+    return UT_GenStub_GetReturnValue(OS_GetMonotonicTime_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SetLocalTime_Impl()
@@ -28,6 +28,57 @@
 void UT_DefaultHandler_OS_GenericRead_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GenericWrite_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncClose_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncClose_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncClose_Impl, int32);
+
+    UT_GenStub_AddParam(OS_AsyncClose_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_AsyncClose_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncClose_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncSubmit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncSubmit_Impl(const OS_object_token_t *token, const OS_async_request_t *request)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncSubmit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_AsyncSubmit_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_AsyncSubmit_Impl, const OS_async_request_t *, request);
+
+    UT_GenStub_Execute(OS_AsyncSubmit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncSubmit_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWaitCompletion_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWaitCompletion_Impl(const OS_object_token_t *token, OS_async_completion_t *completion, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWaitCompletion_Impl, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion_Impl, OS_async_completion_t *, completion);
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion_Impl, int32, msecs);
+
+    UT_GenStub_Execute(OS_AsyncWaitCompletion_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWaitCompletion_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileChmod_Impl()
@@ -45,6 +96,50 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode)
     return UT_GenStub_GetReturnValue(OS_FileChmod_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileCopyRange_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileCopyRange_Impl(const OS_object_token_t *src_token, osal_offset_t src_off,
+                            const OS_object_token_t *dst_token, osal_offset_t dst_off, osal_offset_t len,
+                            osal_offset_t *copied)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileCopyRange_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, const OS_object_token_t *, src_token);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, osal_offset_t, src_off);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, const OS_object_token_t *, dst_token);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, osal_offset_t, dst_off);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, osal_offset_t, len);
+    UT_GenStub_AddParam(OS_FileCopyRange_Impl, osal_offset_t *, copied);
+
+    UT_GenStub_Execute(OS_FileCopyRange_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileCopyRange_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap_Impl(const OS_object_token_t *token, osal_offset_t offset, size_t len, uint32 access,
+                      OS_file_mapping_t *mapping)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileMap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileMap_Impl, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_FileMap_Impl, size_t, len);
+    UT_GenStub_AddParam(OS_FileMap_Impl, uint32, access);
+    UT_GenStub_AddParam(OS_FileMap_Impl, OS_file_mapping_t *, mapping);
+
+    UT_GenStub_Execute(OS_FileMap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpen_Impl()
@@ -114,6 +209,23 @@ int32 OS_FileStat_Impl(const char *local_path, os_fstat_t *filestat)
     return UT_GenStub_GetReturnValue(OS_FileStat_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, OS_file_mapping_t *mapping)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, OS_file_mapping_t *, mapping);
+
+    UT_GenStub_Execute(OS_FileUnmap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericClose_Impl()
@@ -130,6 +242,44 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_GenericClose_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPread_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPread_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPread_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPread_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPread_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPwrite_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPwrite_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPwrite_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPwrite_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericRead_Impl()
@@ -149,6 +299,25 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
     return UT_GenStub_GetReturnValue(OS_GenericRead_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericReadv_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericReadv_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericReadv_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_GenericReadv_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_GenericReadv_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericReadv_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericSeek_Impl()
@@ -186,6 +355,25 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
     return UT_GenStub_GetReturnValue(OS_GenericWrite_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericWritev_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericWritev_Impl(const OS_object_token_t *token, const OS_iovec_t *iov, uint32 iovcnt, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericWritev_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_GenericWritev_Impl, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_GenericWritev_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GenericWritev_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ShellOutputToFile_Impl()
@@ -37,6 +37,19 @@ void OS_Lock_Global_Impl(osal_objtype_t idtype)
     UT_GenStub_Execute(OS_Lock_Global_Impl, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_NotifyStateChange_Impl()
+ * ----------------------------------------------------
+ */
+void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word)
+{
+    UT_GenStub_AddParam(OS_NotifyStateChange_Impl, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_NotifyStateChange_Impl, atomic_uint *, state_word);
+
+    UT_GenStub_Execute(OS_NotifyStateChange_Impl, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_Unlock_Global_Impl()
@@ -54,9 +67,11 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  * Generated stub function for OS_WaitForStateChange_Impl()
  * ----------------------------------------------------
  */
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq, uint32 attempts)
 {
     UT_GenStub_AddParam(OS_WaitForStateChange_Impl, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_WaitForStateChange_Impl, atomic_uint *, state_word);
+    UT_GenStub_AddParam(OS_WaitForStateChange_Impl, uint32, state_seq);
     UT_GenStub_AddParam(OS_WaitForStateChange_Impl, uint32, attempts);
 
     UT_GenStub_Execute(OS_WaitForStateChange_Impl, Basic, NULL);
@@ -190,6 +190,23 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return UT_GenStub_GetReturnValue(OS_ObjectIdFindByName, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFindNameMatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFindNameMatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, const char *, name);
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdFindNameMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFindNameMatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFindNextFree()
@@ -395,6 +412,19 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
     return UT_GenStub_GetReturnValue(OS_ObjectIdIteratorProcessEntry, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexUpdate()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token, const char *name)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexUpdate, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexUpdate, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexUpdate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdRelease()
@@ -498,10 +528,15 @@ void OS_Unlock_Global(OS_object_token_t *token)
  * Generated stub function for OS_WaitForStateChange()
  * ----------------------------------------------------
  */
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
+int32 OS_WaitForStateChange(OS_object_token_t *token, uint32 state_seq, uint32 attempts)
 {
+    UT_GenStub_SetupReturnBuffer(OS_WaitForStateChange, int32);
+
     UT_GenStub_AddParam(OS_WaitForStateChange, OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_WaitForStateChange, uint32, state_seq);
     UT_GenStub_AddParam(OS_WaitForStateChange, uint32, attempts);
 
     UT_GenStub_Execute(OS_WaitForStateChange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_WaitForStateChange, int32);
 }
@@ -0,0 +1,101 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in os-shared-mempool header
+ */
+
+#include "os-shared-mempool.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolCreate_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolCreate_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolCreate_Impl, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolCreate_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_MemPoolCreate_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolCreate_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolDelete_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolDelete_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolDelete_Impl, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolDelete_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_MemPoolDelete_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolDelete_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolGetCpu_Impl()
+ * ----------------------------------------------------
+ */
+uint32 OS_MemPoolGetCpu_Impl(void)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolGetCpu_Impl, uint32);
+
+    UT_GenStub_Execute(OS_MemPoolGetCpu_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolGetCpu_Impl, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolWait_Impl(const OS_object_token_t *token, const OS_time_t *abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolWait_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_MemPoolWait_Impl, const OS_time_t *, abs_timeout);
+
+    UT_GenStub_Execute(OS_MemPoolWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolWait_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolWake_Impl()
+ * ----------------------------------------------------
+ */
+void OS_MemPoolWake_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_MemPoolWake_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_MemPoolWake_Impl, Basic, NULL);
+}
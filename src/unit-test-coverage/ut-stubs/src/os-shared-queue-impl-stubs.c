@@ -25,6 +25,60 @@
 #include "os-shared-queue.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueBorrow_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueBorrow_Impl(const OS_object_token_t *token, const void **data, size_t *size, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueBorrow_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, const void **, data);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, size_t *, size);
+    UT_GenStub_AddParam(OS_QueueBorrow_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueBorrow_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueBorrow_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCancel_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCancel_Impl(const OS_object_token_t *token, void *data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCancel_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueCancel_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueCancel_Impl, void *, data);
+
+    UT_GenStub_Execute(OS_QueueCancel_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCancel_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, void *, data);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, size_t, size);
+
+    UT_GenStub_Execute(OS_QueueCommit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueCreate_Impl()
@@ -75,6 +129,29 @@ int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queu
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti_Impl(const OS_object_token_t *token, void *data, size_t stride, size_t *sizes, uint32 count,
+                            uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, size_t, stride);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueGet_Impl()
@@ -95,6 +172,29 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return UT_GenStub_GetReturnValue(OS_QueueGet_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMulti_Impl(const OS_object_token_t *token, const void *data, size_t stride, const size_t *sizes,
+                            uint32 count, uint32 *count_put, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, size_t, stride);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, const size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32 *, count_put);
+    UT_GenStub_AddParam(OS_QueuePutMulti_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueuePutMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut_Impl()
@@ -113,3 +213,50 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     return UT_GenStub_GetReturnValue(OS_QueuePut_Impl, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, void **, data);
+
+    UT_GenStub_Execute(OS_QueueReserve_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReturn_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReturn_Impl(const OS_object_token_t *token, const void *data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReturn_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueReturn_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueReturn_Impl, const void *, data);
+
+    UT_GenStub_Execute(OS_QueueReturn_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReturn_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueSetDeleting_Impl()
+ * ----------------------------------------------------
+ */
+void OS_QueueSetDeleting_Impl(const OS_object_token_t *token, bool deleting)
+{
+    UT_GenStub_AddParam(OS_QueueSetDeleting_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueSetDeleting_Impl, bool, deleting);
+
+    UT_GenStub_Execute(OS_QueueSetDeleting_Impl, Basic, NULL);
+}
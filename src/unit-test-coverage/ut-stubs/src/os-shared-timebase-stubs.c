@@ -42,6 +42,61 @@ int32 OS_Milli2Ticks(uint32 milli_seconds, int *ticks)
     return UT_GenStub_GetReturnValue(OS_Milli2Ticks, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseQueueRemove()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseQueueRemove(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx)
+{
+    UT_GenStub_AddParam(OS_TimeBaseQueueRemove, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBaseQueueRemove, osal_index_t, cb_idx);
+
+    UT_GenStub_Execute(OS_TimeBaseQueueRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseQueueSet()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseQueueSet(OS_timebase_internal_record_t *timebase, osal_index_t cb_idx, uint32 expire_time)
+{
+    UT_GenStub_AddParam(OS_TimeBaseQueueSet, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBaseQueueSet, osal_index_t, cb_idx);
+    UT_GenStub_AddParam(OS_TimeBaseQueueSet, uint32, expire_time);
+
+    UT_GenStub_Execute(OS_TimeBaseQueueSet, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseStatsGet()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseStatsGet(const OS_timer_stats_record_t *record, OS_timer_stats_t *stats)
+{
+    UT_GenStub_AddParam(OS_TimeBaseStatsGet, const OS_timer_stats_record_t *, record);
+    UT_GenStub_AddParam(OS_TimeBaseStatsGet, OS_timer_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_TimeBaseStatsGet, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseStatsRecord()
+ * ----------------------------------------------------
+ */
+void OS_TimeBaseStatsRecord(OS_timer_stats_record_t *record, uint32 latency, uint32 exec_time, bool overrun)
+{
+    UT_GenStub_AddParam(OS_TimeBaseStatsRecord, OS_timer_stats_record_t *, record);
+    UT_GenStub_AddParam(OS_TimeBaseStatsRecord, uint32, latency);
+    UT_GenStub_AddParam(OS_TimeBaseStatsRecord, uint32, exec_time);
+    UT_GenStub_AddParam(OS_TimeBaseStatsRecord, bool, overrun);
+
+    UT_GenStub_Execute(OS_TimeBaseStatsRecord, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimeBase_CallbackThread()
@@ -41,6 +41,8 @@ OS_common_record_t OS_stub_timecb_table[OS_MAX_TIMERS];
 OS_common_record_t OS_stub_stream_table[OS_MAX_NUM_OPEN_FILES];
 OS_common_record_t OS_stub_dir_table[OS_MAX_NUM_OPEN_DIRS];
 OS_common_record_t OS_stub_condvar_table[OS_MAX_CONDVARS];
+OS_common_record_t OS_stub_poller_table[OS_MAX_POLLERS];
+OS_common_record_t OS_stub_mempool_table[OS_MAX_MEMPOOLS];
 
 OS_common_record_t *const OS_global_task_table      = OS_stub_task_table;
 OS_common_record_t *const OS_global_queue_table     = OS_stub_queue_table;
@@ -55,3 +57,5 @@ OS_common_record_t *const OS_global_module_table    = OS_stub_module_table;
 OS_common_record_t *const OS_global_filesys_table   = OS_stub_filesys_table;
 OS_common_record_t *const OS_global_console_table   = OS_stub_console_table;
 OS_common_record_t *const OS_global_condvar_table   = OS_stub_condvar_table;
+OS_common_record_t *const OS_global_poller_table    = OS_stub_poller_table;
+OS_common_record_t *const OS_global_mempool_table   = OS_stub_mempool_table;
@@ -81,6 +81,15 @@ OCS_ssize_t OCS_recvfrom(int fd, void *buf, size_t n, int flags, struct OCS_sock
     return UT_DEFAULT_IMPL(OCS_recvfrom);
 }
 
+OCS_ssize_t OCS_sendmsg(int fd, const struct OCS_msghdr *msg, int flags)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_sendmsg), fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_sendmsg), msg);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_sendmsg), flags);
+
+    return UT_DEFAULT_IMPL(OCS_sendmsg);
+}
+
 OCS_ssize_t OCS_sendto(int fd, const void *buf, size_t n, int flags, const struct OCS_sockaddr *addr,
                        OCS_socklen_t addr_len)
 {
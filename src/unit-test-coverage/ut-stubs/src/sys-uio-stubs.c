@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  ut-stubs
+ *
+ */
+
+/* OSAL coverage stub replacement for functions in sys/uio.h */
+#include "utstubs.h"
+
+#include "OCS_sys_uio.h"
+
+OCS_ssize_t OCS_readv(int fd, const struct OCS_iovec *iov, int iovcnt)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_readv), fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_readv), iov);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_readv), iovcnt);
+
+    return UT_DEFAULT_IMPL(OCS_readv);
+}
+
+OCS_ssize_t OCS_writev(int fd, const struct OCS_iovec *iov, int iovcnt)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_writev), fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_writev), iov);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_writev), iovcnt);
+
+    return UT_DEFAULT_IMPL(OCS_writev);
+}
@@ -88,16 +88,30 @@ void Test_OS_WaitForStateChange_Impl(void)
 {
     /*
      * Test Case For:
-     * void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+     * void OS_WaitForStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word, uint32 state_seq,
+     *                                 uint32 attempts)
      */
+    atomic_uint state_word = 0;
 
     /*
      * This has no return value/error results - just needs to be called for coverage.
      * Call it once with a low number and once with a high number of attempts -
      * which should cause it to hit its limit for wait time.
      */
-    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, 1);
-    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, 1000);
+    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, &state_word, 0, 1);
+    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, &state_word, 0, 1000);
+}
+
+void Test_OS_NotifyStateChange_Impl(void)
+{
+    /*
+     * Test Case For:
+     * void OS_NotifyStateChange_Impl(osal_objtype_t objtype, atomic_uint *state_word)
+     */
+    atomic_uint state_word = 0;
+
+    /* This has no return value/error results - just needs to be called for coverage. */
+    OS_NotifyStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, &state_word);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
@@ -131,4 +145,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_Unlock_Global_Impl);
     ADD_TEST(OS_API_Impl_Init);
     ADD_TEST(OS_WaitForStateChange_Impl);
+    ADD_TEST(OS_NotifyStateChange_Impl);
 }
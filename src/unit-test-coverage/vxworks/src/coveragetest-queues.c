@@ -67,6 +67,18 @@ void Test_OS_QueueDelete_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete_Impl(&token), OS_ERROR);
 }
 
+void Test_OS_QueueSetDeleting_Impl(void)
+{
+    /*
+     * Test Case For:
+     * void OS_QueueSetDeleting_Impl(const OS_object_token_t *token, bool deleting)
+     */
+    OS_object_token_t token = UT_TOKEN_0;
+
+    UtAssert_VOIDCALL(OS_QueueSetDeleting_Impl(&token, true));
+    UtAssert_VOIDCALL(OS_QueueSetDeleting_Impl(&token, false));
+}
+
 void Test_OS_QueueGet_Impl(void)
 {
     /*
@@ -159,6 +171,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_VxWorks_QueueAPI_Impl_Init);
     ADD_TEST(OS_QueueCreate_Impl);
     ADD_TEST(OS_QueueDelete_Impl);
+    ADD_TEST(OS_QueueSetDeleting_Impl);
     ADD_TEST(OS_QueueGet_Impl);
     ADD_TEST(OS_QueuePut_Impl);
     ADD_TEST(OS_QueueGetInfo_Impl);
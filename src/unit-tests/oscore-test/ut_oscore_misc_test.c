@@ -276,6 +276,60 @@ void UT_os_getlocaltime_test()
     UT_MIR_STATUS(OS_GetLocalTime(&time_struct));
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+** Purpose: Returns the value of a clock which is not affected by changes to the local time
+** Parameters: *time_struct - a pointer to an OS_time_t structure that will hold
+**                            the current monotonic time
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call this routine with valid argument, before and after a task delay
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS
+**   3) Expect the difference between the two values to be at least the delay
+**--------------------------------------------------------------------------------*/
+void UT_os_getmonotonictime_test()
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    int64     elapsed_msec;
+
+    /*-----------------------------------------------------*/
+    /* API not implemented */
+
+    if (!UT_IMPL(OS_GetMonotonicTime(NULL)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #1 Null-pointer-arg */
+    UT_RETVAL(OS_GetMonotonicTime(NULL), OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal */
+    UT_NOMINAL(OS_GetMonotonicTime(&start_time));
+    OS_TaskDelay(20);
+    UT_NOMINAL(OS_GetMonotonicTime(&end_time));
+
+    elapsed_msec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(end_time, start_time));
+    UtAssert_True(elapsed_msec >= 20, "Elapsed monotonic time (%ld ms) >= 20 ms", (long)elapsed_msec);
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_SetLocalTime(OS_time_t *time_struct)
 ** Purpose: Allows user to set the local time of the machine it is on
@@ -447,6 +501,72 @@ void UT_os_statustostring_test(void)
     UT_os_statustostring_test_helper(OSAL_STATUS_C(INT32_MIN));
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_HeapAlloc(void **ptr, size_t size)
+**         int32 OS_HeapFree(void *ptr)
+**         int32 OS_HeapGetTaskUsage(osal_id_t task_id, size_t *bytes)
+** Purpose: Allocates and frees memory from the OSAL heap
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the size is zero
+**          OS_ERR_INVALID_ID if the task ID is not valid
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Invalid-argument conditions
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Allocate a small and a large block and fill them
+**   2) If called from an OSAL task, expect the usage of the task to include both
+**   3) Free both blocks, and expect the usage to return to its previous value
+**--------------------------------------------------------------------------------*/
+void UT_os_heapalloc_test(void)
+{
+    osal_id_t task_id;
+    void *    small_block;
+    void *    large_block;
+    size_t    initial_bytes;
+    size_t    bytes;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-argument */
+
+    UT_RETVAL(OS_HeapAlloc(NULL, 100), OS_INVALID_POINTER);
+    UT_RETVAL(OS_HeapAlloc(&small_block, 0), OS_ERR_INVALID_SIZE);
+    UT_RETVAL(OS_HeapFree(NULL), OS_INVALID_POINTER);
+    UT_RETVAL(OS_HeapGetTaskUsage(OS_OBJECT_ID_UNDEFINED, &bytes), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal */
+
+    task_id       = OS_TaskGetId();
+    initial_bytes = 0;
+    if (OS_ObjectIdDefined(task_id))
+    {
+        UT_RETVAL(OS_HeapGetTaskUsage(task_id, NULL), OS_INVALID_POINTER);
+        UT_NOMINAL(OS_HeapGetTaskUsage(task_id, &initial_bytes));
+    }
+
+    UT_NOMINAL(OS_HeapAlloc(&small_block, 100));
+    UT_NOMINAL(OS_HeapAlloc(&large_block, 100000));
+    memset(small_block, 0xA5, 100);
+    memset(large_block, 0x5A, 100000);
+
+    if (OS_ObjectIdDefined(task_id))
+    {
+        UT_NOMINAL(OS_HeapGetTaskUsage(task_id, &bytes));
+        UtAssert_True(bytes >= initial_bytes + 100100, "Task usage (%lu) includes allocated blocks",
+                      (unsigned long)bytes);
+    }
+
+    UT_NOMINAL(OS_HeapFree(small_block));
+    UT_NOMINAL(OS_HeapFree(large_block));
+
+    if (OS_ObjectIdDefined(task_id))
+    {
+        UT_NOMINAL(OS_HeapGetTaskUsage(task_id, &bytes));
+        UtAssert_UINT32_EQ(bytes, initial_bytes);
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_HeapGetInfo(OS_heap_prop_t *heap_prop)
 ** Purpose: Returns current info on the heap
@@ -60,11 +60,13 @@ void UT_os_printfenable_test(void);
 void UT_os_printfdisable_test(void);
 
 void UT_os_getlocaltime_test(void);
+void UT_os_getmonotonictime_test(void);
 void UT_os_setlocaltime_test(void);
 
 void UT_os_geterrorname_test(void);
 void UT_os_statustostring_test(void);
 
+void UT_os_heapalloc_test(void);
 void UT_os_heapgetinfo_test(void);
 
 /*--------------------------------------------------------------------------------*/
@@ -439,6 +439,408 @@ void UT_os_queue_get_info_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueCreate with OS_QUEUE_FLAG_USERSPACE / OS_QUEUE_FLAG_SYSTEM
+** Purpose: Confirms both queue implementations have the same put/get semantics.
+**          On implementations without a user-space queue both flags select the
+**          normal queue, so these cases apply to every implementation.
+** Parameters: To-be-filled-in
+** Returns: Same as OS_QueuePut / OS_QueueGet
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_flags_test()
+{
+    static const uint32 flag_list[] = {OS_QUEUE_FLAG_USERSPACE, OS_QUEUE_FLAG_SYSTEM};
+
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    queue_data_out;
+    uint32    queue_data_in;
+    size_t    data_size;
+    uint32    f;
+    uint32    i;
+
+    for (f = 0; f < (sizeof(flag_list) / sizeof(flag_list[0])); ++f)
+    {
+        UtPrintf("Testing with queue flags=0x%x", (unsigned int)flag_list[f]);
+
+        /*-----------------------------------------------------*/
+        /* #1 Queue-full and FIFO order */
+
+        if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueFlags", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), flag_list[f])))
+        {
+            for (i = 0; i < 10; ++i)
+            {
+                queue_data_out = i;
+                UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+            }
+
+            UT_RETVAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0), OS_QUEUE_FULL);
+
+            for (i = 0; i < 10; ++i)
+            {
+                queue_data_in = ~i;
+                UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK));
+                UtAssert_UINT32_EQ(queue_data_in, i);
+                UtAssert_UINT32_EQ(data_size, sizeof(uint32));
+            }
+
+            UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+            UtAssert_UINT32_EQ(data_size, 0);
+
+            /* after being emptied it should be possible to fill again */
+            queue_data_out = 0x11223344;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_PEND));
+            UtAssert_UINT32_EQ(queue_data_in, queue_data_out);
+
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+
+        /*-----------------------------------------------------*/
+        /* #2 Short message and timeout */
+
+        if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueFlags", OSAL_BLOCKCOUNT_C(2), sizeof(uint32), flag_list[f])))
+        {
+            UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, 2), OS_QUEUE_TIMEOUT);
+
+            queue_data_out = 0x11223344;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, OSAL_SIZE_C(2), 0));
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, 20));
+            UtAssert_UINT32_EQ(data_size, 2);
+
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_QueuePutMulti(osal_id_t queue_id, const void *data, size_t stride, const size_t *sizes,
+**                                uint32 count, uint32 *count_put, uint32 flags)
+**         int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t stride, size_t *sizes, uint32 count,
+**                                uint32 *count_copied, int32 timeout)
+** Purpose: Put/get a batch of messages
+**          This is run with both types of queue, in case the implementation
+**          only supports a batch operation on one of them.
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_multi_test()
+{
+    static const uint32 flag_list[] = {OS_QUEUE_FLAG_USERSPACE, OS_QUEUE_FLAG_SYSTEM};
+
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    queue_data_out[6];
+    uint32    queue_data_in[6];
+    size_t    sizes_out[6];
+    size_t    sizes_in[6];
+    uint32    count;
+    uint32    f;
+    uint32    i;
+
+    for (i = 0; i < 6; ++i)
+    {
+        queue_data_out[i] = 0x10101010 * (i + 1);
+        sizes_out[i]      = sizeof(uint32);
+    }
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-id-arg */
+
+    UT_RETVAL(OS_QueuePutMulti(UT_OBJID_INCORRECT, queue_data_out, sizeof(uint32), sizes_out, 1, &count, 0),
+              OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueGetMulti(UT_OBJID_INCORRECT, queue_data_in, sizeof(uint32), sizes_in, 1, &count, OS_CHECK),
+              OS_ERR_INVALID_ID);
+
+    for (f = 0; f < (sizeof(flag_list) / sizeof(flag_list[0])); ++f)
+    {
+        UtPrintf("Testing with queue flags=0x%x", (unsigned int)flag_list[f]);
+
+        if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueMulti", OSAL_BLOCKCOUNT_C(4), sizeof(uint32), flag_list[f])))
+        {
+            /*-----------------------------------------------------*/
+            /* #2 Null-pointer-arg */
+
+            UT_RETVAL(OS_QueuePutMulti(queue_id, NULL, sizeof(uint32), sizes_out, 1, &count, 0), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), NULL, 1, &count, 0),
+                      OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), sizes_out, 1, NULL, 0),
+                      OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, NULL, sizeof(uint32), sizes_in, 1, &count, OS_CHECK),
+                      OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), NULL, 1, &count, OS_CHECK),
+                      OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 1, NULL, OS_CHECK),
+                      OS_INVALID_POINTER);
+
+            /*-----------------------------------------------------*/
+            /* #3 Invalid sizes */
+
+            UT_RETVAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), sizes_out, 0, &count, 0),
+                      OS_ERR_INVALID_SIZE);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 0, &count, OS_CHECK),
+                      OS_ERR_INVALID_SIZE);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, OSAL_SIZE_C(2), sizes_in, 1, &count, OS_CHECK),
+                      OS_QUEUE_INVALID_SIZE);
+
+            sizes_out[1] = 1 + sizeof(uint32);
+            UT_RETVAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), sizes_out, 2, &count, 0),
+                      OS_QUEUE_INVALID_SIZE);
+            UtAssert_UINT32_EQ(count, 0);
+            sizes_out[1] = sizeof(uint32);
+
+            /*-----------------------------------------------------*/
+            /* #4 Partial put when full, and gets in FIFO order */
+
+            UT_RETVAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), sizes_out, 6, &count, 0),
+                      OS_QUEUE_FULL);
+            UtAssert_UINT32_EQ(count, 4);
+
+            memset(queue_data_in, 0, sizeof(queue_data_in));
+            UT_NOMINAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 3, &count, OS_CHECK));
+            UtAssert_UINT32_EQ(count, 3);
+            for (i = 0; i < 3; ++i)
+            {
+                UtAssert_UINT32_EQ(queue_data_in[i], queue_data_out[i]);
+                UtAssert_UINT32_EQ(sizes_in[i], sizeof(uint32));
+            }
+
+            /* only the pending message is returned, without waiting for more */
+            UT_NOMINAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 3, &count, OS_PEND));
+            UtAssert_UINT32_EQ(count, 1);
+            UtAssert_UINT32_EQ(queue_data_in[0], queue_data_out[3]);
+
+            /*-----------------------------------------------------*/
+            /* #5 Empty queue */
+
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 3, &count, OS_CHECK),
+                      OS_QUEUE_EMPTY);
+            UtAssert_UINT32_EQ(count, 0);
+            UT_RETVAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 3, &count, 2),
+                      OS_QUEUE_TIMEOUT);
+            UtAssert_UINT32_EQ(count, 0);
+
+            /*-----------------------------------------------------*/
+            /* #6 Messages of different sizes, across the end of the queue storage */
+
+            sizes_out[0] = 2;
+            sizes_out[2] = 3;
+            UT_NOMINAL(OS_QueuePutMulti(queue_id, queue_data_out, sizeof(uint32), sizes_out, 4, &count, 0));
+            UtAssert_UINT32_EQ(count, 4);
+            UT_NOMINAL(OS_QueueGetMulti(queue_id, queue_data_in, sizeof(uint32), sizes_in, 6, &count, OS_CHECK));
+            UtAssert_UINT32_EQ(count, 4);
+            for (i = 0; i < 4; ++i)
+            {
+                UtAssert_UINT32_EQ(sizes_in[i], sizes_out[i]);
+                UtAssert_MemCmp(&queue_data_in[i], &queue_data_out[i], sizes_out[i], "Message %u content",
+                                (unsigned int)i);
+            }
+
+            sizes_out[0] = sizeof(uint32);
+            sizes_out[2] = sizeof(uint32);
+
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_QueueReserve(osal_id_t queue_id, void **data)
+**         int32 OS_QueueCommit(osal_id_t queue_id, void *data, size_t size)
+**         int32 OS_QueueCancel(osal_id_t queue_id, void *data)
+**         int32 OS_QueueBorrow(osal_id_t queue_id, const void **data, size_t *size, int32 timeout)
+**         int32 OS_QueueReturn(osal_id_t queue_id, const void *data)
+** Purpose: Zero-copy access to queue messages
+**          This is run with both types of queue, in case the implementation
+**          only supports direct access to the storage of one of them.
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_zerocopy_test()
+{
+    static const uint32 flag_list[] = {OS_QUEUE_FLAG_USERSPACE, OS_QUEUE_FLAG_SYSTEM};
+
+    osal_id_t   queue_id  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t   queue_id2 = OS_OBJECT_ID_UNDEFINED;
+    void *      reserved;
+    const void *borrowed;
+    const void *borrowed2;
+    uint32      queue_data_out;
+    uint32      queue_data_in;
+    size_t      data_size;
+    uint32 *    foreign_buf;
+    uint32      f;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-id-arg */
+
+    /* a buffer that was not obtained from any queue */
+    foreign_buf = malloc(sizeof(uint32));
+    if (!UtAssert_NOT_NULL(foreign_buf))
+    {
+        return;
+    }
+
+    *foreign_buf = 0;
+
+    UT_RETVAL(OS_QueueReserve(UT_OBJID_INCORRECT, &reserved), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueCommit(UT_OBJID_INCORRECT, foreign_buf, sizeof(uint32)), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueCancel(UT_OBJID_INCORRECT, foreign_buf), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueBorrow(UT_OBJID_INCORRECT, &borrowed, &data_size, OS_CHECK), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueReturn(UT_OBJID_INCORRECT, foreign_buf), OS_ERR_INVALID_ID);
+
+    for (f = 0; f < (sizeof(flag_list) / sizeof(flag_list[0])); ++f)
+    {
+        UtPrintf("Testing with queue flags=0x%x", (unsigned int)flag_list[f]);
+
+        if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueZC", OSAL_BLOCKCOUNT_C(4), sizeof(uint32), flag_list[f])))
+        {
+            /*-----------------------------------------------------*/
+            /* #2 Null-pointer-arg */
+
+            UT_RETVAL(OS_QueueReserve(queue_id, NULL), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueCommit(queue_id, NULL, sizeof(uint32)), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueCancel(queue_id, NULL), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueBorrow(queue_id, NULL, &data_size, OS_CHECK), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueBorrow(queue_id, &borrowed, NULL, OS_CHECK), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueReturn(queue_id, NULL), OS_INVALID_POINTER);
+
+            /*-----------------------------------------------------*/
+            /* #3 Nominal round trip, interoperating with put/get */
+
+            if (UT_SETUP(OS_QueueReserve(queue_id, &reserved)))
+            {
+                UT_RETVAL(OS_QueueCommit(queue_id, reserved, 1 + sizeof(uint32)), OS_QUEUE_INVALID_SIZE);
+
+                queue_data_out = 0x11223344;
+                memcpy(reserved, &queue_data_out, sizeof(queue_data_out));
+                UT_NOMINAL(OS_QueueCommit(queue_id, reserved, sizeof(uint32)));
+            }
+
+            queue_data_out = 0x55667788;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+
+            if (UT_SETUP(OS_QueueBorrow(queue_id, &borrowed, &data_size, OS_PEND)))
+            {
+                UtAssert_UINT32_EQ(data_size, sizeof(uint32));
+                memcpy(&queue_data_in, borrowed, sizeof(queue_data_in));
+                UtAssert_UINT32_EQ(queue_data_in, 0x11223344);
+
+                /* other messages can still be received while one is borrowed */
+                UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK));
+                UtAssert_UINT32_EQ(queue_data_in, 0x55667788);
+
+                UT_NOMINAL(OS_QueueReturn(queue_id, borrowed));
+            }
+
+            /*-----------------------------------------------------*/
+            /* #4 Empty queue */
+
+            UT_RETVAL(OS_QueueBorrow(queue_id, &borrowed, &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+            UtAssert_NULL(borrowed);
+            UtAssert_ZERO(data_size);
+            UT_RETVAL(OS_QueueBorrow(queue_id, &borrowed, &data_size, 2), OS_QUEUE_TIMEOUT);
+
+            /*-----------------------------------------------------*/
+            /* #5 Buffers not owned by the caller */
+
+            UT_RETVAL(OS_QueueCommit(queue_id, foreign_buf, sizeof(uint32)), OS_ERR_INVALID_ARGUMENT);
+            UT_RETVAL(OS_QueueCancel(queue_id, foreign_buf), OS_ERR_INVALID_ARGUMENT);
+            UT_RETVAL(OS_QueueReturn(queue_id, foreign_buf), OS_ERR_INVALID_ARGUMENT);
+
+            if (UT_SETUP(OS_QueueCreate(&queue_id2, "QueueZC2", OSAL_BLOCKCOUNT_C(4), sizeof(uint32), flag_list[f])))
+            {
+                if (UT_SETUP(OS_QueueReserve(queue_id, &reserved)))
+                {
+                    /* a reserved buffer can only be committed to its own queue, and not returned */
+                    UT_RETVAL(OS_QueueCommit(queue_id2, reserved, sizeof(uint32)), OS_ERR_INVALID_ARGUMENT);
+                    UT_RETVAL(OS_QueueReturn(queue_id, reserved), OS_ERR_INCORRECT_OBJ_STATE);
+
+                    /* it is still reserved after the failed attempts */
+                    queue_data_out = 0x99AABBCC;
+                    memcpy(reserved, &queue_data_out, sizeof(queue_data_out));
+                    UT_NOMINAL(OS_QueueCommit(queue_id, reserved, sizeof(uint32)));
+                }
+
+                if (UT_SETUP(OS_QueueBorrow(queue_id, &borrowed2, &data_size, OS_CHECK)))
+                {
+                    /* a borrowed buffer can only be returned to its own queue, and not committed */
+                    UT_RETVAL(OS_QueueReturn(queue_id2, borrowed2), OS_ERR_INVALID_ARGUMENT);
+                    UT_RETVAL(OS_QueueCommit(queue_id, (void *)borrowed2, sizeof(uint32)),
+                              OS_ERR_INCORRECT_OBJ_STATE);
+
+                    /* it is still borrowed after the failed attempts */
+                    memcpy(&queue_data_in, borrowed2, sizeof(queue_data_in));
+                    UtAssert_UINT32_EQ(queue_data_in, 0x99AABBCC);
+                    UT_NOMINAL(OS_QueueReturn(queue_id, borrowed2));
+                }
+
+                UT_TEARDOWN(OS_QueueDelete(queue_id2));
+            }
+
+            /*-----------------------------------------------------*/
+            /* #6 Buffers passed back twice */
+
+            /*
+             * The buffer is no longer owned by the caller after the first call.  Depending
+             * on whether the queue storage is accessed directly, the buffer is either still
+             * part of the queue in another state, or not known to the queue at all.
+             */
+            if (UT_SETUP(OS_QueueReserve(queue_id, &reserved)))
+            {
+                queue_data_out = 0xDDEEFF00;
+                memcpy(reserved, &queue_data_out, sizeof(queue_data_out));
+                UT_NOMINAL(OS_QueueCommit(queue_id, reserved, sizeof(uint32)));
+                UtAssert_True(OS_QueueCommit(queue_id, reserved, sizeof(uint32)) != OS_SUCCESS,
+                              "OS_QueueCommit() of committed buffer fails");
+            }
+
+            if (UT_SETUP(OS_QueueBorrow(queue_id, &borrowed, &data_size, OS_CHECK)))
+            {
+                memcpy(&queue_data_in, borrowed, sizeof(queue_data_in));
+                UtAssert_UINT32_EQ(queue_data_in, 0xDDEEFF00);
+                UT_NOMINAL(OS_QueueReturn(queue_id, borrowed));
+                UtAssert_True(OS_QueueReturn(queue_id, borrowed) != OS_SUCCESS,
+                              "OS_QueueReturn() of returned buffer fails");
+            }
+
+            UT_RETVAL(OS_QueueBorrow(queue_id, &borrowed, &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+            /*-----------------------------------------------------*/
+            /* #7 Cancelled reservations */
+
+            if (UT_SETUP(OS_QueueReserve(queue_id, &reserved)))
+            {
+                UT_NOMINAL(OS_QueueCancel(queue_id, reserved));
+                UtAssert_True(OS_QueueCancel(queue_id, reserved) != OS_SUCCESS,
+                              "OS_QueueCancel() of cancelled buffer fails");
+                UtAssert_True(OS_QueueCommit(queue_id, reserved, sizeof(uint32)) != OS_SUCCESS,
+                              "OS_QueueCommit() of cancelled buffer fails");
+            }
+
+            UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+            /* a cancelled reservation between two messages does not hold up the second one */
+            queue_data_out = 0x01020304;
+            UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+
+            if (UT_SETUP(OS_QueueReserve(queue_id, &reserved)))
+            {
+                queue_data_out = 0x05060708;
+                UT_NOMINAL(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+                UT_NOMINAL(OS_QueueCancel(queue_id, reserved));
+            }
+
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK));
+            UtAssert_UINT32_EQ(queue_data_in, 0x01020304);
+            UT_NOMINAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK));
+            UtAssert_UINT32_EQ(queue_data_in, 0x05060708);
+            UT_RETVAL(OS_QueueGet(queue_id, &queue_data_in, sizeof(uint32), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+            /* a reservation that is not passed back is released when the queue is deleted */
+            UT_SETUP(OS_QueueReserve(queue_id, &reserved));
+
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+    }
+
+    free(foreign_buf);
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_queue_test.c
 **================================================================================*/
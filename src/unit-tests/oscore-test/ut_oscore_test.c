@@ -224,6 +224,9 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_queue_get_test, NULL, NULL, "OS_QueueGet");
     UtTest_Add(UT_os_queue_get_id_by_name_test, NULL, NULL, "OS_QueueGetIdByName");
     UtTest_Add(UT_os_queue_get_info_test, NULL, NULL, "OS_QueueGetInfo");
+    UtTest_Add(UT_os_queue_flags_test, NULL, NULL, "OS_QueueCreate flags");
+    UtTest_Add(UT_os_queue_multi_test, NULL, NULL, "OS_QueuePutMulti/GetMulti");
+    UtTest_Add(UT_os_queue_zerocopy_test, NULL, NULL, "OS_QueueReserve/Commit/Cancel/Borrow/Return");
 
     UtTest_Add(UT_os_select_fd_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectFd");
     UtTest_Add(UT_os_select_single_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectSingle");
@@ -246,8 +249,10 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_statustostring_test, NULL, NULL, "OS_StatusToString");
 
     UtTest_Add(UT_os_getlocaltime_test, NULL, NULL, "OS_GetLocalTime");
+    UtTest_Add(UT_os_getmonotonictime_test, NULL, NULL, "OS_GetMonotonicTime");
     UtTest_Add(UT_os_setlocaltime_test, NULL, NULL, "OS_SetLocalTime");
 
+    UtTest_Add(UT_os_heapalloc_test, NULL, NULL, "OS_HeapAlloc");
     UtTest_Add(UT_os_heapgetinfo_test, NULL, NULL, "OS_HeapGetInfo");
 }
 
@@ -689,6 +689,223 @@ void UT_os_writefile_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+**         int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+** Purpose: Reads/writes nBytes at the given offset of the file of a given file descriptor,
+**          without moving the read/write pointer
+** Parameters: filedes - a file descriptor
+**             *buffer - pointer that holds the data read from or to be written to file
+**             nbytes - the maximum number of bytes to transfer
+**             offset - the offset in the file of the first byte to transfer
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the size is zero
+**          OS_ERR_INVALID_ARGUMENT if the offset is negative
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          OS_ERROR if the OS call failed
+**          The number of bytes transferred if succeeded
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call these routines with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call these routines with invalid file descriptors as argument
+**   2) Expect the returned values to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Invalid-offset-arg condition
+**   1) Call these routines with a negative offset
+**   2) Expect the returned values to be
+**        (a) OS_ERR_INVALID_ARGUMENT
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_OpenCreate() to create and open a file
+**   2) Call OS_pwrite() to write the second part of a message, then the first part
+**   3) Expect the read/write pointer to still be at the start of the file
+**   4) Call OS_pread() to read the second part back
+**   5) Call OS_read() to read the whole message, and OS_pread() past the end of file
+**   6) Expect the message to be intact, and the read past the end of file to return 0
+**--------------------------------------------------------------------------------*/
+void UT_os_preadwritefile_test()
+{
+    /*-----------------------------------------------------*/
+    /* #1 Null-pointer-arg */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/PRW_Args.txt", g_mntName);
+
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_RETVAL(OS_pread(g_fDescs[0], NULL, sizeof(g_readBuff), 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], NULL, sizeof(g_writeBuff), 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 0, 0), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], g_writeBuff, 0, 0), OS_ERR_INVALID_SIZE);
+
+        /*-----------------------------------------------------*/
+        /* #3 Invalid-offset-arg */
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), -1), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], g_writeBuff, sizeof(g_writeBuff), -1), OS_ERR_INVALID_ARGUMENT);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-file-desc-arg */
+    UT_RETVAL(OS_pread(UT_OBJID_INCORRECT, g_readBuff, sizeof(g_readBuff), 0), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_pwrite(OS_OBJECT_ID_UNDEFINED, g_writeBuff, sizeof(g_writeBuff), 0), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/PRW_Nom.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+        strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+
+        /* write the second half first, leaving the read/write pointer alone */
+        UT_RETVAL(OS_pwrite(g_fDescs[0], &g_writeBuff[18], strlen(g_writeBuff) - 18, 18), strlen(g_writeBuff) - 18);
+        UT_RETVAL(OS_pwrite(g_fDescs[0], g_writeBuff, 18, 0), 18);
+        UT_RETVAL(OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR), 0);
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 10, 18), 10);
+        UtAssert_StrCmp(g_readBuff, "MY KINGDOM", "%s == MY KINGDOM", g_readBuff);
+        UT_RETVAL(OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR), 0);
+
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        UT_RETVAL(OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)), strlen(g_writeBuff));
+        UtAssert_StrCmp(g_readBuff, g_writeBuff, "%s == %s", g_readBuff, g_writeBuff);
+
+        /* confirm that pread returns 0 at end of file */
+        UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), strlen(g_writeBuff)), 0);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t len, uint32 access, void **addr)
+**         int32 OS_FileUnmap(osal_id_t filedes, void *addr)
+** Purpose: Maps part of the file of a given file descriptor into memory, and removes the mapping
+** Parameters: filedes - a file descriptor
+**             offset - the offset in the file of the first byte to map
+**             len - the number of bytes to map
+**             access - the OS_FILE_MAP_* access and hint flags
+**             *addr - pointer that holds the address of the mapping
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the size is zero or the range extends past the end of file
+**          OS_ERR_INVALID_ARGUMENT if the offset is negative, the access flags are invalid,
+**                                  or the address is not a mapping of the file
+**          OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+**          OS_ERR_NO_FREE_IDS if the file already has the maximum number of mappings
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Invalid-arg condition
+**   1) Call these routines with a null pointer, zero size, negative offset or bad access flags
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER, OS_ERR_INVALID_SIZE or OS_ERR_INVALID_ARGUMENT
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call these routines with invalid file descriptors as argument
+**   2) Expect the returned values to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_OpenCreate() to create and open a file, and OS_write() to write a message
+**   2) Call OS_FileMap() to map part of the message for reading
+**   3) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   4) Expect the mapped memory to hold that part of the message
+**   5) Map another part for writing, change it, and call OS_FileUnmap()
+**   6) Expect OS_pread() to return the changed message
+**   7) Map the file until no mappings are left, then call OS_close() with the mappings in place
+**--------------------------------------------------------------------------------*/
+void UT_os_mapfile_test()
+{
+    void * addr;
+    void * rd_addr;
+    void * wr_addr;
+    uint32 i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-arg */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Map_Args.txt", g_mntName);
+
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_READ, NULL), OS_INVALID_POINTER);
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 0, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_FileMap(g_fDescs[0], -1, 1, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_SEQUENTIAL, &addr), OS_ERR_INVALID_ARGUMENT);
+        UT_RETVAL(OS_FileUnmap(g_fDescs[0], NULL), OS_INVALID_POINTER);
+        UT_RETVAL(OS_FileUnmap(g_fDescs[0], g_readBuff), OS_ERR_INVALID_ARGUMENT);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-file-desc-arg */
+    UT_RETVAL(OS_FileMap(UT_OBJID_INCORRECT, 0, 1, OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_FileUnmap(OS_OBJECT_ID_UNDEFINED, g_readBuff), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal */
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Map_Nom.txt", g_mntName);
+    if (UT_SETUP(OS_OpenCreate(&g_fDescs[0], g_fNames[0], OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+        strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+        UT_RETVAL(OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)), strlen(g_writeBuff));
+
+        rd_addr = NULL;
+        if (UT_NOMINAL_OR_NOTIMPL(
+                OS_FileMap(g_fDescs[0], 18, 10, OS_FILE_MAP_READ | OS_FILE_MAP_SEQUENTIAL, &rd_addr)))
+        {
+            UtAssert_True(memcmp(rd_addr, "MY KINGDOM", 10) == 0, "Mapped memory holds MY KINGDOM");
+
+            /* The range must be within the file */
+            UT_RETVAL(OS_FileMap(g_fDescs[0], 18, sizeof(g_writeBuff), OS_FILE_MAP_READ, &addr), OS_ERR_INVALID_SIZE);
+
+            UT_NOMINAL(OS_FileMap(g_fDescs[0], 2, 5, OS_FILE_MAP_READ | OS_FILE_MAP_WRITE | OS_FILE_MAP_WILLNEED,
+                                  &wr_addr));
+            memcpy(wr_addr, "MOUSE", 5);
+            UT_NOMINAL(OS_FileUnmap(g_fDescs[0], wr_addr));
+            UT_RETVAL(OS_FileUnmap(g_fDescs[0], wr_addr), OS_ERR_INVALID_ARGUMENT);
+
+            memset(g_readBuff, '\0', sizeof(g_readBuff));
+            UT_RETVAL(OS_pread(g_fDescs[0], g_readBuff, 8, 0), 8);
+            UtAssert_StrCmp(g_readBuff, "A MOUSE!", "%s == A MOUSE!", g_readBuff);
+
+            UT_NOMINAL(OS_FileUnmap(g_fDescs[0], rd_addr));
+
+            /* Use up all the mappings, and leave them for OS_close() to remove */
+            for (i = 0; i < OS_MAX_FILE_MAPPINGS; ++i)
+            {
+                UT_NOMINAL(OS_FileMap(g_fDescs[0], i, 1, OS_FILE_MAP_READ, &addr));
+            }
+            UT_RETVAL(OS_FileMap(g_fDescs[0], 0, 1, OS_FILE_MAP_READ, &addr), OS_ERR_NO_FREE_IDS);
+        }
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(g_fDescs[0]));
+        UT_TEARDOWN(OS_remove(g_fNames[0]));
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
 ** Purpose: Moves the read/write pointer of a given file descriptor to the given offset
@@ -60,6 +60,8 @@ void UT_os_closefile_test(void);
 
 void UT_os_readfile_test(void);
 void UT_os_writefile_test(void);
+void UT_os_preadwritefile_test(void);
+void UT_os_mapfile_test(void);
 void UT_os_lseekfile_test(void);
 
 void UT_os_chmodfile_test(void);
@@ -152,6 +152,8 @@ void UtTest_Setup(void)
 
         UtTest_Add(UT_os_readfile_test, NULL, NULL, "OS_read");
         UtTest_Add(UT_os_writefile_test, NULL, NULL, "OS_write");
+        UtTest_Add(UT_os_preadwritefile_test, NULL, NULL, "OS_pread/OS_pwrite");
+        UtTest_Add(UT_os_mapfile_test, NULL, NULL, "OS_FileMap/OS_FileUnmap");
         UtTest_Add(UT_os_lseekfile_test, NULL, NULL, "OS_lseek");
 
         UtTest_Add(UT_os_chmodfile_test, NULL, NULL, "OS_chmod");
@@ -765,6 +765,9 @@ void UT_os_translatepath_test()
 
             /* Reset test environment */
             UT_TEARDOWN(OS_unmount(g_mntNames[4]));
+
+            /* The path must no longer translate once unmounted */
+            UT_RETVAL(OS_TranslatePath(g_mntNames[4], localPath), OS_FS_ERR_PATH_INVALID);
         }
         /* Reset test environment */
         UT_TEARDOWN(OS_rmfs(g_devNames[4]));
@@ -26,6 +26,7 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_OS_GetLocalTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GetMonotonicTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_SetLocalTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -44,6 +45,22 @@ int32 OS_GetLocalTime(OS_time_t *time_struct)
     return UT_GenStub_GetReturnValue(OS_GetLocalTime, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetMonotonicTime()
+ * ----------------------------------------------------
+ */
+int32 OS_GetMonotonicTime(OS_time_t *time_struct)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetMonotonicTime, int32);
+
+    UT_GenStub_AddParam(OS_GetMonotonicTime, OS_time_t *, time_struct);
+
+    UT_GenStub_Execute(OS_GetMonotonicTime, Basic, UT_DefaultHandler_OS_GetMonotonicTime);
+
+    return UT_GenStub_GetReturnValue(OS_GetMonotonicTime, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SetLocalTime()
@@ -162,6 +162,74 @@ void UT_DefaultHandler_OS_write(void *UserObj, UT_EntryKey_t FuncKey, const UT_S
     UT_GenericWriteStub(FuncKey, Context);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pread' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pread(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericReadStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pwrite' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pwrite(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericWriteStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_FileMap' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_FileMap(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **addr = UT_Hook_GetArgValueByName(Context, "addr", void **);
+    void * buffer;
+    int32  status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* The test case should supply the mapped memory via UT_SetDataBuffer() */
+        UT_GetDataBuffer(FuncKey, &buffer, NULL, NULL);
+        if (buffer == NULL)
+        {
+            status = OS_ERROR;
+        }
+        else
+        {
+            *addr = buffer;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_AsyncWaitCompletion' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_AsyncWaitCompletion(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_async_completion_t *completion = UT_Hook_GetArgValueByName(Context, "completion", OS_async_completion_t *);
+    int32                  status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    /* The test case may supply the completion to output via UT_SetDataBuffer() */
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_AsyncWaitCompletion), completion, sizeof(*completion)) < sizeof(*completion))
+    {
+        memset(completion, 0, sizeof(*completion));
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_TimedRead' stub
@@ -182,6 +250,57 @@ void UT_DefaultHandler_OS_TimedWrite(void *UserObj, UT_EntryKey_t FuncKey, const
     UT_GenericWriteStub(FuncKey, Context);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_readv' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_readv(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const OS_iovec_t *iov    = UT_Hook_GetArgValueByName(Context, "iov", const OS_iovec_t *);
+    uint32            iovcnt = UT_Hook_GetArgValueByName(Context, "iovcnt", uint32);
+    int32             status;
+    uint32            i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* generate fill data and pretend all segments were read */
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            memset(iov[i].Buffer, 0, iov[i].Length);
+            status += iov[i].Length;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_writev' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_writev(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const OS_iovec_t *iov    = UT_Hook_GetArgValueByName(Context, "iov", const OS_iovec_t *);
+    uint32            iovcnt = UT_Hook_GetArgValueByName(Context, "iovcnt", uint32);
+    int32             status;
+    uint32            i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* pretend the full length of all segments was written */
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].Length;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_stat' stub
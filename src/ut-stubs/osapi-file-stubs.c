@@ -25,15 +25,137 @@
 #include "osapi-file.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_AsyncWaitCompletion(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_FDGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_FileMap(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_OpenCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimedRead(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimedWrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_close(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_lseek(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pread(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pwrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_read(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_readv(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_stat(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_write(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_writev(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncReadSubmit()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncReadSubmit(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset, void *user_arg)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncReadSubmit, int32);
+
+    UT_GenStub_AddParam(OS_AsyncReadSubmit, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_AsyncReadSubmit, void *, buffer);
+    UT_GenStub_AddParam(OS_AsyncReadSubmit, size_t, nbytes);
+    UT_GenStub_AddParam(OS_AsyncReadSubmit, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_AsyncReadSubmit, void *, user_arg);
+
+    UT_GenStub_Execute(OS_AsyncReadSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncReadSubmit, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWaitCompletion()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWaitCompletion(osal_id_t filedes, OS_async_completion_t *completion, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWaitCompletion, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion, OS_async_completion_t *, completion);
+    UT_GenStub_AddParam(OS_AsyncWaitCompletion, int32, msecs);
+
+    UT_GenStub_Execute(OS_AsyncWaitCompletion, Basic, UT_DefaultHandler_OS_AsyncWaitCompletion);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWaitCompletion, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWriteSubmit()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWriteSubmit(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset, void *user_arg)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWriteSubmit, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWriteSubmit, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_AsyncWriteSubmit, const void *, buffer);
+    UT_GenStub_AddParam(OS_AsyncWriteSubmit, size_t, nbytes);
+    UT_GenStub_AddParam(OS_AsyncWriteSubmit, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_AsyncWriteSubmit, void *, user_arg);
+
+    UT_GenStub_Execute(OS_AsyncWriteSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWriteSubmit, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileCopyRange()
+ * ----------------------------------------------------
+ */
+int32 OS_FileCopyRange(osal_id_t src_fd, osal_offset_t src_off, osal_id_t dst_fd, osal_offset_t dst_off,
+                       osal_offset_t len)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileCopyRange, int32);
+
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_id_t, src_fd);
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_offset_t, src_off);
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_id_t, dst_fd);
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_offset_t, dst_off);
+    UT_GenStub_AddParam(OS_FileCopyRange, osal_offset_t, len);
+
+    UT_GenStub_Execute(OS_FileCopyRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileCopyRange, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap(osal_id_t filedes, osal_offset_t offset, size_t len, uint32 access, void **addr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap, int32);
+
+    UT_GenStub_AddParam(OS_FileMap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileMap, osal_offset_t, offset);
+    UT_GenStub_AddParam(OS_FileMap, size_t, len);
+    UT_GenStub_AddParam(OS_FileMap, uint32, access);
+    UT_GenStub_AddParam(OS_FileMap, void **, addr);
+
+    UT_GenStub_Execute(OS_FileMap, Basic, UT_DefaultHandler_OS_FileMap);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap(osal_id_t filedes, void *addr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileUnmap, void *, addr);
+
+    UT_GenStub_Execute(OS_FileUnmap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap, int32);
+}
 
 /*
  * ----------------------------------------------------
@@ -278,6 +400,44 @@ int32 OS_mv(const char *src, const char *dest)
     return UT_GenStub_GetReturnValue(OS_mv, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pread()
+ * ----------------------------------------------------
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pread, int32);
+
+    UT_GenStub_AddParam(OS_pread, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pread, void *, buffer);
+    UT_GenStub_AddParam(OS_pread, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pread, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_pread, Basic, UT_DefaultHandler_OS_pread);
+
+    return UT_GenStub_GetReturnValue(OS_pread, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pwrite()
+ * ----------------------------------------------------
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, osal_offset_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pwrite, int32);
+
+    UT_GenStub_AddParam(OS_pwrite, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pwrite, const void *, buffer);
+    UT_GenStub_AddParam(OS_pwrite, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pwrite, osal_offset_t, offset);
+
+    UT_GenStub_Execute(OS_pwrite, Basic, UT_DefaultHandler_OS_pwrite);
+
+    return UT_GenStub_GetReturnValue(OS_pwrite, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_read()
@@ -296,6 +456,24 @@ int32 OS_read(osal_id_t filedes, void *buffer, size_t nbytes)
     return UT_GenStub_GetReturnValue(OS_read, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_readv()
+ * ----------------------------------------------------
+ */
+int32 OS_readv(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    UT_GenStub_SetupReturnBuffer(OS_readv, int32);
+
+    UT_GenStub_AddParam(OS_readv, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_readv, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_readv, uint32, iovcnt);
+
+    UT_GenStub_Execute(OS_readv, Basic, UT_DefaultHandler_OS_readv);
+
+    return UT_GenStub_GetReturnValue(OS_readv, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_remove()
@@ -363,3 +541,21 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
 
     return UT_GenStub_GetReturnValue(OS_write, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_writev()
+ * ----------------------------------------------------
+ */
+int32 OS_writev(osal_id_t filedes, const OS_iovec_t *iov, uint32 iovcnt)
+{
+    UT_GenStub_SetupReturnBuffer(OS_writev, int32);
+
+    UT_GenStub_AddParam(OS_writev, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_writev, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_writev, uint32, iovcnt);
+
+    UT_GenStub_Execute(OS_writev, Basic, UT_DefaultHandler_OS_writev);
+
+    return UT_GenStub_GetReturnValue(OS_writev, int32);
+}
@@ -52,3 +52,43 @@ void UT_DefaultHandler_OS_HeapGetInfo(void *UserObj, UT_EntryKey_t FuncKey, cons
         heap_prop->largest_free_block = OSAL_SIZE_C(100);
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_HeapAlloc' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_HeapAlloc(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **ptr = UT_Hook_GetArgValueByName(Context, "ptr", void **);
+    void * buffer;
+    int32  status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        /* The test case should supply the memory to hand out via UT_SetDataBuffer() */
+        UT_GetDataBuffer(FuncKey, &buffer, NULL, NULL);
+        *ptr = buffer;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_HeapGetTaskUsage' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_HeapGetTaskUsage(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    size_t *bytes = UT_Hook_GetArgValueByName(Context, "bytes", size_t *);
+    int32   status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_HeapGetTaskUsage), bytes, sizeof(*bytes)) < sizeof(*bytes))
+    {
+        *bytes = 0;
+    }
+}
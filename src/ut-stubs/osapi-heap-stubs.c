@@ -25,7 +25,42 @@
 #include "osapi-heap.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_HeapAlloc(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_HeapGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_HeapGetTaskUsage(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_HeapAlloc()
+ * ----------------------------------------------------
+ */
+int32 OS_HeapAlloc(void **ptr, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_HeapAlloc, int32);
+
+    UT_GenStub_AddParam(OS_HeapAlloc, void **, ptr);
+    UT_GenStub_AddParam(OS_HeapAlloc, size_t, size);
+
+    UT_GenStub_Execute(OS_HeapAlloc, Basic, UT_DefaultHandler_OS_HeapAlloc);
+
+    return UT_GenStub_GetReturnValue(OS_HeapAlloc, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_HeapFree()
+ * ----------------------------------------------------
+ */
+int32 OS_HeapFree(void *ptr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_HeapFree, int32);
+
+    UT_GenStub_AddParam(OS_HeapFree, void *, ptr);
+
+    UT_GenStub_Execute(OS_HeapFree, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_HeapFree, int32);
+}
 
 /*
  * ----------------------------------------------------
@@ -42,3 +77,20 @@ int32 OS_HeapGetInfo(OS_heap_prop_t *heap_prop)
 
     return UT_GenStub_GetReturnValue(OS_HeapGetInfo, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_HeapGetTaskUsage()
+ * ----------------------------------------------------
+ */
+int32 OS_HeapGetTaskUsage(osal_id_t task_id, size_t *bytes)
+{
+    UT_GenStub_SetupReturnBuffer(OS_HeapGetTaskUsage, int32);
+
+    UT_GenStub_AddParam(OS_HeapGetTaskUsage, osal_id_t, task_id);
+    UT_GenStub_AddParam(OS_HeapGetTaskUsage, size_t *, bytes);
+
+    UT_GenStub_Execute(OS_HeapGetTaskUsage, Basic, UT_DefaultHandler_OS_HeapGetTaskUsage);
+
+    return UT_GenStub_GetReturnValue(OS_HeapGetTaskUsage, int32);
+}
@@ -130,3 +130,20 @@ int32 OS_ObjectIdToArrayIndex(osal_objtype_t idtype, osal_id_t object_id, osal_i
 
     return UT_GenStub_GetReturnValue(OS_ObjectIdToArrayIndex, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectTypeGetLockStats()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectTypeGetLockStats(osal_objtype_t idtype, OS_lock_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectTypeGetLockStats, int32);
+
+    UT_GenStub_AddParam(OS_ObjectTypeGetLockStats, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectTypeGetLockStats, OS_lock_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_ObjectTypeGetLockStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectTypeGetLockStats, int32);
+}
@@ -0,0 +1,138 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * \file
+ *
+ * Stub implementations for the functions defined in the OSAL API
+ *
+ * The stub implementation can be used for unit testing applications built
+ * on top of OSAL.  The stubs do not do any real function, but allow
+ * the return code to be crafted such that error paths in the application
+ * can be executed.
+ */
+
+#include "osapi-mempool.h" /* OSAL public API for this subsystem */
+#include "utstub-helpers.h"
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_MemPoolCreate' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_MemPoolCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pool_id = UT_Hook_GetArgValueByName(Context, "pool_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *pool_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_MEMPOOL);
+    }
+    else
+    {
+        *pool_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_MemPoolDelete' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_MemPoolDelete(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t pool_id = UT_Hook_GetArgValueByName(Context, "pool_id", osal_id_t);
+    int32     status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        UT_DeleteStubObjId(OS_OBJECT_TYPE_OS_MEMPOOL, pool_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_MemPoolGet' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_MemPoolGet(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **block = UT_Hook_GetArgValueByName(Context, "block", void **);
+    void * buffer;
+    int32  status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* The test case should supply the block to hand out via UT_SetDataBuffer() */
+        UT_GetDataBuffer(FuncKey, &buffer, NULL, NULL);
+        if (buffer == NULL)
+        {
+            status = OS_ERROR_TIMEOUT;
+        }
+        else
+        {
+            *block = buffer;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_MemPoolGetIdByName' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_MemPoolGetIdByName(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pool_id = UT_Hook_GetArgValueByName(Context, "pool_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_MemPoolGetIdByName), pool_id, sizeof(*pool_id)) < sizeof(*pool_id))
+    {
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_MEMPOOL, pool_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_MemPoolGetInfo' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_MemPoolGetInfo(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_mempool_prop_t *pool_prop = UT_Hook_GetArgValueByName(Context, "pool_prop", OS_mempool_prop_t *);
+    int32              status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_MemPoolGetInfo), pool_prop, sizeof(*pool_prop)) < sizeof(*pool_prop))
+    {
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_TASK, &pool_prop->creator);
+        strncpy(pool_prop->name, "Name", sizeof(pool_prop->name) - 1);
+        pool_prop->name[sizeof(pool_prop->name) - 1] = '\0';
+    }
+}
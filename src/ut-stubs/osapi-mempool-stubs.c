@@ -0,0 +1,136 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in osapi-mempool header
+ */
+
+#include "osapi-mempool.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_OS_MemPoolCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_MemPoolDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_MemPoolGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_MemPoolGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_MemPoolGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolCreate()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolCreate(osal_id_t *pool_id, const char *pool_name, size_t block_size, osal_blockcount_t num_blocks)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolCreate, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolCreate, osal_id_t *, pool_id);
+    UT_GenStub_AddParam(OS_MemPoolCreate, const char *, pool_name);
+    UT_GenStub_AddParam(OS_MemPoolCreate, size_t, block_size);
+    UT_GenStub_AddParam(OS_MemPoolCreate, osal_blockcount_t, num_blocks);
+
+    UT_GenStub_Execute(OS_MemPoolCreate, Basic, UT_DefaultHandler_OS_MemPoolCreate);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolCreate, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolDelete()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolDelete(osal_id_t pool_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolDelete, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolDelete, osal_id_t, pool_id);
+
+    UT_GenStub_Execute(OS_MemPoolDelete, Basic, UT_DefaultHandler_OS_MemPoolDelete);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolDelete, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolGet()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolGet(osal_id_t pool_id, void **block, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolGet, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolGet, osal_id_t, pool_id);
+    UT_GenStub_AddParam(OS_MemPoolGet, void **, block);
+    UT_GenStub_AddParam(OS_MemPoolGet, int32, timeout);
+
+    UT_GenStub_Execute(OS_MemPoolGet, Basic, UT_DefaultHandler_OS_MemPoolGet);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolGet, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolGetIdByName()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolGetIdByName(osal_id_t *pool_id, const char *pool_name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolGetIdByName, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolGetIdByName, osal_id_t *, pool_id);
+    UT_GenStub_AddParam(OS_MemPoolGetIdByName, const char *, pool_name);
+
+    UT_GenStub_Execute(OS_MemPoolGetIdByName, Basic, UT_DefaultHandler_OS_MemPoolGetIdByName);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolGetIdByName, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolGetInfo()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolGetInfo(osal_id_t pool_id, OS_mempool_prop_t *pool_prop)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolGetInfo, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolGetInfo, osal_id_t, pool_id);
+    UT_GenStub_AddParam(OS_MemPoolGetInfo, OS_mempool_prop_t *, pool_prop);
+
+    UT_GenStub_Execute(OS_MemPoolGetInfo, Basic, UT_DefaultHandler_OS_MemPoolGetInfo);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolGetInfo, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MemPoolPut()
+ * ----------------------------------------------------
+ */
+int32 OS_MemPoolPut(osal_id_t pool_id, void *block)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MemPoolPut, int32);
+
+    UT_GenStub_AddParam(OS_MemPoolPut, osal_id_t, pool_id);
+    UT_GenStub_AddParam(OS_MemPoolPut, void *, block);
+
+    UT_GenStub_Execute(OS_MemPoolPut, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MemPoolPut, int32);
+}
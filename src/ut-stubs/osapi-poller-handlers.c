@@ -0,0 +1,119 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Stub implementations for the functions defined in the OSAL API
+ *
+ * The stub implementation can be used for unit testing applications built
+ * on top of OSAL.  The stubs do not do any real function, but allow
+ * the return code to be crafted such that error paths in the application
+ * can be executed.
+ */
+
+#include "osapi-poller.h" /* OSAL public API for this subsystem */
+#include "utstub-helpers.h"
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollerCreate' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollerCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *poller_id = UT_Hook_GetArgValueByName(Context, "poller_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *poller_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_POLLER);
+    }
+    else
+    {
+        *poller_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollerDelete' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollerDelete(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t poller_id = UT_Hook_GetArgValueByName(Context, "poller_id", osal_id_t);
+    int32     status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        UT_DeleteStubObjId(OS_OBJECT_TYPE_OS_POLLER, poller_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Common handler for the 'OS_PollerWait' and 'OS_PollerWaitAbs' stubs
+ *
+ * Outputs the events from the data buffer supplied by the test case, if any
+ * -----------------------------------------------------------------
+ */
+static void UT_PollerWaitHandler(UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_poller_event_t *events     = UT_Hook_GetArgValueByName(Context, "events", OS_poller_event_t *);
+    uint32             max_events = UT_Hook_GetArgValueByName(Context, "max_events", uint32);
+    uint32            *num_events = UT_Hook_GetArgValueByName(Context, "num_events", uint32 *);
+    int32              status;
+
+    *num_events = 0;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        *num_events = UT_Stub_CopyToLocal(FuncKey, events, max_events * sizeof(*events)) / sizeof(*events);
+        if (*num_events == 0)
+        {
+            status = OS_ERROR_TIMEOUT;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollerWait' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollerWait(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_PollerWaitHandler(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollerWaitAbs' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollerWaitAbs(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_PollerWaitHandler(FuncKey, Context);
+}
@@ -45,6 +45,22 @@ void OS_printf(const char *string, ...)
     va_end(UtStub_ArgList);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_printf_SetMode()
+ * ----------------------------------------------------
+ */
+int32 OS_printf_SetMode(uint32 mode)
+{
+    UT_GenStub_SetupReturnBuffer(OS_printf_SetMode, int32);
+
+    UT_GenStub_AddParam(OS_printf_SetMode, uint32, mode);
+
+    UT_GenStub_Execute(OS_printf_SetMode, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_printf_SetMode, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_printf_disable()
@@ -117,6 +117,125 @@ void UT_DefaultHandler_OS_QueuePut(void *UserObj, UT_EntryKey_t FuncKey, const U
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueuePutMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueuePutMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32  count     = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    uint32 *count_put = UT_Hook_GetArgValueByName(Context, "count_put", uint32 *);
+    int32   status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *count_put = count;
+    }
+    else
+    {
+        *count_put = 0;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *  data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t  stride       = UT_Hook_GetArgValueByName(Context, "stride", size_t);
+    size_t *sizes        = UT_Hook_GetArgValueByName(Context, "sizes", size_t *);
+    uint32 *count_copied = UT_Hook_GetArgValueByName(Context, "count_copied", uint32 *);
+    int32   status;
+
+    *count_copied = 0;
+
+    /* This provides a single message, from the data buffer supplied by the test case if any */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        sizes[0] = UT_Stub_CopyToLocal(FuncKey, data, stride);
+        if (sizes[0] == 0)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        *count_copied = 1;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueReserve' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueReserve(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **data = UT_Hook_GetArgValueByName(Context, "data", void **);
+    void * buffer;
+    int32  status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        /* The test case should supply the buffer to hand out via UT_SetDataBuffer() */
+        UT_GetDataBuffer(FuncKey, &buffer, NULL, NULL);
+        *data = buffer;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueBorrow' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueBorrow(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void **data = UT_Hook_GetArgValueByName(Context, "data", const void **);
+    size_t *     size = UT_Hook_GetArgValueByName(Context, "size", size_t *);
+    void *       buffer;
+    size_t       buffer_size;
+    int32        status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* The test case should supply the message to hand out via UT_SetDataBuffer() */
+        UT_GetDataBuffer(FuncKey, &buffer, &buffer_size, NULL);
+        if (buffer == NULL)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+    else
+    {
+        buffer      = NULL;
+        buffer_size = 0;
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        *data = buffer;
+        *size = buffer_size;
+    }
+    else
+    {
+        *data = NULL;
+        *size = 0;
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueueGetIdByName' stub
@@ -25,12 +25,70 @@
 #include "osapi-queue.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_QueueBorrow(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueuePut(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueuePutMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueReserve(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueBorrow()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueBorrow(osal_id_t queue_id, const void **data, size_t *size, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueBorrow, int32);
+
+    UT_GenStub_AddParam(OS_QueueBorrow, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueBorrow, const void **, data);
+    UT_GenStub_AddParam(OS_QueueBorrow, size_t *, size);
+    UT_GenStub_AddParam(OS_QueueBorrow, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueBorrow, Basic, UT_DefaultHandler_OS_QueueBorrow);
+
+    return UT_GenStub_GetReturnValue(OS_QueueBorrow, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCancel()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCancel(osal_id_t queue_id, void *data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCancel, int32);
+
+    UT_GenStub_AddParam(OS_QueueCancel, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueCancel, void *, data);
+
+    UT_GenStub_Execute(OS_QueueCancel, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCancel, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *data, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueCommit, void *, data);
+    UT_GenStub_AddParam(OS_QueueCommit, size_t, size);
+
+    UT_GenStub_Execute(OS_QueueCommit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit, int32);
+}
 
 /*
  * ----------------------------------------------------
@@ -123,6 +181,29 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMulti(osal_id_t queue_id, void *data, size_t stride, size_t *sizes, uint32 count, uint32 *count_copied,
+                       int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMulti, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMulti, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetMulti, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMulti, size_t, stride);
+    UT_GenStub_AddParam(OS_QueueGetMulti, size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32, count);
+    UT_GenStub_AddParam(OS_QueueGetMulti, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMulti, Basic, UT_DefaultHandler_OS_QueueGetMulti);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut()
@@ -141,3 +222,60 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
 
     return UT_GenStub_GetReturnValue(OS_QueuePut, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMulti(osal_id_t queue_id, const void *data, size_t stride, const size_t *sizes, uint32 count,
+                       uint32 *count_put, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMulti, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMulti, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueuePutMulti, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutMulti, size_t, stride);
+    UT_GenStub_AddParam(OS_QueuePutMulti, const size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32 *, count_put);
+    UT_GenStub_AddParam(OS_QueuePutMulti, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueuePutMulti, Basic, UT_DefaultHandler_OS_QueuePutMulti);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueReserve, void **, data);
+
+    UT_GenStub_Execute(OS_QueueReserve, Basic, UT_DefaultHandler_OS_QueueReserve);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReturn()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReturn(osal_id_t queue_id, const void *data)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReturn, int32);
+
+    UT_GenStub_AddParam(OS_QueueReturn, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueReturn, const void *, data);
+
+    UT_GenStub_Execute(OS_QueueReturn, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReturn, int32);
+}
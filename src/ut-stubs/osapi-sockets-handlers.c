@@ -118,6 +118,104 @@ void UT_DefaultHandler_OS_SocketSendTo(void *UserObj, UT_EntryKey_t FuncKey, con
     UT_Stub_SetReturnValue(FuncKey, status);
 }
 
+/*****************************************************************************
+ *
+ * Local Stub helper function for batched receive
+ *
+ *****************************************************************************/
+static void UT_SocketRecvMultiStub(UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_SockMsg_t *msgs  = UT_Hook_GetArgValueByName(Context, "msgs", OS_SockMsg_t *);
+    uint32        count = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    int32         status;
+    uint32        i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = count;
+    }
+
+    /* generate fill data for each message that was "received" */
+    for (i = 0; status > 0 && i < (uint32)status && i < count; ++i)
+    {
+        memset(msgs[i].Buffer, 0, msgs[i].BufLen);
+        msgs[i].MsgLen = msgs[i].BufLen;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketRecvFromMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketRecvFromMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SocketRecvMultiStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketRecvFromMultiAbs' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketRecvFromMultiAbs(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SocketRecvMultiStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketSendToMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketSendToMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_SockMsg_t *msgs  = UT_Hook_GetArgValueByName(Context, "msgs", OS_SockMsg_t *);
+    uint32        count = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    int32         status;
+    uint32        i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = count;
+    }
+
+    /* pretend the full length of each message was sent */
+    for (i = 0; status > 0 && i < (uint32)status && i < count; ++i)
+    {
+        msgs[i].MsgLen = msgs[i].BufLen;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketSendV' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketSendV(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const OS_iovec_t *iov    = UT_Hook_GetArgValueByName(Context, "iov", const OS_iovec_t *);
+    uint32            iovcnt = UT_Hook_GetArgValueByName(Context, "iovcnt", uint32);
+    int32             status;
+    uint32            i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* pretend the full length of all segments was sent */
+        status = 0;
+        for (i = 0; i < iovcnt; ++i)
+        {
+            status += iov[i].Length;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_SocketGetIdByName' stub
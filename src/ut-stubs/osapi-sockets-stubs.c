@@ -33,7 +33,11 @@ void UT_DefaultHandler_OS_SocketGetIdByName(void *, UT_EntryKey_t, const UT_Stub
 void UT_DefaultHandler_OS_SocketGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_SocketOpen(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_SocketRecvFrom(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_SocketRecvFromMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_SocketRecvFromMultiAbs(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_SocketSendTo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_SocketSendToMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_SocketSendV(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -301,6 +305,44 @@ int32 OS_SocketRecvFromAbs(osal_id_t sock_id, void *buffer, size_t buflen, OS_So
     return UT_GenStub_GetReturnValue(OS_SocketRecvFromAbs, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, uint32, count);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMulti, Basic, UT_DefaultHandler_OS_SocketRecvFromMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMultiAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMultiAbs(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMultiAbs, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, uint32, count);
+    UT_GenStub_AddParam(OS_SocketRecvFromMultiAbs, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMultiAbs, Basic, UT_DefaultHandler_OS_SocketRecvFromMultiAbs);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMultiAbs, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo()
@@ -320,6 +362,43 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return UT_GenStub_GetReturnValue(OS_SocketSendTo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, uint32, count);
+
+    UT_GenStub_Execute(OS_SocketSendToMulti, Basic, UT_DefaultHandler_OS_SocketSendToMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToMulti, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendV()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendV(osal_id_t sock_id, const OS_iovec_t *iov, uint32 iovcnt, const OS_SockAddr_t *RemoteAddr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendV, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendV, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendV, const OS_iovec_t *, iov);
+    UT_GenStub_AddParam(OS_SocketSendV, uint32, iovcnt);
+    UT_GenStub_AddParam(OS_SocketSendV, const OS_SockAddr_t *, RemoteAddr);
+
+    UT_GenStub_Execute(OS_SocketSendV, Basic, UT_DefaultHandler_OS_SocketSendV);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendV, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketShutdown()
@@ -132,3 +132,22 @@ void UT_DefaultHandler_OS_TimeBaseGetFreeRun(void *UserObj, UT_EntryKey_t FuncKe
         *freerun_val = UT_GetStubCount(FuncKey);
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_TimeBaseGetStats' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_TimeBaseGetStats(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_timer_stats_t *stats = UT_Hook_GetArgValueByName(Context, "stats", OS_timer_stats_t *);
+    int32             status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_TimeBaseGetStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
@@ -30,6 +30,7 @@ void UT_DefaultHandler_OS_TimeBaseDelete(void *, UT_EntryKey_t, const UT_StubCon
 void UT_DefaultHandler_OS_TimeBaseGetFreeRun(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimeBaseGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimeBaseGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_TimeBaseGetStats(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -116,6 +117,23 @@ int32 OS_TimeBaseGetInfo(osal_id_t timebase_id, OS_timebase_prop_t *timebase_pro
     return UT_GenStub_GetReturnValue(OS_TimeBaseGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBaseGetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_TimeBaseGetStats(osal_id_t timebase_id, OS_timer_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimeBaseGetStats, int32);
+
+    UT_GenStub_AddParam(OS_TimeBaseGetStats, osal_id_t, timebase_id);
+    UT_GenStub_AddParam(OS_TimeBaseGetStats, OS_timer_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_TimeBaseGetStats, Basic, UT_DefaultHandler_OS_TimeBaseGetStats);
+
+    return UT_GenStub_GetReturnValue(OS_TimeBaseGetStats, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimeBaseSet()
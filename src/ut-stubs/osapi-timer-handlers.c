@@ -131,3 +131,21 @@ void UT_DefaultHandler_OS_TimerGetInfo(void *UserObj, UT_EntryKey_t FuncKey, con
         UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_TASK, &timer_prop->creator);
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_TimerGetStats' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_TimerGetStats(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_timer_stats_t *stats = UT_Hook_GetArgValueByName(Context, "stats", OS_timer_stats_t *);
+    int32             status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS && UT_Stub_CopyToLocal(UT_KEY(OS_TimerGetStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
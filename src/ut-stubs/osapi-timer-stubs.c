@@ -30,6 +30,7 @@ void UT_DefaultHandler_OS_TimerCreate(void *, UT_EntryKey_t, const UT_StubContex
 void UT_DefaultHandler_OS_TimerDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimerGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimerGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_TimerGetStats(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -122,6 +123,23 @@ int32 OS_TimerGetInfo(osal_id_t timer_id, OS_timer_prop_t *timer_prop)
     return UT_GenStub_GetReturnValue(OS_TimerGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimerGetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_TimerGetStats(osal_id_t timer_id, OS_timer_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimerGetStats, int32);
+
+    UT_GenStub_AddParam(OS_TimerGetStats, osal_id_t, timer_id);
+    UT_GenStub_AddParam(OS_TimerGetStats, OS_timer_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_TimerGetStats, Basic, UT_DefaultHandler_OS_TimerGetStats);
+
+    return UT_GenStub_GetReturnValue(OS_TimerGetStats, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimerSet()